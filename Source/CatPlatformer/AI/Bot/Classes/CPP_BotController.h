@@ -0,0 +1,224 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef CPP_PLAYERCONTROLLER_H
+#define CPP_PLAYERCONTROLLER_H
+#include "CatPlatformer/GameMode/Classes/CPP_PlayerController.h"
+#endif
+class ACPP_PlayerController;
+class ACPP_Character;
+class ACPP_PlayerState;
+
+#include "CPP_BotController.generated.h"
+
+/** Enumeration for the current bot's goal. */
+UENUM()
+enum class EBotGoal : uint8
+{
+	None,
+	Wander,
+	CollectBuff,
+	AttackCrow,
+	ReachVictoryActor
+};
+
+/**
+ * Player controller that drives the cat without any human
+ * input. Is used by headless clients for load and soak
+ * testing: the client connects to the server with the
+ * «?Bot» URL option, and the Game Mode spawns this class
+ * instead of the usual player controller.
+ * Example of launching one bot client:
+ * CatPlatformer 127.0.0.1?Bot -game -nullrhi -nosound
+ * -ini:Engine:[OnlineSubsystem]:DefaultPlatformService=Null
+ */
+UCLASS()
+class CATPLATFORMER_API ACPP_BotController : public ACPP_PlayerController
+{
+	GENERATED_BODY()
+
+protected:
+	/** The constructor to set default variables. */
+	ACPP_BotController();
+
+	/**
+	 * Function for storing logic that should be applied
+	 * when the actor appears in the game world.
+	 */
+	virtual void BeginPlay() override;
+
+	/**
+	 * Function for storing logic that should be applied in
+	 * the end of the actor's life (but before its destroying).
+	 * @param EndPlayReason Specifies why an actor is being
+	 * deleted/removed from a level.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * Bots don't read any devices, so only the input
+	 * component itself is created here.
+	 */
+	virtual void SetupInputComponent() override;
+
+	/**
+	 * Function that is called every frame, but only for
+	 * locally controlled player controllers (so only inside
+	 * the bot's own client process).
+	 * Is needed for feeding movement input to the character.
+	 */
+	virtual void PlayerTick(float DeltaTime) override;
+
+	//======================Readiness=============================
+private:
+	/**
+	 * Timer handle for checking if the bot should mark
+	 * itself as ready to start the level.
+	 */
+	FTimerHandle TH_CheckReadiness;
+
+	/**
+	 * Timer handle for enabling the bot's movement after
+	 * the countdown before the level start.
+	 */
+	FTimerHandle TH_FinishCountdown;
+
+	/**
+	 * Delegate handle for storing replying on Player State's
+	 * Should Begin Countdown To Start Level event.
+	 */
+	FDelegateHandle DH_ShouldBeginCountdown;
+
+	/**
+	 * Weak pointer to the Player State to which the
+	 * countdown delegate was bound.
+	 */
+	TWeakObjectPtr<ACPP_PlayerState> BoundPlayerStateRef;
+
+	/**
+	 * Function for telling the server that the bot is ready
+	 * to start the level (the same as pressing the «Ready»
+	 * button by human).
+	 */
+	void CheckReadiness();
+
+	/**
+	 * Function that is called when all players are ready
+	 * and the countdown before the level start was begun.
+	 */
+	void CountdownWasStarted();
+
+	/** Function for allowing the bot to move. */
+	void FinishCountdown();
+
+	//========================Goals===============================
+
+	/** Current bot's goal. */
+	EBotGoal CurrentGoal;
+
+	/** The actor that the bot is trying to reach. */
+	TWeakObjectPtr<AActor> GoalActor;
+
+	/** The point that the bot is trying to reach. */
+	FVector GoalLocation;
+
+	/** Timer handle for calling ChooseNewGoal function. */
+	FTimerHandle TH_ChooseNewGoal;
+
+	/**
+	 * Function for choosing the nearest crow to attack, the
+	 * nearest buff to collect or the victory actor to finish
+	 * the level. Is called by a looped timer, so the world
+	 * isn't searched every frame.
+	 */
+	void ChooseNewGoal();
+
+	/**
+	 * Function for finding the nearest actor of the
+	 * particular class.
+	 * @param OutDistance Distance to the found actor.
+	 * @return The nearest actor or nullptr.
+	 */
+	template <typename T>
+	T* FindNearestActor(float& OutDistance) const;
+
+	/**
+	 * Function for checking if there is a floor in front of
+	 * the character.
+	 * @param Character The controlled character.
+	 * @param Direction The movement direction.
+	 * @return True if the character will not fall after
+	 * taking a step forward.
+	 */
+	bool IsFloorAhead(const ACPP_Character* Character, const FVector& Direction) const;
+
+	/** Timer handle for calling StopJumping function. */
+	FTimerHandle TH_StopJumping;
+
+	/**
+	 * Function for starting the jump (the same as pressing
+	 * the jump key by human).
+	 */
+	void StartJumping();
+
+	/**
+	 * Function for ending the jump (the same as releasing
+	 * the jump key by human).
+	 */
+	void StopJumping();
+
+	//=======================Stucking=============================
+
+	/** The character's location during the previous check. */
+	FVector LastCheckedLocation;
+
+	/**
+	 * Number of seconds during which the character hasn't
+	 * been moving while it should.
+	 */
+	float SecondsWithoutMoving;
+
+protected:
+	/** Radius in which crows are hunted. */
+	UPROPERTY(EditDefaultsOnly, Category = "Bot")
+	float CrowSearchRadius;
+
+	/** Radius in which buffs are collected. */
+	UPROPERTY(EditDefaultsOnly, Category = "Bot")
+	float BuffSearchRadius;
+
+	/** Distance from which the bot starts the attack. */
+	UPROPERTY(EditDefaultsOnly, Category = "Bot")
+	float AttackDistance;
+
+	/**
+	 * Distance in front of the character where the floor is
+	 * checked before jumping over a gap.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Bot")
+	float GapProbeDistance;
+
+	/**
+	 * Height difference after which the goal is considered
+	 * to be on the upper platform.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Bot")
+	float JumpHeightThreshold;
+
+	/**
+	 * Number of seconds without moving after which the bot
+	 * tries to jump out of the stuck position.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Bot")
+	float StuckSecondsBeforeJump;
+
+	/**
+	 * Probability that the bot will sprint to the chosen
+	 * goal.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Bot", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float SprintProbability;
+};
\ No newline at end of file
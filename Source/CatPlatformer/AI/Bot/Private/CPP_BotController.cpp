@@ -0,0 +1,320 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_BotController.h"
+#include "EngineUtils.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Kismet/KismetMathLibrary.h"
+
+#ifndef CPP_ENEMYCHARACTER_H
+#define CPP_ENEMYCHARACTER_H
+#include "CatPlatformer/AI/Enemy/Classes/CPP_EnemyCharacter.h"
+#endif
+
+#ifndef CPP_BUFF_H
+#define CPP_BUFF_H
+#include "CatPlatformer/Buffs/Classes/CPP_Buff.h"
+#endif
+
+#ifndef CPP_VICTORYACTOR_H
+#define CPP_VICTORYACTOR_H
+#include "CatPlatformer/GameWorldObjects/Classes/CPP_VictoryActor.h"
+#endif
+
+ACPP_BotController::ACPP_BotController(): CurrentGoal(EBotGoal::None),
+                                          GoalActor(nullptr),
+                                          GoalLocation(FVector::ZeroVector),
+                                          LastCheckedLocation(FVector::ZeroVector),
+                                          SecondsWithoutMoving(0.0f),
+                                          CrowSearchRadius(700.0f),
+                                          BuffSearchRadius(1200.0f),
+                                          AttackDistance(130.0f),
+                                          GapProbeDistance(90.0f),
+                                          JumpHeightThreshold(40.0f),
+                                          StuckSecondsBeforeJump(0.75f),
+                                          SprintProbability(0.5f)
+{
+}
+
+void ACPP_BotController::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!IsLocalController())
+		return;
+
+	GetWorld()->GetTimerManager().SetTimer(TH_CheckReadiness,
+	                                       this,
+	                                       &ACPP_BotController::CheckReadiness,
+	                                       1.0f,
+	                                       true);
+	GetWorld()->GetTimerManager().SetTimer(TH_ChooseNewGoal,
+	                                       this,
+	                                       &ACPP_BotController::ChooseNewGoal,
+	                                       0.5f,
+	                                       true,
+	                                       FMath::FRandRange(0.0f, 0.5f));
+}
+
+void ACPP_BotController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (BoundPlayerStateRef.IsValid())
+	{
+		BoundPlayerStateRef->ShouldBeginCountdownToStartLevelDelegate.Remove(DH_ShouldBeginCountdown);
+		DH_ShouldBeginCountdown.Reset();
+		BoundPlayerStateRef = nullptr;
+	}
+
+	if (GetWorld()->GetTimerManager().TimerExists(TH_CheckReadiness))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_CheckReadiness);
+	}
+	if (GetWorld()->GetTimerManager().TimerExists(TH_FinishCountdown))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_FinishCountdown);
+	}
+	if (GetWorld()->GetTimerManager().TimerExists(TH_ChooseNewGoal))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_ChooseNewGoal);
+	}
+	if (GetWorld()->GetTimerManager().TimerExists(TH_StopJumping))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_StopJumping);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ACPP_BotController::SetupInputComponent()
+{
+	// Skipping the ACPP_PlayerController's bindings on purpose.
+	APlayerController::SetupInputComponent();
+}
+
+void ACPP_BotController::PlayerTick(float DeltaTime)
+{
+	Super::PlayerTick(DeltaTime);
+
+	ACPP_Character* Character = GetCharacterRef();
+	if (bWaitingForReadinessToStartLevel || bIsPaused ||
+		!IsValid(Character) || Character->bIsReceivingDamage ||
+		CurrentGoal == EBotGoal::None)
+		return;
+
+	if (GoalActor.IsValid())
+	{
+		GoalLocation = GoalActor->GetActorLocation();
+	}
+
+	const FVector CurrentLocation = Character->GetActorLocation();
+	FVector Direction = GoalLocation - CurrentLocation;
+	const float HeightDifference = Direction.Z;
+	Direction.Z = 0.0f;
+	const float Distance = Direction.Size();
+	Direction = Direction.GetSafeNormal();
+
+	if (CurrentGoal == EBotGoal::AttackCrow && Distance <= AttackDistance)
+	{
+		if (!Character->bIsAttacking)
+		{
+			Character->Server_Attack();
+		}
+		return;
+	}
+
+	if (Character->bIsAttacking)
+		return;
+
+	Character->AddMovementInput(Direction, 1.0f);
+
+	if (!Character->bIsJumping &&
+		Character->GetCharacterMovement()->IsMovingOnGround())
+	{
+		if (HeightDifference > JumpHeightThreshold ||
+			!IsFloorAhead(Character, Direction))
+		{
+			StartJumping();
+		}
+		else
+		{
+			// Jumping out of the corners and from behind the
+			// obstacles.
+			if (FVector::DistSquared2D(CurrentLocation, LastCheckedLocation) < 1.0f)
+			{
+				SecondsWithoutMoving += DeltaTime;
+				if (SecondsWithoutMoving >= StuckSecondsBeforeJump)
+				{
+					SecondsWithoutMoving = 0.0f;
+					StartJumping();
+				}
+			}
+			else
+			{
+				SecondsWithoutMoving = 0.0f;
+			}
+		}
+	}
+	LastCheckedLocation = CurrentLocation;
+}
+
+void ACPP_BotController::CheckReadiness()
+{
+	ACPP_PlayerState* PS = GetPlayerState<ACPP_PlayerState>();
+	if (!IsValid(PS))
+		return;
+
+	if (BoundPlayerStateRef.Get() != PS)
+	{
+		if (BoundPlayerStateRef.IsValid())
+		{
+			BoundPlayerStateRef->ShouldBeginCountdownToStartLevelDelegate.Remove(DH_ShouldBeginCountdown);
+		}
+		BoundPlayerStateRef = PS;
+		DH_ShouldBeginCountdown = PS->ShouldBeginCountdownToStartLevelDelegate.AddUObject(
+			this, &ACPP_BotController::CountdownWasStarted);
+	}
+
+	if (bWaitingForReadinessToStartLevel && !PS->GetPlayerIsReadyToStartGame())
+	{
+		SetPlayerIsReadyToStartGame(true);
+	}
+}
+
+void ACPP_BotController::CountdownWasStarted()
+{
+	if (GetWorld()->GetTimerManager().TimerExists(TH_FinishCountdown))
+		return;
+
+	// The same 3 seconds as in the level widget's countdown.
+	GetWorld()->GetTimerManager().SetTimer(TH_FinishCountdown,
+	                                       this,
+	                                       &ACPP_BotController::FinishCountdown,
+	                                       3.0f,
+	                                       false);
+}
+
+void ACPP_BotController::FinishCountdown()
+{
+	if (GetWorld()->GetTimerManager().TimerExists(TH_FinishCountdown))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_FinishCountdown);
+	}
+	bWaitingForReadinessToStartLevel = false;
+}
+
+void ACPP_BotController::ChooseNewGoal()
+{
+	ACPP_Character* Character = GetCharacterRef();
+	if (!IsValid(Character))
+	{
+		CurrentGoal = EBotGoal::None;
+		GoalActor = nullptr;
+		return;
+	}
+
+	float Distance = 0.0f;
+	const EBotGoal PreviousGoal = CurrentGoal;
+	if (ACPP_EnemyCharacter* Crow = FindNearestActor<ACPP_EnemyCharacter>(Distance);
+		IsValid(Crow) && Distance <= CrowSearchRadius)
+	{
+		CurrentGoal = EBotGoal::AttackCrow;
+		GoalActor = Crow;
+	}
+	else if (ACPP_Buff* Buff = FindNearestActor<ACPP_Buff>(Distance);
+		IsValid(Buff) && Distance <= BuffSearchRadius)
+	{
+		CurrentGoal = EBotGoal::CollectBuff;
+		GoalActor = Buff;
+	}
+	else if (ACPP_VictoryActor* VictoryActor = FindNearestActor<ACPP_VictoryActor>(Distance);
+		IsValid(VictoryActor))
+	{
+		CurrentGoal = EBotGoal::ReachVictoryActor;
+		GoalActor = VictoryActor;
+	}
+	else if (CurrentGoal != EBotGoal::Wander ||
+		FVector::Dist2D(Character->GetActorLocation(), GoalLocation) < 50.0f)
+	{
+		CurrentGoal = EBotGoal::Wander;
+		GoalActor = nullptr;
+		GoalLocation = Character->GetActorLocation() +
+			UKismetMathLibrary::RandomUnitVector() * FVector(500.0f, 500.0f, 0.0f);
+	}
+
+	if (GoalActor.IsValid())
+	{
+		GoalLocation = GoalActor->GetActorLocation();
+	}
+
+	if (CurrentGoal != PreviousGoal)
+	{
+		Character->ChangeCurrentSpeed(FMath::FRand() < SprintProbability);
+	}
+}
+
+template <typename T>
+T* ACPP_BotController::FindNearestActor(float& OutDistance) const
+{
+	const APawn* ControlledPawn = GetPawn();
+	if (!IsValid(ControlledPawn))
+		return nullptr;
+
+	const FVector Origin = ControlledPawn->GetActorLocation();
+	T* NearestActor = nullptr;
+	float MinDistanceSquared = TNumericLimits<float>::Max();
+	for (TActorIterator<T> It(GetWorld()); It; ++It)
+	{
+		if (!IsValid(*It) || It->IsActorBeingDestroyed())
+			continue;
+
+		if constexpr (std::is_same_v<T, ACPP_EnemyCharacter>)
+		{
+			if (It->GetIsDead())
+				continue;
+		}
+
+		if (const float DistanceSquared = FVector::DistSquared(Origin, It->GetActorLocation());
+			DistanceSquared < MinDistanceSquared)
+		{
+			MinDistanceSquared = DistanceSquared;
+			NearestActor = *It;
+		}
+	}
+	OutDistance = NearestActor ? FMath::Sqrt(MinDistanceSquared) : 0.0f;
+	return NearestActor;
+}
+
+bool ACPP_BotController::IsFloorAhead(const ACPP_Character* Character, const FVector& Direction) const
+{
+	const FVector Start = Character->GetActorLocation() + Direction * GapProbeDistance;
+	const FVector End = Start - FVector(0.0f, 0.0f, 400.0f);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BotFloorProbe), false, Character);
+	FHitResult HitResult;
+	return GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams);
+}
+
+void ACPP_BotController::StartJumping()
+{
+	ACPP_Character* Character = GetCharacterRef();
+	if (!IsValid(Character) || GetWorld()->GetTimerManager().TimerExists(TH_StopJumping))
+		return;
+
+	Character->CustomStartJumping();
+	GetWorld()->GetTimerManager().SetTimer(TH_StopJumping,
+	                                       this,
+	                                       &ACPP_BotController::StopJumping,
+	                                       0.3f,
+	                                       false);
+}
+
+void ACPP_BotController::StopJumping()
+{
+	if (GetWorld()->GetTimerManager().TimerExists(TH_StopJumping))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_StopJumping);
+	}
+	if (ACPP_Character* Character = GetCharacterRef(); IsValid(Character))
+	{
+		Character->CustomStopJumping();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,428 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#ifndef CPP_ENEMYCHARACTER_H
+#define CPP_ENEMYCHARACTER_H
+#include "CatPlatformer/AI/Enemy/Classes/CPP_EnemyCharacter.h"
+#endif
+class ACPP_EnemyCharacter;
+class ACPP_EnemyAIController;
+class ACPP_Character;
+class ACPP_PlatformWithNPC;
+
+#include "CPP_CrowSimulation.generated.h"
+
+/**
+ * Subsystem for updating the behavior of all crows (enemy
+ * characters) in one pass. The state of every crow is kept
+ * in contiguous arrays (one array per field). Every frame
+ * the subsystem gathers the pawns' data, runs the
+ * Walking/Flying/Chasing/Attacking decision step for all
+ * crows (in parallel for big numbers of crows) and writes
+ * the results (movement input, speed, state, attack) back
+ * to the pawns. Works on the server only.
+ * Crows of the platforms with the swarm mode are spawned as
+ * lightweight proxies (array entries without any actor)
+ * that wander around their homes. A proxy is promoted to a
+ * full enemy character when a player comes close to it,
+ * and the character is demoted back to a proxy when all
+ * players are far away and it isn't chasing anybody.
+ * The «Cat.CrowSwarmSoak» console command spawns extra
+ * proxies around the first player and logs the average
+ * and maximum times of the behavior update and of the
+ * promotion checks.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_CrowSimulation : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Function for initializing the subsystem.
+	 * @param Collection Collection of subsystems.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Function for cleaning up the subsystem. */
+	virtual void Deinitialize() override;
+
+	/**
+	 * Function that is called every frame for updating all
+	 * crows.
+	 * @param DeltaTime Frame time.
+	 */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Should the subsystem be ticked now? */
+	virtual bool IsTickable() const override;
+
+	/** Stat ID of the subsystem's tick. */
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Function for limiting the subsystem to the game
+	 * worlds only.
+	 * @param WorldType Type of the world.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	/**
+	 * Function for adding the crow to the simulation.
+	 * @param Controller Crow's AI controller.
+	 * @param Crow Possessed enemy character.
+	 */
+	void RegisterCrow(ACPP_EnemyAIController* Controller, ACPP_EnemyCharacter* Crow);
+
+	/**
+	 * Function for removing the crow from the simulation.
+	 * @param Controller Crow's AI controller.
+	 */
+	void UnregisterCrow(const ACPP_EnemyAIController* Controller);
+
+	/**
+	 * Function for adding the crow as a proxy (without
+	 * spawning the actor). Is called on the server only.
+	 * @param Platform Platform that owns the crow.
+	 * @param CrowClass Class of the actor to spawn when the
+	 * crow is promoted.
+	 * @param Transform Home transform of the crow.
+	 */
+	void SpawnProxyCrow(ACPP_PlatformWithNPC* Platform, const TSubclassOf<ACPP_EnemyCharacter> CrowClass,
+	                    const FTransform& Transform);
+
+	/** Getter for the number of simulated crows. */
+	FORCEINLINE int32 GetCrowsNumber() const { return Controllers.Num(); }
+
+	/** Getter for the number of crows without actors. */
+	FORCEINLINE int32 GetProxyCrowsNumber() const { return ProxyCrowsNumber; }
+
+	/**
+	 * Getter for the number of proxies that are close enough
+	 * to be promoted, but are waiting for the next check.
+	 */
+	FORCEINLINE int32 GetPendingPromotionsNumber() const { return PendingPromotionsNumber; }
+
+	/** Function for printing the swarm's statistics. */
+	void PrintSwarmReport() const;
+
+	/**
+	 * Function for starting the soak run: spawns proxies
+	 * around the first player (as copies of the existing
+	 * swarm crow) and measures the simulation until the
+	 * time is over. The proxies are removed afterwards.
+	 * @param ProxiesNumber Number of proxies to spawn.
+	 * @param Seconds Duration of the run.
+	 */
+	void StartSoak(const int32 ProxiesNumber, const float Seconds);
+
+private:
+	/** Flags of the current frame. */
+	enum EInputFlags : uint8
+	{
+		Input_HasChaseTarget = 1 << 0,
+		Input_IsAttacking = 1 << 1,
+		Input_IsFalling = 1 << 2
+	};
+
+	/** Flags that are kept between the frames. */
+	enum EStateFlags : uint8
+	{
+		State_TargetIsSet = 1 << 0,
+		State_TargetReached = 1 << 1,
+		State_IsFlyingMode = 1 << 2,
+		State_IsChasing = 1 << 3,
+		State_IsFlyingChasing = 1 << 4
+	};
+
+	/** Commands that are applied to the pawns. */
+	enum ECommands : uint8
+	{
+		Command_BasicWalkingSpeed = 1 << 0,
+		Command_ChasingWalkingSpeed = 1 << 1,
+		Command_BasicFlyingSpeed = 1 << 2,
+		Command_ChasingFlyingSpeed = 1 << 3,
+		Command_SetWalkingMovement = 1 << 4,
+		Command_Attack = 1 << 5
+	};
+
+	//======================Settings===============================
+
+	/** Radius in which the walking target is found. */
+	float WalkingSearchRadius;
+
+	/** Radius in which the flying target is found. */
+	float FlyingSearchRadius;
+
+	/** Maximum height of the flying target. */
+	float FlyingMaxHeight;
+
+	/**
+	 * Distances at which the walking, flying and chasing
+	 * targets are considered reached.
+	 */
+	float WalkingTolerance;
+	float FlyingTolerance;
+	float ChasingTolerance;
+
+	/**
+	 * Minimum and maximum number of targets to reach before
+	 * switching between the walking and flying modes.
+	 */
+	int32 MinTargetsNumber;
+	int32 MaxTargetsNumber;
+
+	/**
+	 * Minimum and maximum time in one mode before switching
+	 * between the walking and flying modes.
+	 */
+	float MinModeTime;
+	float MaxModeTime;
+
+	/**
+	 * Minimum number of crows for running the decision step
+	 * in parallel.
+	 */
+	int32 ParallelThreshold;
+
+	/**
+	 * Distance to the closest player at which the proxy is
+	 * promoted to the actor.
+	 */
+	float PromotionDistance;
+
+	/**
+	 * Distance to the closest player at which the actor is
+	 * demoted to the proxy (is bigger than the promotion
+	 * distance, so the crows don't flicker on the border).
+	 */
+	float DemotionDistance;
+
+	/** Interval between the promotion checks. */
+	float PromotionCheckInterval;
+
+	/** Maximum number of promoted swarm crows. */
+	int32 MaxPromotedCrows;
+
+	/**
+	 * Maximum number of promotions during one check (for
+	 * spreading the spawning over several frames).
+	 */
+	int32 MaxPromotionsPerCheck;
+
+	/** Walking and flying speeds of the proxies. */
+	float ProxyWalkingSpeed;
+	float ProxyFlyingSpeed;
+
+	//======================Crows==================================
+
+	/** AI controllers of the crows. */
+	UPROPERTY()
+	TArray<ACPP_EnemyAIController*> Controllers;
+
+	/** Enemy characters of the crows. */
+	UPROPERTY()
+	TArray<ACPP_EnemyCharacter*> Crows;
+
+	/** Player characters that are chased (gathered every frame). */
+	UPROPERTY()
+	TArray<ACPP_Character*> ChaseTargets;
+
+	/** Platforms that own the swarm crows (nullptr for the rest). */
+	UPROPERTY()
+	TArray<ACPP_PlatformWithNPC*> Platforms;
+
+	/**
+	 * Classes of the swarm crows' actors (nullptr for the
+	 * crows that can't be demoted).
+	 */
+	UPROPERTY()
+	TArray<TSubclassOf<ACPP_EnemyCharacter>> CrowClasses;
+
+	/** Flags indicating if the crow has no actor at the moment. */
+	TArray<bool> IsProxies;
+
+	/** Flags indicating if the crow was spawned by the soak run. */
+	TArray<bool> IsSoakCrows;
+
+	//======================Input (gathered)=======================
+
+	/** Current locations of the crows. */
+	TArray<FVector> Positions;
+
+	/** Current locations of the chased players. */
+	TArray<FVector> ChaseLocations;
+
+	/** Current states of the crows. */
+	TArray<EEnemyState> States;
+
+	/** Flags of the current frame (see EInputFlags). */
+	TArray<uint8> InputFlags;
+
+	//======================Persistent state=======================
+
+	/** Locations around which the crows walk and fly. */
+	TArray<FVector> HomeLocations;
+
+	/** Rotations of the crows' actors when they are spawned. */
+	TArray<FRotator> HomeRotations;
+
+	/** Current walking or flying targets. */
+	TArray<FVector> TargetLocations;
+
+	/** Number of targets reached in the current mode. */
+	TArray<uint8> TargetsCounters;
+
+	/**
+	 * Number of targets to reach before switching the mode
+	 * (0 if the mode has just started).
+	 */
+	TArray<uint8> MaxTargets;
+
+	/**
+	 * Seconds left before switching between the walking and
+	 * flying modes.
+	 */
+	TArray<float> ModeTimers;
+
+	/** Persistent flags (see EStateFlags). */
+	TArray<uint8> StateFlags;
+
+	/** Random streams of the crows (are safe to use in parallel). */
+	TArray<FRandomStream> RandomStreams;
+
+	//======================Output=================================
+
+	/** Movement input to add to the pawns. */
+	TArray<FVector> MoveInputs;
+
+	/** Commands to apply to the pawns (see ECommands). */
+	TArray<uint8> Commands;
+
+	/** New states of the crows. */
+	TArray<EEnemyState> NewStates;
+
+	//======================Helpers================================
+
+	/** Flag indicating if the results are written back now. */
+	bool bIsApplying;
+
+	/**
+	 * Flag indicating if some crows were removed while the
+	 * results were written back.
+	 */
+	bool bHasRemovedCrows;
+
+	/** Seconds until the next promotion check. */
+	float SecondsToPromotionCheck;
+
+	/** Number of crows without actors. */
+	int32 ProxyCrowsNumber;
+
+	/**
+	 * Number of promotion candidates that were left for the
+	 * next check (because of the promotion limits).
+	 */
+	int32 PendingPromotionsNumber;
+
+	/** Total numbers of promotions and demotions. */
+	int32 PromotionsNumber;
+	int32 DemotionsNumber;
+
+	//======================Soak run===============================
+
+	/** Is the soak run active at the moment? */
+	bool bIsSoakRunning;
+
+	/** Seconds left before the end of the soak run. */
+	float SoakSecondsLeft;
+
+	/** Number of frames measured by the soak run. */
+	int32 SoakFramesNumber;
+
+	/**
+	 * Total and maximum time of the behavior update during
+	 * the soak run (in milliseconds).
+	 */
+	double SoakBehaviorMs;
+	double SoakMaxBehaviorMs;
+
+	/** Number of promotion checks during the soak run. */
+	int32 SoakPromotionChecksNumber;
+
+	/**
+	 * Total and maximum time of the promotion checks during
+	 * the soak run (in milliseconds).
+	 */
+	double SoakPromotionMs;
+	double SoakMaxPromotionMs;
+
+	/**
+	 * Numbers of promotions and demotions when the soak run
+	 * was started.
+	 */
+	int32 SoakStartPromotionsNumber;
+	int32 SoakStartDemotionsNumber;
+
+	/**
+	 * Function for adding the frame's times to the soak run
+	 * and for finishing the run when the time is over.
+	 * @param DeltaTime Frame time.
+	 * @param BehaviorMs Time of the behavior update.
+	 */
+	void UpdateSoak(const float DeltaTime, const double BehaviorMs);
+
+	/**
+	 * Function for printing the results of the soak run and
+	 * for removing its crows.
+	 */
+	void FinishSoak();
+
+	/** Function for reading the pawns' data into the arrays. */
+	void GatherInput();
+
+	/**
+	 * Function for running the decision step of one crow.
+	 * Uses only the crow's own array elements, so it can be
+	 * called from any thread.
+	 * @param Index Index of the crow.
+	 * @param DeltaSeconds Frame time.
+	 */
+	void StepCrow(const int32 Index, const float DeltaSeconds);
+
+	/** Function for writing the results back to the pawns. */
+	void ApplyResults();
+
+	/**
+	 * Function for promoting the closest proxies and for
+	 * demoting the far actors of the swarm crows.
+	 */
+	void UpdatePromotion();
+
+	/**
+	 * Function for spawning the actor of the proxy crow.
+	 * @param Index Index of the crow.
+	 * @return Was the actor spawned and possessed?
+	 */
+	bool PromoteCrow(const int32 Index);
+
+	/**
+	 * Function for destroying the actor of the swarm crow
+	 * and keeping its state in the proxy.
+	 * @param Index Index of the crow.
+	 */
+	void DemoteCrow(const int32 Index);
+
+	/**
+	 * Function for removing the crow's elements from all
+	 * arrays.
+	 * @param Index Index of the crow.
+	 */
+	void RemoveCrowAt(const int32 Index);
+};
\ No newline at end of file
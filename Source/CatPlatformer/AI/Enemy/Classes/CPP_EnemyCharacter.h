@@ -16,6 +16,8 @@ class ACPP_GameState;
 #include "CatPlatformer/GameMode/Classes/CPP_Character.h"
 #endif
 class ACPP_Character;
+class UAnimSequence;
+struct FAnimUpdateRateParameters;
 
 #include "CPP_EnemyCharacter.generated.h"
 
@@ -150,6 +152,27 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy | Enemy State")
 	UAnimMontage* FlyingAttackMontage;
 
+	/**
+	 * Looped walking animation that is shared between the
+	 * distant crows (see UCPP_CrowAnimationSharing).
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy | Animation Sharing")
+	UAnimSequence* SharedWalkingAnimation;
+
+	/**
+	 * Looped flying animation that is shared between the
+	 * distant crows (see UCPP_CrowAnimationSharing).
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy | Animation Sharing")
+	UAnimSequence* SharedFlyingAnimation;
+
+public:
+	/** Getter for the shared walking animation. */
+	FORCEINLINE UAnimSequence* GetSharedWalkingAnimation() const { return SharedWalkingAnimation; }
+
+	/** Getter for the shared flying animation. */
+	FORCEINLINE UAnimSequence* GetSharedFlyingAnimation() const { return SharedFlyingAnimation; }
+
 private:
 	/**
 	 * Delegate for storing function that should be called
@@ -166,6 +189,14 @@ private:
 	UFUNCTION()
 	void OnAttackMontageEnded(UAnimMontage* AnimMontage, bool bInterrupted);
 
+	/**
+	 * Function for setting up the update rate optimization
+	 * of the crow's skeletal mesh (distant crows skip the
+	 * animation frames).
+	 * @param Parameters Update rate parameters of the mesh.
+	 */
+	static void SetupAnimUpdateRate(FAnimUpdateRateParameters* Parameters);
+
 	/**
 	 * Apply damage to the enemy character.
 	 * @param DamageAmount How much damage to apply
@@ -0,0 +1,815 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_CrowSimulation.h"
+#include "Async/ParallelFor.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+#ifndef CPP_ENEMYAICONTROLLER_H
+#define CPP_ENEMYAICONTROLLER_H
+#include "CatPlatformer/AI/Enemy/Classes/CPP_EnemyAIController.h"
+#endif
+
+#ifndef CPP_PLATFORMWITHNPC_H
+#define CPP_PLATFORMWITHNPC_H
+#include "CatPlatformer/Platform/Classes/CPP_PlatformWithNPC.h"
+#endif
+
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+static TAutoConsoleVariable<bool> CVarCrowSimulationParallel(
+	TEXT("Cat.CrowSimulation.Parallel"),
+	true,
+	TEXT("Should the crows' decision step run in parallel (for big numbers of crows)?"));
+
+static FAutoConsoleCommandWithWorld CrowSwarmReportCommand(
+	TEXT("Cat.CrowSwarmReport"),
+	TEXT("Prints the numbers of simulated, proxy and promoted crows."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UCPP_CrowSimulation* CrowSimulation =
+				IsValid(World) ? World->GetSubsystem<UCPP_CrowSimulation>() : nullptr;
+			IsValid(CrowSimulation))
+		{
+			CrowSimulation->PrintSwarmReport();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs CrowSwarmSoakCommand(
+	TEXT("Cat.CrowSwarmSoak"),
+	TEXT("Spawns proxy crows around the first player and logs the crows' update times. ")
+	TEXT("Arguments: number of proxies (500 by default), duration in seconds (30 by default)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UCPP_CrowSimulation* CrowSimulation =
+				IsValid(World) ? World->GetSubsystem<UCPP_CrowSimulation>() : nullptr;
+			IsValid(CrowSimulation))
+		{
+			const int32 ProxiesNumber = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 500;
+			const float Seconds = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 30.0f;
+			CrowSimulation->StartSoak(ProxiesNumber, Seconds);
+		}
+	}));
+
+void UCPP_CrowSimulation::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	WalkingSearchRadius = 140.0f;
+	FlyingSearchRadius = 125.0f;
+	FlyingMaxHeight = 270.0f;
+	WalkingTolerance = 12.0f;
+	FlyingTolerance = 20.0f;
+	ChasingTolerance = 25.0f;
+	MinTargetsNumber = 1;
+	MaxTargetsNumber = 5;
+	MinModeTime = 3.0f;
+	MaxModeTime = 8.0f;
+	ParallelThreshold = 32;
+	PromotionDistance = 3500.0f;
+	DemotionDistance = 5000.0f;
+	PromotionCheckInterval = 0.25f;
+	MaxPromotedCrows = 24;
+	MaxPromotionsPerCheck = 4;
+	ProxyWalkingSpeed = 150.0f;
+	ProxyFlyingSpeed = 300.0f;
+	bIsApplying = false;
+	bHasRemovedCrows = false;
+	SecondsToPromotionCheck = 0.0f;
+	ProxyCrowsNumber = 0;
+	PendingPromotionsNumber = 0;
+	PromotionsNumber = 0;
+	DemotionsNumber = 0;
+	bIsSoakRunning = false;
+	SoakSecondsLeft = 0.0f;
+	SoakFramesNumber = 0;
+	SoakBehaviorMs = 0.0;
+	SoakMaxBehaviorMs = 0.0;
+	SoakPromotionChecksNumber = 0;
+	SoakPromotionMs = 0.0;
+	SoakMaxPromotionMs = 0.0;
+	SoakStartPromotionsNumber = 0;
+	SoakStartDemotionsNumber = 0;
+}
+
+void UCPP_CrowSimulation::Deinitialize()
+{
+	for (int32 i = Controllers.Num() - 1; i >= 0; i--)
+	{
+		RemoveCrowAt(i);
+	}
+	ProxyCrowsNumber = 0;
+	SET_DWORD_STAT(STAT_Cat_SimulatedCrows, 0);
+	SET_DWORD_STAT(STAT_Cat_ProxyCrows, 0);
+
+	Super::Deinitialize();
+}
+
+bool UCPP_CrowSimulation::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UCPP_CrowSimulation::IsTickable() const
+{
+	return Controllers.Num() > 0;
+}
+
+TStatId UCPP_CrowSimulation::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCPP_CrowSimulation, STATGROUP_Tickables);
+}
+
+void UCPP_CrowSimulation::Tick(float DeltaTime)
+{
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_EnemyBehavior);
+
+	Super::Tick(DeltaTime);
+
+	const double TickStartTime = FPlatformTime::Seconds();
+
+	// Killed crows and proxies of the removed platforms.
+	for (int32 i = Controllers.Num() - 1; i >= 0; i--)
+	{
+		if (IsProxies[i] ? !IsValid(Platforms[i]) : (!IsValid(Controllers[i]) || !IsValid(Crows[i])))
+		{
+			RemoveCrowAt(i);
+		}
+	}
+	const int32 CrowsNumber = Controllers.Num();
+	SET_DWORD_STAT(STAT_Cat_SimulatedCrows, CrowsNumber);
+	if (CrowsNumber == 0)
+	{
+		if (bIsSoakRunning)
+		{
+			FinishSoak();
+		}
+		return;
+	}
+
+	GatherInput();
+
+	const bool bIsParallel = CVarCrowSimulationParallel.GetValueOnGameThread() &&
+		CrowsNumber >= ParallelThreshold;
+	ParallelFor(CrowsNumber, [this, DeltaTime](const int32 Index)
+	{
+		StepCrow(Index, DeltaTime);
+	}, !bIsParallel);
+
+	ApplyResults();
+
+	SecondsToPromotionCheck -= DeltaTime;
+	if (SecondsToPromotionCheck <= 0.0f)
+	{
+		SecondsToPromotionCheck = PromotionCheckInterval;
+		const double PromotionStartTime = FPlatformTime::Seconds();
+		UpdatePromotion();
+		if (bIsSoakRunning)
+		{
+			const double PromotionMs = (FPlatformTime::Seconds() - PromotionStartTime) * 1000.0;
+			SoakPromotionChecksNumber++;
+			SoakPromotionMs += PromotionMs;
+			SoakMaxPromotionMs = FMath::Max(SoakMaxPromotionMs, PromotionMs);
+		}
+	}
+
+	if (bIsSoakRunning)
+	{
+		UpdateSoak(DeltaTime, (FPlatformTime::Seconds() - TickStartTime) * 1000.0);
+	}
+}
+
+void UCPP_CrowSimulation::RegisterCrow(ACPP_EnemyAIController* Controller, ACPP_EnemyCharacter* Crow)
+{
+	// The behavior is decided on the server only, the pawns
+	// replicate the results.
+	if (!IsValid(Controller) || !IsValid(Crow) || GetWorld()->GetNetMode() == NM_Client)
+		return;
+
+	// The promoted proxy is possessed while it's spawned.
+	if (const int32 Index = Crows.Find(Crow); Index != INDEX_NONE)
+	{
+		Controllers[Index] = Controller;
+		return;
+	}
+	if (const int32 Index = Controllers.Find(Controller); Index != INDEX_NONE)
+	{
+		Crows[Index] = Crow;
+		return;
+	}
+
+	const FVector HomeLocation = Crow->StartTransform.GetLocation();
+	Controllers.Add(Controller);
+	Crows.Add(Crow);
+	ChaseTargets.Add(nullptr);
+	Platforms.Add(nullptr);
+	CrowClasses.Add(nullptr);
+	IsProxies.Add(false);
+	IsSoakCrows.Add(false);
+	Positions.Add(Crow->GetActorLocation());
+	ChaseLocations.Add(FVector::ZeroVector);
+	States.Add(Crow->GetEnemyState());
+	InputFlags.Add(0);
+	HomeLocations.Add(HomeLocation);
+	HomeRotations.Add(Crow->StartTransform.Rotator());
+	TargetLocations.Add(HomeLocation);
+	TargetsCounters.Add(0);
+	MaxTargets.Add(0);
+	ModeTimers.Add(0.0f);
+	StateFlags.Add(0);
+	RandomStreams.Add(FRandomStream(FMath::Rand()));
+	MoveInputs.Add(FVector::ZeroVector);
+	Commands.Add(0);
+	NewStates.Add(Crow->GetEnemyState());
+	SET_DWORD_STAT(STAT_Cat_SimulatedCrows, Controllers.Num());
+}
+
+void UCPP_CrowSimulation::UnregisterCrow(const ACPP_EnemyAIController* Controller)
+{
+	const int32 Index = Controllers.Find(const_cast<ACPP_EnemyAIController*>(Controller));
+	if (Index == INDEX_NONE)
+		return;
+
+	// The crow can be destroyed while its results are
+	// written back, so the arrays are compacted afterwards.
+	if (bIsApplying)
+	{
+		Controllers[Index] = nullptr;
+		Crows[Index] = nullptr;
+		ChaseTargets[Index] = nullptr;
+		bHasRemovedCrows = true;
+	}
+	else
+	{
+		RemoveCrowAt(Index);
+		SET_DWORD_STAT(STAT_Cat_SimulatedCrows, Controllers.Num());
+	}
+}
+
+void UCPP_CrowSimulation::SpawnProxyCrow(ACPP_PlatformWithNPC* Platform,
+                                         const TSubclassOf<ACPP_EnemyCharacter> CrowClass,
+                                         const FTransform& Transform)
+{
+	if (!IsValid(Platform) || CrowClass.Get() == nullptr || GetWorld()->GetNetMode() == NM_Client)
+		return;
+
+	Controllers.Add(nullptr);
+	Crows.Add(nullptr);
+	ChaseTargets.Add(nullptr);
+	Platforms.Add(Platform);
+	CrowClasses.Add(CrowClass);
+	IsProxies.Add(true);
+	IsSoakCrows.Add(false);
+	Positions.Add(Transform.GetLocation());
+	ChaseLocations.Add(FVector::ZeroVector);
+	States.Add(EEnemyState::Walking);
+	InputFlags.Add(0);
+	HomeLocations.Add(Transform.GetLocation());
+	HomeRotations.Add(Transform.Rotator());
+	TargetLocations.Add(Transform.GetLocation());
+	TargetsCounters.Add(0);
+	MaxTargets.Add(0);
+	ModeTimers.Add(0.0f);
+	StateFlags.Add(0);
+	RandomStreams.Add(FRandomStream(FMath::Rand()));
+	MoveInputs.Add(FVector::ZeroVector);
+	Commands.Add(0);
+	NewStates.Add(EEnemyState::Walking);
+
+	ProxyCrowsNumber++;
+	SET_DWORD_STAT(STAT_Cat_SimulatedCrows, Controllers.Num());
+	SET_DWORD_STAT(STAT_Cat_ProxyCrows, ProxyCrowsNumber);
+
+	// The player can already be near the new crow.
+	SecondsToPromotionCheck = FMath::Min(SecondsToPromotionCheck, 0.0f);
+}
+
+void UCPP_CrowSimulation::PrintSwarmReport() const
+{
+	UE_LOG(LogTemp, Log, TEXT("Crow swarm: %d crows simulated, %d proxies, %d promotions, %d demotions."),
+	       Controllers.Num(), ProxyCrowsNumber, PromotionsNumber, DemotionsNumber);
+}
+
+void UCPP_CrowSimulation::StartSoak(const int32 ProxiesNumber, const float Seconds)
+{
+	if (bIsSoakRunning || ProxiesNumber <= 0 || Seconds <= 0.0f || GetWorld()->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Crow swarm soak: can't be started (it is running, the arguments are wrong ")
+		       TEXT("or this is a client)."));
+		return;
+	}
+
+	// The soak crows are copies of any swarm crow, because
+	// the proxy needs the crow class and the living platform.
+	const int32 TemplateIndex = CrowClasses.IndexOfByPredicate([](const TSubclassOf<ACPP_EnemyCharacter>& Class)
+	{
+		return Class.Get() != nullptr;
+	});
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (TemplateIndex == INDEX_NONE || !IsValid(Platforms[TemplateIndex]) ||
+		!IsValid(PlayerController) || !IsValid(PlayerController->GetPawn()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Crow swarm soak: needs a swarm crow on the level and a player's pawn."));
+		return;
+	}
+
+	// The proxies are spread both inside and outside the
+	// promotion distance, so promotions and demotions happen
+	// while the players move. The fixed seed makes the runs
+	// comparable.
+	const FVector Center = PlayerController->GetPawn()->GetActorLocation();
+	FRandomStream Stream(2024);
+	for (int32 i = 0; i < ProxiesNumber; i++)
+	{
+		const float Angle = Stream.FRandRange(0.0f, UE_TWO_PI);
+		const float Distance = DemotionDistance * 1.5f * FMath::Sqrt(Stream.FRand());
+		const FVector Location = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * Distance;
+		SpawnProxyCrow(Platforms[TemplateIndex], CrowClasses[TemplateIndex],
+		               FTransform(FRotator(0.0f, Stream.FRandRange(-180.0f, 180.0f), 0.0f), Location));
+		IsSoakCrows.Last() = true;
+	}
+
+	bIsSoakRunning = true;
+	SoakSecondsLeft = Seconds;
+	SoakFramesNumber = 0;
+	SoakBehaviorMs = 0.0;
+	SoakMaxBehaviorMs = 0.0;
+	SoakPromotionChecksNumber = 0;
+	SoakPromotionMs = 0.0;
+	SoakMaxPromotionMs = 0.0;
+	SoakStartPromotionsNumber = PromotionsNumber;
+	SoakStartDemotionsNumber = DemotionsNumber;
+	UE_LOG(LogTemp, Warning, TEXT("Crow swarm soak: %d proxies were spawned, %d crows are simulated, %.0f s."),
+	       ProxiesNumber, Controllers.Num(), Seconds);
+}
+
+void UCPP_CrowSimulation::UpdateSoak(const float DeltaTime, const double BehaviorMs)
+{
+	SoakFramesNumber++;
+	SoakBehaviorMs += BehaviorMs;
+	SoakMaxBehaviorMs = FMath::Max(SoakMaxBehaviorMs, BehaviorMs);
+
+	SoakSecondsLeft -= DeltaTime;
+	if (SoakSecondsLeft <= 0.0f)
+	{
+		FinishSoak();
+	}
+}
+
+void UCPP_CrowSimulation::FinishSoak()
+{
+	bIsSoakRunning = false;
+
+	UE_LOG(LogTemp, Warning, TEXT("Crow swarm soak: %d crows simulated, %d proxies, %d frames."),
+	       Controllers.Num(), ProxyCrowsNumber, SoakFramesNumber);
+	UE_LOG(LogTemp, Warning, TEXT("  Enemy Behavior Update: %.3f ms average, %.3f ms max."),
+	       SoakFramesNumber > 0 ? SoakBehaviorMs / SoakFramesNumber : 0.0, SoakMaxBehaviorMs);
+	UE_LOG(LogTemp, Warning, TEXT("  Crow Promotion: %d checks, %.3f ms average, %.3f ms max."),
+	       SoakPromotionChecksNumber,
+	       SoakPromotionChecksNumber > 0 ? SoakPromotionMs / SoakPromotionChecksNumber : 0.0,
+	       SoakMaxPromotionMs);
+	UE_LOG(LogTemp, Warning, TEXT("  %d promotions, %d demotions."),
+	       PromotionsNumber - SoakStartPromotionsNumber, DemotionsNumber - SoakStartDemotionsNumber);
+
+	// The entries are removed before their actors are
+	// destroyed, so UnregisterCrow doesn't find them.
+	for (int32 i = Controllers.Num() - 1; i >= 0; i--)
+	{
+		if (!IsSoakCrows[i])
+			continue;
+
+		ACPP_EnemyCharacter* Crow = Crows[i];
+		ACPP_EnemyAIController* Controller = Controllers[i];
+		RemoveCrowAt(i);
+		if (IsValid(Crow))
+		{
+			Crow->Destroy();
+		}
+		if (IsValid(Controller))
+		{
+			Controller->Destroy();
+		}
+	}
+	SET_DWORD_STAT(STAT_Cat_SimulatedCrows, Controllers.Num());
+	SET_DWORD_STAT(STAT_Cat_ProxyCrows, ProxyCrowsNumber);
+}
+
+void UCPP_CrowSimulation::GatherInput()
+{
+	for (int32 i = 0; i < Controllers.Num(); i++)
+	{
+		if (IsProxies[i])
+			continue;
+
+		const ACPP_EnemyCharacter* Crow = Crows[i];
+		Positions[i] = Crow->GetActorLocation();
+		States[i] = Crow->GetEnemyState();
+
+		uint8 Flags = 0;
+		ChaseTargets[i] = Controllers[i]->UpdateCharacterToChase();
+		if (IsValid(ChaseTargets[i]))
+		{
+			ChaseLocations[i] = ChaseTargets[i]->GetActorLocation();
+			Flags |= Input_HasChaseTarget;
+		}
+		if (Crow->bIsAttacking)
+		{
+			Flags |= Input_IsAttacking;
+		}
+		if (Crow->GetCharacterMovement()->MovementMode == MOVE_Falling)
+		{
+			Flags |= Input_IsFalling;
+		}
+		InputFlags[i] = Flags;
+	}
+}
+
+void UCPP_CrowSimulation::StepCrow(const int32 Index, const float DeltaSeconds)
+{
+	const FVector Position = Positions[Index];
+	const uint8 Input = InputFlags[Index];
+	uint8& Flags = StateFlags[Index];
+	uint8& Command = Commands[Index];
+	FVector& MoveInput = MoveInputs[Index];
+	EEnemyState& NewState = NewStates[Index];
+
+	Command = 0;
+	MoveInput = FVector::ZeroVector;
+	NewState = States[Index];
+
+	switch (States[Index])
+	{
+	case EEnemyState::Walking:
+	case EEnemyState::Flying:
+		{
+			const bool bIsFlying = States[Index] == EEnemyState::Flying;
+			if (MaxTargets[Index] == 0 || bIsFlying != ((Flags & State_IsFlyingMode) != 0))
+			{
+				// The mode has just started.
+				Flags = bIsFlying ? static_cast<uint8>(State_IsFlyingMode) : 0;
+				Command |= bIsFlying ? Command_BasicFlyingSpeed : Command_BasicWalkingSpeed;
+				TargetsCounters[Index] = 0;
+				MaxTargets[Index] = static_cast<uint8>(
+					RandomStreams[Index].RandRange(MinTargetsNumber, MaxTargetsNumber));
+				ModeTimers[Index] = RandomStreams[Index].FRandRange(MinModeTime, MaxModeTime);
+			}
+
+			if ((Flags & State_TargetReached) || !(Flags & State_TargetIsSet))
+			{
+				const FVector Home = HomeLocations[Index];
+				FVector Origin = Home;
+				FVector Extent(WalkingSearchRadius, WalkingSearchRadius, 0.001f);
+				if (bIsFlying)
+				{
+					Origin.Z = (FlyingMaxHeight - Home.Z) / 2 + 20.0f;
+					Extent = FVector(FlyingSearchRadius, FlyingSearchRadius, (FlyingMaxHeight - Home.Z) / 2);
+				}
+				FRandomStream& Stream = RandomStreams[Index];
+				TargetLocations[Index] = Origin + FVector(Stream.FRandRange(-Extent.X, Extent.X),
+				                                          Stream.FRandRange(-Extent.Y, Extent.Y),
+				                                          Stream.FRandRange(-Extent.Z, Extent.Z));
+				TargetsCounters[Index]++;
+				Flags |= State_TargetIsSet;
+				Flags &= ~State_TargetReached;
+				if (!bIsFlying)
+				{
+					Command |= Command_SetWalkingMovement;
+				}
+			}
+
+			ModeTimers[Index] -= DeltaSeconds;
+			if (TargetsCounters[Index] > MaxTargets[Index] || ModeTimers[Index] <= 0.0f)
+			{
+				MaxTargets[Index] = 0;
+				Flags &= ~(State_TargetIsSet | State_TargetReached);
+				NewState = bIsFlying ? EEnemyState::Walking : EEnemyState::Flying;
+			}
+			else if (bIsFlying || !(Input & Input_IsFalling))
+			{
+				const FVector& Target = TargetLocations[Index];
+				if (Position.Equals(Target, bIsFlying ? FlyingTolerance : WalkingTolerance))
+				{
+					Flags |= State_TargetReached;
+				}
+				else
+				{
+					Flags &= ~State_TargetReached;
+					MoveInput = (Target - Position).GetSafeNormal() * DeltaSeconds;
+					if (!bIsFlying)
+					{
+						MoveInput.Z = 0;
+					}
+				}
+			}
+			break;
+		}
+	case EEnemyState::ChasingCharacter:
+		{
+			if (!(Flags & State_IsChasing))
+			{
+				// The chase is performed in the mode that was active
+				// before it.
+				const bool bIsFlyingChasing = (Flags & State_IsFlyingMode) != 0;
+				Command |= bIsFlyingChasing ? Command_ChasingFlyingSpeed : Command_ChasingWalkingSpeed;
+				Flags = static_cast<uint8>(State_IsChasing | (bIsFlyingChasing ? State_IsFlyingChasing : 0));
+				TargetsCounters[Index] = 0;
+				MaxTargets[Index] = 0;
+			}
+
+			const bool bIsFlyingChasing = (Flags & State_IsFlyingChasing) != 0;
+			if (!(Input & Input_HasChaseTarget))
+			{
+				Flags &= ~State_IsChasing;
+				NewState = bIsFlyingChasing ? EEnemyState::Flying : EEnemyState::Walking;
+			}
+			else if (Position.Equals(ChaseLocations[Index], ChasingTolerance))
+			{
+				NewState = EEnemyState::Attacking;
+			}
+			else
+			{
+				MoveInput = (ChaseLocations[Index] - Position).GetSafeNormal() * DeltaSeconds;
+				if (!bIsFlyingChasing)
+				{
+					MoveInput.Z = 0;
+				}
+			}
+			break;
+		}
+	case EEnemyState::Attacking:
+		{
+			if (!(Input & Input_HasChaseTarget))
+			{
+				Flags &= ~State_IsChasing;
+				NewState = (Flags & State_IsFlyingChasing) ? EEnemyState::Flying : EEnemyState::Walking;
+			}
+			else if (!(Input & Input_IsAttacking))
+			{
+				Command |= Command_Attack;
+			}
+			else
+			{
+				NewState = EEnemyState::ChasingCharacter;
+			}
+			break;
+		}
+	case EEnemyState::Dying:
+		break;
+	}
+
+	// Proxies have no physics, so they are moved straight to
+	// the target and keep their state themselves.
+	if (IsProxies[Index])
+	{
+		if (!MoveInput.IsZero())
+		{
+			const float Speed = States[Index] == EEnemyState::Flying ? ProxyFlyingSpeed : ProxyWalkingSpeed;
+			Positions[Index] = Position + (TargetLocations[Index] - Position).GetClampedToMaxSize(
+				Speed * DeltaSeconds);
+			MoveInput = FVector::ZeroVector;
+		}
+		States[Index] = NewState;
+		Command = 0;
+	}
+}
+
+void UCPP_CrowSimulation::ApplyResults()
+{
+	bIsApplying = true;
+	const int32 CrowsNumber = Controllers.Num();
+	for (int32 i = 0; i < CrowsNumber; i++)
+	{
+		ACPP_EnemyCharacter* Crow = Crows[i];
+		if (!IsValid(Crow))
+			continue;
+
+		const uint8 Command = Commands[i];
+		if (Command & Command_BasicWalkingSpeed)
+		{
+			Crow->ChangeWalkingSpeed(true);
+		}
+		else if (Command & Command_ChasingWalkingSpeed)
+		{
+			Crow->ChangeWalkingSpeed(false);
+		}
+		if (Command & Command_BasicFlyingSpeed)
+		{
+			Crow->ChangeFlyingSpeed(true);
+		}
+		else if (Command & Command_ChasingFlyingSpeed)
+		{
+			Crow->ChangeFlyingSpeed(false);
+		}
+		if (Command & Command_SetWalkingMovement)
+		{
+			Crow->GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+		}
+		if (!MoveInputs[i].IsZero())
+		{
+			Crow->AddMovementInput(MoveInputs[i]);
+		}
+		if (Command & Command_Attack)
+		{
+			Crow->Server_Attack(ChaseTargets[i]);
+		}
+		if (NewStates[i] != States[i])
+		{
+			Crow->SetEnemyState(NewStates[i]);
+		}
+	}
+	bIsApplying = false;
+
+	if (bHasRemovedCrows)
+	{
+		bHasRemovedCrows = false;
+		for (int32 i = Controllers.Num() - 1; i >= 0; i--)
+		{
+			if (!IsProxies[i] && Controllers[i] == nullptr)
+			{
+				RemoveCrowAt(i);
+			}
+		}
+		SET_DWORD_STAT(STAT_Cat_SimulatedCrows, Controllers.Num());
+	}
+}
+
+void UCPP_CrowSimulation::UpdatePromotion()
+{
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CrowPromotion);
+
+	TArray<FVector> PlayerLocations{};
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get();
+			IsValid(PlayerController) && IsValid(PlayerController->GetPawn()))
+		{
+			PlayerLocations.Add(PlayerController->GetPawn()->GetActorLocation());
+		}
+	}
+	// Nothing is changed while the players are respawning
+	// or loading.
+	if (PlayerLocations.Num() == 0)
+		return;
+
+	const float PromotionDistanceSquared = FMath::Square(PromotionDistance);
+	const float DemotionDistanceSquared = FMath::Square(DemotionDistance);
+	TArray<TPair<float, int32>> Candidates{};
+	int32 PromotedNumber = 0;
+	for (int32 i = 0; i < Controllers.Num(); i++)
+	{
+		if (CrowClasses[i].Get() == nullptr)
+			continue;
+
+		const FVector Location = IsProxies[i] || !IsValid(Crows[i]) ? Positions[i] : Crows[i]->GetActorLocation();
+		float MinDistanceSquared = TNumericLimits<float>::Max();
+		for (const FVector& PlayerLocation : PlayerLocations)
+		{
+			MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(Location, PlayerLocation));
+		}
+
+		if (IsProxies[i])
+		{
+			if (MinDistanceSquared < PromotionDistanceSquared)
+			{
+				Candidates.Emplace(MinDistanceSquared, i);
+			}
+		}
+		else if (MinDistanceSquared > DemotionDistanceSquared && IsValid(Crows[i]) &&
+			(States[i] == EEnemyState::Walking || States[i] == EEnemyState::Flying))
+		{
+			DemoteCrow(i);
+		}
+		else
+		{
+			PromotedNumber++;
+		}
+	}
+
+	// The closest proxies are promoted first.
+	Candidates.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
+	{
+		return A.Key < B.Key;
+	});
+	int32 PromotionsThisCheck = 0;
+	for (const TPair<float, int32>& Candidate : Candidates)
+	{
+		if (PromotionsThisCheck >= MaxPromotionsPerCheck || PromotedNumber >= MaxPromotedCrows)
+			break;
+
+		if (PromoteCrow(Candidate.Value))
+		{
+			PromotionsThisCheck++;
+			PromotedNumber++;
+		}
+	}
+	PendingPromotionsNumber = Candidates.Num() - PromotionsThisCheck;
+	SET_DWORD_STAT(STAT_Cat_ProxyCrows, ProxyCrowsNumber);
+}
+
+bool UCPP_CrowSimulation::PromoteCrow(const int32 Index)
+{
+	ACPP_EnemyCharacter* Crow = GetWorld()->SpawnActorDeferred<ACPP_EnemyCharacter>(
+		CrowClasses[Index],
+		FTransform::Identity,
+		nullptr,
+		nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if (!IsValid(Crow))
+		return false;
+
+	Crow->StartTransform = FTransform(HomeRotations[Index], HomeLocations[Index]);
+	Crows[Index] = Crow;
+	UGameplayStatics::FinishSpawningActor(Crow, FTransform(HomeRotations[Index], Positions[Index]));
+
+	// RegisterCrow sets the controller during the spawning.
+	if (!IsValid(Controllers[Index]))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("The promoted crow %s wasn't possessed by the enemy AI controller."),
+		       *Crow->GetName());
+		Crows[Index] = nullptr;
+		Crow->Destroy();
+		return false;
+	}
+
+	IsProxies[Index] = false;
+	ProxyCrowsNumber--;
+	PromotionsNumber++;
+	if (States[Index] == EEnemyState::Flying)
+	{
+		Crow->SetEnemyState(EEnemyState::Flying);
+	}
+	if (IsValid(Platforms[Index]) && !IsSoakCrows[Index])
+	{
+		Platforms[Index]->SetEnemy(Crow);
+	}
+	return true;
+}
+
+void UCPP_CrowSimulation::DemoteCrow(const int32 Index)
+{
+	ACPP_EnemyCharacter* Crow = Crows[Index];
+	ACPP_EnemyAIController* Controller = Controllers[Index];
+	Positions[Index] = Crow->GetActorLocation();
+
+	// The entry is detached first, so UnregisterCrow
+	// doesn't remove it while the actors are destroyed.
+	Controllers[Index] = nullptr;
+	Crows[Index] = nullptr;
+	ChaseTargets[Index] = nullptr;
+	IsProxies[Index] = true;
+	ProxyCrowsNumber++;
+	DemotionsNumber++;
+	if (IsValid(Platforms[Index]) && !IsSoakCrows[Index])
+	{
+		Platforms[Index]->SetEnemy(nullptr);
+	}
+
+	// The proxy doesn't gather input, so the last frame's
+	// flags and the chase state of the actor are cleared
+	// (otherwise the proxy would keep "chasing").
+	InputFlags[Index] = 0;
+	StateFlags[Index] &= ~(State_IsChasing | State_IsFlyingChasing);
+	MoveInputs[Index] = FVector::ZeroVector;
+	Commands[Index] = 0;
+	NewStates[Index] = States[Index];
+
+	Crow->Destroy();
+	if (IsValid(Controller))
+	{
+		Controller->Destroy();
+	}
+}
+
+void UCPP_CrowSimulation::RemoveCrowAt(const int32 Index)
+{
+	if (IsProxies[Index])
+	{
+		ProxyCrowsNumber--;
+	}
+	Controllers.RemoveAtSwap(Index);
+	Crows.RemoveAtSwap(Index);
+	ChaseTargets.RemoveAtSwap(Index);
+	Platforms.RemoveAtSwap(Index);
+	CrowClasses.RemoveAtSwap(Index);
+	IsProxies.RemoveAtSwap(Index);
+	IsSoakCrows.RemoveAtSwap(Index);
+	Positions.RemoveAtSwap(Index);
+	ChaseLocations.RemoveAtSwap(Index);
+	States.RemoveAtSwap(Index);
+	InputFlags.RemoveAtSwap(Index);
+	HomeLocations.RemoveAtSwap(Index);
+	HomeRotations.RemoveAtSwap(Index);
+	TargetLocations.RemoveAtSwap(Index);
+	TargetsCounters.RemoveAtSwap(Index);
+	MaxTargets.RemoveAtSwap(Index);
+	ModeTimers.RemoveAtSwap(Index);
+	StateFlags.RemoveAtSwap(Index);
+	RandomStreams.RemoveAtSwap(Index);
+	MoveInputs.RemoveAtSwap(Index);
+	Commands.RemoveAtSwap(Index);
+	NewStates.RemoveAtSwap(Index);
+}
\ No newline at end of file
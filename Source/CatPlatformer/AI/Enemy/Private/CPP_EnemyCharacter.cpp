@@ -5,15 +5,62 @@
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Net/UnrealNetwork.h"
+#include "Animation/AnimSequence.h"
+#include "UObject/ConstructorHelpers.h"
+
+#ifndef CPP_CROWANIMATIONSHARING_H
+#define CPP_CROWANIMATIONSHARING_H
+#include "CatPlatformer/Animation/Classes/CPP_CrowAnimationSharing.h"
+#endif
+
+#ifndef CPP_SIGNIFICANCEMANAGER_H
+#define CPP_SIGNIFICANCEMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_SignificanceManager.h"
+#endif
 
 ACPP_EnemyCharacter::ACPP_EnemyCharacter(): GameStateRef(nullptr), EnemyState(EEnemyState::Walking),
                                             BasicFlyingSpeed(0), ChasingFlyingSpeed(0),
                                             BasicWalkingSpeed(0), ChasingWalkingSpeed(0),
                                             PointsToAddToCharacter(20), bIsDead(false),
                                             bIsAttacking(false), AnimInstance(nullptr),
-                                            FlyingAttackMontage(nullptr)
+                                            FlyingAttackMontage(nullptr),
+                                            SharedWalkingAnimation(nullptr),
+                                            SharedFlyingAnimation(nullptr)
 {
 	PrimaryActorTick.bCanEverTick = true;
+
+	GetMesh()->bEnableUpdateRateOptimizations = true;
+	GetMesh()->OnAnimUpdateRateParamsCreated.BindStatic(&ACPP_EnemyCharacter::SetupAnimUpdateRate);
+
+	// Crows are the only enemies, so their loops are used by
+	// default.
+	static ConstructorHelpers::FObjectFinder<UAnimSequence> WalkingAnimation
+		(TEXT("/Game/CatPlatformer/AI/Crow/Animations/Sequences/ANIM_Crow_Walk"));
+	static ConstructorHelpers::FObjectFinder<UAnimSequence> FlyingAnimation
+		(TEXT("/Game/CatPlatformer/AI/Crow/Animations/Sequences/ANIM_Crow_Fly"));
+	if (WalkingAnimation.Succeeded())
+	{
+		SharedWalkingAnimation = WalkingAnimation.Object;
+	}
+	if (FlyingAnimation.Succeeded())
+	{
+		SharedFlyingAnimation = FlyingAnimation.Object;
+	}
+}
+
+void ACPP_EnemyCharacter::SetupAnimUpdateRate(FAnimUpdateRateParameters* Parameters)
+{
+	if (Parameters == nullptr)
+		return;
+
+	// Frames to skip for every LOD of the mesh.
+	Parameters->bShouldUseLodMap = true;
+	Parameters->LODToFrameSkipMap.Add(0, 0);
+	Parameters->LODToFrameSkipMap.Add(1, 1);
+	Parameters->LODToFrameSkipMap.Add(2, 2);
+	Parameters->LODToFrameSkipMap.Add(3, 4);
+	Parameters->MaxEvalRateForInterpolation = 4;
+	Parameters->BaseNonRenderedUpdateRate = 8;
 }
 
 void ACPP_EnemyCharacter::BeginPlay()
@@ -26,6 +73,17 @@ void ACPP_EnemyCharacter::BeginPlay()
 		AttackMontageEndedDelegate.BindUObject(this, &ACPP_EnemyCharacter::OnAttackMontageEnded);
 	}
 	GameStateRef = Cast<ACPP_GameState>(UGameplayStatics::GetGameState(GetWorld()));
+
+	if (UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+		IsValid(SignificanceManager))
+	{
+		SignificanceManager->RegisterActor(this);
+	}
+	if (UCPP_CrowAnimationSharing* AnimationSharing = GetWorld()->GetSubsystem<UCPP_CrowAnimationSharing>();
+		IsValid(AnimationSharing))
+	{
+		AnimationSharing->RegisterCrow(this);
+	}
 }
 
 void ACPP_EnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -34,6 +92,16 @@ void ACPP_EnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		AttackMontageEndedDelegate.Unbind();
 	}
+	if (UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+		IsValid(SignificanceManager))
+	{
+		SignificanceManager->UnregisterActor(this);
+	}
+	if (UCPP_CrowAnimationSharing* AnimationSharing = GetWorld()->GetSubsystem<UCPP_CrowAnimationSharing>();
+		IsValid(AnimationSharing))
+	{
+		AnimationSharing->UnregisterCrow(this);
+	}
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -122,6 +190,11 @@ void ACPP_EnemyCharacter::Multicast_Attack_Implementation(ACPP_Character* Charac
 	if (AnimInstance && FlyingAttackMontage &&
 		!AnimInstance->Montage_IsActive(FlyingAttackMontage))
 	{
+		if (UCPP_CrowAnimationSharing* AnimationSharing = GetWorld()->GetSubsystem<UCPP_CrowAnimationSharing>();
+			IsValid(AnimationSharing))
+		{
+			AnimationSharing->StopSharing(this);
+		}
 		bIsAttacking = true;
 		AnimInstance->Montage_Play(FlyingAttackMontage);
 		AnimInstance->Montage_SetEndDelegate(AttackMontageEndedDelegate, FlyingAttackMontage);
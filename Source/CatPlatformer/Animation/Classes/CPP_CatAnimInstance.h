@@ -0,0 +1,82 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef CPP_CHARACTERANIMINSTANCE_H
+#define CPP_CHARACTERANIMINSTANCE_H
+#include "CatPlatformer/Animation/Classes/CPP_CharacterAnimInstance.h"
+#endif
+class UCPP_CharacterAnimInstance;
+
+class ACPP_Character;
+
+#include "CPP_CatAnimInstance.generated.h"
+
+/**
+ * C++ parent class for the cat's animation blueprint.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_CatAnimInstance : public UCPP_CharacterAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	/** The constructor to set default variables. */
+	UCPP_CatAnimInstance();
+
+protected:
+	/** Function for caching the cat. */
+	virtual void NativeInitializeAnimation() override;
+
+	/**
+	 * Function for copying the cat's state. Is called on
+	 * the game thread.
+	 * @param DeltaSeconds Frame time.
+	 */
+	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+
+	/**
+	 * Function for computing the cat's animation variables.
+	 * Can be called on a worker thread.
+	 * @param DeltaSeconds Frame time.
+	 */
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+	/** Cat that owns the animation instance. */
+	UPROPERTY(Transient)
+	ACPP_Character* Cat;
+
+public:
+	/** Is the cat sprinting now? */
+	UPROPERTY(BlueprintReadOnly, Category = "Locomotion")
+	bool bIsSprinting;
+
+	/** Should the sprint animation be played? */
+	UPROPERTY(BlueprintReadOnly, Category = "Locomotion")
+	bool bShouldSprint;
+
+	/** Is the cat waiting for the player's input now? */
+	UPROPERTY(BlueprintReadOnly, Category = "Locomotion")
+	bool bIsWaiting;
+
+	/** Is the cat jumping now (set by the jump input)? */
+	UPROPERTY(BlueprintReadOnly, Category = "Air")
+	bool bIsJumping;
+
+	/** Is the cat attacking someone now? */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	bool bIsAttacking;
+
+	/** Is the cat receiving damage now? */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	bool bIsReceivingDamage;
+
+	/**
+	 * Is any action (attack or damage) playing, so the
+	 * locomotion should be blended out?
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	bool bIsBusy;
+};
\ No newline at end of file
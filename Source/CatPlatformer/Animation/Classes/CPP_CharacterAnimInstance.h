@@ -0,0 +1,120 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+
+class ACharacter;
+class UCharacterMovementComponent;
+
+#include "CPP_CharacterAnimInstance.generated.h"
+
+/**
+ * C++ parent class for the characters' animation instances.
+ * The owner's data is copied on the game thread (in
+ * NativeUpdateAnimation) and all locomotion and air
+ * variables are computed in NativeThreadSafeUpdateAnimation,
+ * so the animation graph can run on the fast path and on
+ * worker threads.
+ */
+UCLASS(Abstract)
+class CATPLATFORMER_API UCPP_CharacterAnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	/** The constructor to set default variables. */
+	UCPP_CharacterAnimInstance();
+
+protected:
+	/** Function for caching the owner and its components. */
+	virtual void NativeInitializeAnimation() override;
+
+	/**
+	 * Function for copying the owner's data. Is called on
+	 * the game thread.
+	 * @param DeltaSeconds Frame time.
+	 */
+	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+
+	/**
+	 * Function for computing the animation variables. Can
+	 * be called on a worker thread, so it uses only the
+	 * copied data.
+	 * @param DeltaSeconds Frame time.
+	 */
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+	/** Owner of the animation instance. */
+	UPROPERTY(Transient)
+	ACharacter* OwnerCharacter;
+
+	/** Movement component of the owner. */
+	UPROPERTY(Transient)
+	UCharacterMovementComponent* MovementComponent;
+
+public:
+	//=====================Locomotion==============================
+
+	/** Owner's velocity. */
+	UPROPERTY(BlueprintReadOnly, Category = "Locomotion")
+	FVector Velocity;
+
+	/** Owner's speed in the horizontal plane. */
+	UPROPERTY(BlueprintReadOnly, Category = "Locomotion")
+	float GroundSpeed;
+
+	/**
+	 * Angle between the velocity and the owner's forward
+	 * vector (from -180 to 180 degrees).
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Locomotion")
+	float Direction;
+
+	/** Should the movement animation be played? */
+	UPROPERTY(BlueprintReadOnly, Category = "Locomotion")
+	bool bShouldMove;
+
+	//=====================Air=====================================
+
+	/** Is the owner jumping or falling now? */
+	UPROPERTY(BlueprintReadOnly, Category = "Air")
+	bool bIsInAir;
+
+	/**
+	 * Is the owner falling down (not rising) now? Isn't
+	 * named bIsFalling, because the animation blueprints
+	 * use that name for the whole time in the air.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Air")
+	bool bIsDescending;
+
+	/** Owner's vertical speed. */
+	UPROPERTY(BlueprintReadOnly, Category = "Air")
+	float VerticalSpeed;
+
+	/** Is the owner flying now? */
+	UPROPERTY(BlueprintReadOnly, Category = "Air")
+	bool bIsFlying;
+
+protected:
+	/**
+	 * Minimum ground speed at which the movement animation
+	 * is played.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Locomotion")
+	float MinMovingSpeed;
+
+private:
+	//=====================Copied data=============================
+
+	/** Owner's rotation. */
+	FRotator OwnerRotation;
+
+	/** Owner's current acceleration. */
+	FVector Acceleration;
+
+	/** Owner's movement mode. */
+	TEnumAsByte<EMovementMode> MovementMode;
+};
\ No newline at end of file
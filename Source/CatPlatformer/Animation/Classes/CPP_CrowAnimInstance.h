@@ -0,0 +1,76 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef CPP_CHARACTERANIMINSTANCE_H
+#define CPP_CHARACTERANIMINSTANCE_H
+#include "CatPlatformer/Animation/Classes/CPP_CharacterAnimInstance.h"
+#endif
+class UCPP_CharacterAnimInstance;
+
+#ifndef CPP_ENEMYCHARACTER_H
+#define CPP_ENEMYCHARACTER_H
+#include "CatPlatformer/AI/Enemy/Classes/CPP_EnemyCharacter.h"
+#endif
+class ACPP_EnemyCharacter;
+
+#include "CPP_CrowAnimInstance.generated.h"
+
+/**
+ * C++ parent class for the crow's (enemy's) animation
+ * blueprint.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_CrowAnimInstance : public UCPP_CharacterAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	/** The constructor to set default variables. */
+	UCPP_CrowAnimInstance();
+
+protected:
+	/** Function for caching the crow. */
+	virtual void NativeInitializeAnimation() override;
+
+	/**
+	 * Function for copying the crow's state. Is called on
+	 * the game thread.
+	 * @param DeltaSeconds Frame time.
+	 */
+	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+
+	/**
+	 * Function for computing the crow's animation variables.
+	 * Can be called on a worker thread.
+	 * @param DeltaSeconds Frame time.
+	 */
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+	/** Crow that owns the animation instance. */
+	UPROPERTY(Transient)
+	ACPP_EnemyCharacter* Crow;
+
+public:
+	/** Current crow's state. */
+	UPROPERTY(BlueprintReadOnly, Category = "Enemy")
+	EEnemyState EnemyState;
+
+	/** Is the crow chasing a player now? */
+	UPROPERTY(BlueprintReadOnly, Category = "Enemy")
+	bool bIsChasing;
+
+	/** Should the flapping animation be played? */
+	UPROPERTY(BlueprintReadOnly, Category = "Air")
+	bool bShouldFlap;
+
+	/** Is the crow attacking someone now? */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	bool bIsAttacking;
+
+	/** Is the crow dead (or dying) now? */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	bool bIsDead;
+};
\ No newline at end of file
@@ -0,0 +1,158 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+class ACPP_EnemyCharacter;
+class USkeletalMesh;
+class USkeletalMeshComponent;
+class UAnimSequence;
+
+#include "CPP_CrowAnimationSharing.generated.h"
+
+/** Structure for storing one leader pose. */
+USTRUCT()
+struct FCrowPoseLeader
+{
+	GENERATED_BODY()
+
+	/** Component that evaluates the shared animation. */
+	UPROPERTY()
+	USkeletalMeshComponent* Component = nullptr;
+
+	/** Skeletal mesh of the leader and its followers. */
+	UPROPERTY()
+	USkeletalMesh* Mesh = nullptr;
+
+	/** Looped animation of the leader. */
+	UPROPERTY()
+	UAnimSequence* Animation = nullptr;
+
+	/** Phase (start offset) of the animation. */
+	int32 Phase = 0;
+
+	/** Number of crows that follow the leader. */
+	int32 FollowersNumber = 0;
+};
+
+/**
+ * Subsystem for sharing the evaluated poses between the
+ * crows. Crows that aren't significant (see the
+ * significance manager) and play one of the looped
+ * animations (walking or flying, also while chasing) copy
+ * the pose of a hidden leader mesh instead of evaluating
+ * their own animation graphs. There are a few leaders with
+ * different phases for every animation, so the crows don't
+ * move in sync. Crows that attack, die or play any montage
+ * use their own poses. Works on the machines that render
+ * the game only.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_CrowAnimationSharing : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Function for initializing the subsystem.
+	 * @param Collection Collection of subsystems.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Function for cleaning up the subsystem. */
+	virtual void Deinitialize() override;
+
+	/**
+	 * Function that is called every frame for choosing the
+	 * leaders of the crows.
+	 * @param DeltaTime Frame time.
+	 */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Should the subsystem be ticked now? */
+	virtual bool IsTickable() const override;
+
+	/** Stat ID of the subsystem's tick. */
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Function for limiting the subsystem to the game
+	 * worlds only.
+	 * @param WorldType Type of the world.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	/**
+	 * Function for registering the crow. Should be called
+	 * from the crow's BeginPlay.
+	 * @param Crow Crow to register.
+	 */
+	void RegisterCrow(ACPP_EnemyCharacter* Crow);
+
+	/**
+	 * Function for unregistering the crow and restoring
+	 * its own pose. Should be called from the crow's
+	 * EndPlay.
+	 * @param Crow Registered crow.
+	 */
+	void UnregisterCrow(ACPP_EnemyCharacter* Crow);
+
+	/**
+	 * Function for restoring the crow's own pose right now
+	 * (e.g. before playing a montage).
+	 * @param Crow Registered crow.
+	 */
+	void StopSharing(ACPP_EnemyCharacter* Crow);
+
+private:
+	/** Registered crows. */
+	UPROPERTY()
+	TArray<ACPP_EnemyCharacter*> Crows;
+
+	/**
+	 * Index of the leader of every crow (INDEX_NONE if the
+	 * crow uses its own pose).
+	 */
+	TArray<int32> LeaderIndices;
+
+	/** Created leaders. */
+	UPROPERTY()
+	TArray<FCrowPoseLeader> Leaders;
+
+	/** Hidden actor that owns the leaders' components. */
+	UPROPERTY()
+	AActor* LeadersOwner;
+
+	/** Number of leaders (phases) for every animation. */
+	int32 PhasesNumber;
+
+	/**
+	 * Should the crows with the high significance share
+	 * their poses too?
+	 */
+	bool bShareSignificantCrows;
+
+	/** Number of crows that follow any leader. */
+	int32 FollowersNumber;
+
+	/**
+	 * Function for finding (or creating) the leader.
+	 * @param Mesh Skeletal mesh of the crow.
+	 * @param Animation Looped animation to play.
+	 * @param Phase Phase of the animation.
+	 * @return Index of the leader or INDEX_NONE.
+	 */
+	int32 FindOrCreateLeader(USkeletalMesh* Mesh, UAnimSequence* Animation, const int32 Phase);
+
+	/**
+	 * Function for switching the crow to the leader.
+	 * @param Index Index of the crow.
+	 * @param NewLeaderIndex Index of the leader or
+	 * INDEX_NONE for the crow's own pose.
+	 */
+	void SetLeader(const int32 Index, const int32 NewLeaderIndex);
+};
\ No newline at end of file
@@ -0,0 +1,125 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#if WITH_EDITOR
+
+#include "Animation/AnimBlueprint.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+
+#ifndef CPP_CATANIMINSTANCE_H
+#define CPP_CATANIMINSTANCE_H
+#include "CatPlatformer/Animation/Classes/CPP_CatAnimInstance.h"
+#endif
+class UCPP_CatAnimInstance;
+
+#ifndef CPP_CROWANIMINSTANCE_H
+#define CPP_CROWANIMINSTANCE_H
+#include "CatPlatformer/Animation/Classes/CPP_CrowAnimInstance.h"
+#endif
+class UCPP_CrowAnimInstance;
+
+/**
+ * Function for reparenting the animation blueprint to the
+ * C++ animation instance. Blueprint variables that are
+ * computed by the new parent too are removed together with
+ * their setters, so the graphs read the parent's values
+ * (computed on a worker thread). Other variables whose
+ * names are taken by the parent are renamed.
+ * @param Path Path to the animation blueprint.
+ * @param NativeParent New parent class.
+ */
+static void MigrateAnimBlueprint(const TCHAR* Path, UClass* NativeParent)
+{
+	UAnimBlueprint* AnimBlueprint = LoadObject<UAnimBlueprint>(nullptr, Path);
+	if (!IsValid(AnimBlueprint) || !IsValid(NativeParent))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Anim blueprint migration: %s isn't found."), Path);
+		return;
+	}
+	if (AnimBlueprint->ParentClass == NativeParent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Anim blueprint migration: %s is already migrated."), Path);
+		return;
+	}
+
+	TArray<FName> VariableNames;
+	for (const FBPVariableDescription& Variable : AnimBlueprint->NewVariables)
+	{
+		VariableNames.Emplace(Variable.VarName);
+	}
+
+	for (const FName& VariableName : VariableNames)
+	{
+		const FProperty* NativeProperty = FindFProperty<FProperty>(NativeParent, VariableName);
+		if (!NativeProperty)
+			continue;
+
+		if (!NativeProperty->HasAnyPropertyFlags(CPF_BlueprintVisible))
+		{
+			FBlueprintEditorUtils::RenameMemberVariable(AnimBlueprint, VariableName,
+			                                            FName(VariableName.ToString() + TEXT("_BP")));
+			continue;
+		}
+
+		// The execution goes around the removed setters.
+		TArray<UK2Node_VariableSet*> Setters;
+		FBlueprintEditorUtils::GetAllNodesOfClass(AnimBlueprint, Setters);
+		for (UK2Node_VariableSet* Setter : Setters)
+		{
+			if (Setter->GetVarName() != VariableName)
+				continue;
+
+			UEdGraphPin* ExecPin = Setter->GetExecPin();
+			UEdGraphPin* ThenPin = Setter->GetThenPin();
+			if (ExecPin && ThenPin)
+			{
+				for (UEdGraphPin* FromPin : ExecPin->LinkedTo)
+				{
+					for (UEdGraphPin* ToPin : ThenPin->LinkedTo)
+					{
+						FromPin->MakeLinkTo(ToPin);
+					}
+				}
+			}
+			FBlueprintEditorUtils::RemoveNode(AnimBlueprint, Setter, true);
+		}
+
+		TArray<UK2Node_VariableGet*> Getters;
+		FBlueprintEditorUtils::GetAllNodesOfClass(AnimBlueprint, Getters);
+		for (UK2Node_VariableGet* Getter : Getters)
+		{
+			if (Getter->GetVarName() == VariableName)
+			{
+				Getter->VariableReference.SetSelfMember(VariableName);
+			}
+		}
+
+		// RemoveMemberVariable would remove the getters too.
+		AnimBlueprint->NewVariables.RemoveAt(
+			FBlueprintEditorUtils::FindNewVariableIndex(AnimBlueprint, VariableName));
+	}
+
+	AnimBlueprint->ParentClass = NativeParent;
+	FBlueprintEditorUtils::RefreshAllNodes(AnimBlueprint);
+	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(AnimBlueprint);
+	FKismetEditorUtilities::CompileBlueprint(AnimBlueprint);
+	AnimBlueprint->MarkPackageDirty();
+
+	UE_LOG(LogTemp, Warning, TEXT("Anim blueprint migration: %s is reparented to %s, save it."),
+	       Path, *NativeParent->GetName());
+}
+
+static FAutoConsoleCommand MigrateAnimBlueprintsCommand(
+	TEXT("Cat.MigrateAnimBlueprints"),
+	TEXT("Reparents the cat's and the crow's animation blueprints to the C++ animation instances (editor only)."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		MigrateAnimBlueprint(TEXT("/Game/CatPlatformer/Cat/Animations/Blueprints/ABP_CatCharacter.ABP_CatCharacter"),
+		                     UCPP_CatAnimInstance::StaticClass());
+		MigrateAnimBlueprint(TEXT("/Game/CatPlatformer/AI/Crow/Animations/ABP_Crow.ABP_Crow"),
+		                     UCPP_CrowAnimInstance::StaticClass());
+	}));
+
+#endif
@@ -0,0 +1,48 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_CatAnimInstance.h"
+
+#ifndef CPP_CHARACTER_H
+#define CPP_CHARACTER_H
+#include "CatPlatformer/GameMode/Classes/CPP_Character.h"
+#endif
+
+UCPP_CatAnimInstance::UCPP_CatAnimInstance(): Cat(nullptr),
+                                              bIsSprinting(false),
+                                              bShouldSprint(false),
+                                              bIsWaiting(false),
+                                              bIsJumping(false),
+                                              bIsAttacking(false),
+                                              bIsReceivingDamage(false),
+                                              bIsBusy(false)
+{
+}
+
+void UCPP_CatAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	Cat = Cast<ACPP_Character>(OwnerCharacter);
+}
+
+void UCPP_CatAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeUpdateAnimation(DeltaSeconds);
+
+	if (!IsValid(Cat))
+		return;
+
+	bIsSprinting = Cat->GetSprintNow();
+	bIsWaiting = Cat->bIsWaiting;
+	bIsJumping = Cat->bIsJumping;
+	bIsAttacking = Cat->bIsAttacking;
+	bIsReceivingDamage = Cat->bIsReceivingDamage;
+}
+
+void UCPP_CatAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	bShouldSprint = bIsSprinting && bShouldMove && !bIsInAir;
+	bIsBusy = bIsAttacking || bIsReceivingDamage;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_CharacterAnimInstance.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+UCPP_CharacterAnimInstance::UCPP_CharacterAnimInstance(): OwnerCharacter(nullptr),
+                                                          MovementComponent(nullptr),
+                                                          Velocity(FVector::ZeroVector),
+                                                          GroundSpeed(0.0f),
+                                                          Direction(0.0f),
+                                                          bShouldMove(false),
+                                                          bIsInAir(false),
+                                                          bIsDescending(false),
+                                                          VerticalSpeed(0.0f),
+                                                          bIsFlying(false),
+                                                          MinMovingSpeed(3.0f),
+                                                          OwnerRotation(FRotator::ZeroRotator),
+                                                          Acceleration(FVector::ZeroVector),
+                                                          MovementMode(MOVE_None)
+{
+}
+
+void UCPP_CharacterAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	OwnerCharacter = Cast<ACharacter>(TryGetPawnOwner());
+	MovementComponent = IsValid(OwnerCharacter) ? OwnerCharacter->GetCharacterMovement() : nullptr;
+}
+
+void UCPP_CharacterAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeUpdateAnimation(DeltaSeconds);
+
+	if (!IsValid(OwnerCharacter) || !IsValid(MovementComponent))
+		return;
+
+	Velocity = OwnerCharacter->GetVelocity();
+	OwnerRotation = OwnerCharacter->GetActorRotation();
+	Acceleration = MovementComponent->GetCurrentAcceleration();
+	MovementMode = MovementComponent->MovementMode;
+}
+
+void UCPP_CharacterAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	GroundSpeed = Velocity.Size2D();
+	VerticalSpeed = Velocity.Z;
+	bShouldMove = GroundSpeed > MinMovingSpeed && !Acceleration.IsNearlyZero();
+
+	Direction = 0.0f;
+	if (GroundSpeed > KINDA_SMALL_NUMBER)
+	{
+		Direction = FRotator::NormalizeAxis(Velocity.Rotation().Yaw - OwnerRotation.Yaw);
+	}
+
+	bIsInAir = MovementMode == MOVE_Falling;
+	bIsDescending = bIsInAir && VerticalSpeed < 0.0f;
+	bIsFlying = MovementMode == MOVE_Flying;
+}
\ No newline at end of file
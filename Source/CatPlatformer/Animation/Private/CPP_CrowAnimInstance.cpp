@@ -0,0 +1,40 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_CrowAnimInstance.h"
+
+UCPP_CrowAnimInstance::UCPP_CrowAnimInstance(): Crow(nullptr),
+                                                EnemyState(EEnemyState::Walking),
+                                                bIsChasing(false),
+                                                bShouldFlap(false),
+                                                bIsAttacking(false),
+                                                bIsDead(false)
+{
+}
+
+void UCPP_CrowAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	Crow = Cast<ACPP_EnemyCharacter>(OwnerCharacter);
+}
+
+void UCPP_CrowAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeUpdateAnimation(DeltaSeconds);
+
+	if (!IsValid(Crow))
+		return;
+
+	EnemyState = Crow->GetEnemyState();
+	bIsAttacking = Crow->bIsAttacking;
+	bIsDead = Crow->bIsDead;
+}
+
+void UCPP_CrowAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	bIsDead = bIsDead || EnemyState == EEnemyState::Dying;
+	bIsChasing = EnemyState == EEnemyState::ChasingCharacter || EnemyState == EEnemyState::Attacking;
+	bShouldFlap = !bIsDead && (bIsFlying || bIsInAir);
+}
\ No newline at end of file
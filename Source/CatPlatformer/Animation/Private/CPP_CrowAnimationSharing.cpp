@@ -0,0 +1,240 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_CrowAnimationSharing.h"
+#include "Animation/AnimSequence.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+#ifndef CPP_ENEMYCHARACTER_H
+#define CPP_ENEMYCHARACTER_H
+#include "CatPlatformer/AI/Enemy/Classes/CPP_EnemyCharacter.h"
+#endif
+
+#ifndef CPP_SIGNIFICANCEMANAGER_H
+#define CPP_SIGNIFICANCEMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_SignificanceManager.h"
+#endif
+
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+void UCPP_CrowAnimationSharing::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LeadersOwner = nullptr;
+	PhasesNumber = 3;
+	bShareSignificantCrows = false;
+	FollowersNumber = 0;
+}
+
+void UCPP_CrowAnimationSharing::Deinitialize()
+{
+	for (int32 i = 0; i < Crows.Num(); i++)
+	{
+		if (IsValid(Crows[i]) && LeaderIndices[i] != INDEX_NONE)
+		{
+			SetLeader(i, INDEX_NONE);
+		}
+	}
+	Crows.Empty();
+	LeaderIndices.Empty();
+	Leaders.Empty();
+	if (IsValid(LeadersOwner))
+	{
+		LeadersOwner->Destroy();
+	}
+	LeadersOwner = nullptr;
+	FollowersNumber = 0;
+	SET_DWORD_STAT(STAT_Cat_SharedCrowPoses, 0);
+	SET_DWORD_STAT(STAT_Cat_CrowPoseLeaders, 0);
+
+	Super::Deinitialize();
+}
+
+bool UCPP_CrowAnimationSharing::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UCPP_CrowAnimationSharing::IsTickable() const
+{
+	return Crows.Num() > 0;
+}
+
+TStatId UCPP_CrowAnimationSharing::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCPP_CrowAnimationSharing, STATGROUP_Tickables);
+}
+
+void UCPP_CrowAnimationSharing::Tick(float DeltaTime)
+{
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_AnimationSharing);
+
+	Super::Tick(DeltaTime);
+
+	const UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+	for (int32 i = Crows.Num() - 1; i >= 0; i--)
+	{
+		ACPP_EnemyCharacter* Crow = Crows[i];
+		if (!IsValid(Crow))
+		{
+			if (LeaderIndices[i] != INDEX_NONE)
+			{
+				FCrowPoseLeader& Leader = Leaders[LeaderIndices[i]];
+				Leader.FollowersNumber--;
+				FollowersNumber--;
+				if (Leader.FollowersNumber == 0 && IsValid(Leader.Component))
+				{
+					Leader.Component->SetComponentTickEnabled(false);
+				}
+			}
+			Crows.RemoveAtSwap(i);
+			LeaderIndices.RemoveAtSwap(i);
+			continue;
+		}
+
+		// Only the looped states can be shared, montages need
+		// the crow's own animation instance.
+		const EEnemyState State = Crow->GetEnemyState();
+		const UAnimInstance* AnimInstance = Crow->GetMesh()->GetAnimInstance();
+		const bool bCanShare = !Crow->bIsDead && !Crow->bIsAttacking &&
+			(State == EEnemyState::Walking || State == EEnemyState::Flying ||
+				State == EEnemyState::ChasingCharacter) &&
+			(!IsValid(AnimInstance) || !AnimInstance->IsAnyMontagePlaying()) &&
+			(bShareSignificantCrows || !IsValid(SignificanceManager) ||
+				SignificanceManager->GetSignificanceLevel(Crow) != ESignificanceLevel::High);
+
+		int32 NewLeaderIndex = INDEX_NONE;
+		if (bCanShare)
+		{
+			UAnimSequence* Animation = Crow->GetCharacterMovement()->MovementMode == MOVE_Flying
+				                           ? Crow->GetSharedFlyingAnimation()
+				                           : Crow->GetSharedWalkingAnimation();
+			USkeletalMesh* Mesh = Crow->GetMesh()->GetSkeletalMeshAsset();
+			if (IsValid(Animation) && IsValid(Mesh))
+			{
+				NewLeaderIndex = FindOrCreateLeader(Mesh, Animation, Crow->GetUniqueID() % PhasesNumber);
+			}
+		}
+		if (NewLeaderIndex != LeaderIndices[i])
+		{
+			SetLeader(i, NewLeaderIndex);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_Cat_SharedCrowPoses, FollowersNumber);
+	SET_DWORD_STAT(STAT_Cat_CrowPoseLeaders, Leaders.Num());
+}
+
+void UCPP_CrowAnimationSharing::RegisterCrow(ACPP_EnemyCharacter* Crow)
+{
+	// Nothing is rendered on the dedicated server.
+	if (!IsValid(Crow) || Crows.Contains(Crow) || GetWorld()->GetNetMode() == NM_DedicatedServer)
+		return;
+
+	Crows.Add(Crow);
+	LeaderIndices.Add(INDEX_NONE);
+}
+
+void UCPP_CrowAnimationSharing::UnregisterCrow(ACPP_EnemyCharacter* Crow)
+{
+	const int32 Index = Crows.Find(Crow);
+	if (Index == INDEX_NONE)
+		return;
+
+	if (LeaderIndices[Index] != INDEX_NONE)
+	{
+		SetLeader(Index, INDEX_NONE);
+	}
+	Crows.RemoveAtSwap(Index);
+	LeaderIndices.RemoveAtSwap(Index);
+}
+
+void UCPP_CrowAnimationSharing::StopSharing(ACPP_EnemyCharacter* Crow)
+{
+	if (const int32 Index = Crows.Find(Crow); Index != INDEX_NONE && LeaderIndices[Index] != INDEX_NONE)
+	{
+		SetLeader(Index, INDEX_NONE);
+	}
+}
+
+int32 UCPP_CrowAnimationSharing::FindOrCreateLeader(USkeletalMesh* Mesh, UAnimSequence* Animation,
+                                                    const int32 Phase)
+{
+	if (const int32 Index = Leaders.IndexOfByPredicate([Mesh, Animation, Phase](const FCrowPoseLeader& Leader)
+	{
+		return Leader.Mesh == Mesh && Leader.Animation == Animation && Leader.Phase == Phase;
+	}); Index != INDEX_NONE)
+	{
+		return IsValid(Leaders[Index].Component) ? Index : INDEX_NONE;
+	}
+
+	if (!IsValid(LeadersOwner))
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+		LeadersOwner = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+		if (!IsValid(LeadersOwner))
+			return INDEX_NONE;
+
+		LeadersOwner->SetActorHiddenInGame(true);
+	}
+
+	// The leader is never rendered, but its pose is
+	// evaluated while it has followers.
+	USkeletalMeshComponent* Component = NewObject<USkeletalMeshComponent>(LeadersOwner);
+	Component->SetSkeletalMeshAsset(Mesh);
+	Component->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetHiddenInGame(true);
+	Component->RegisterComponent();
+	Component->PlayAnimation(Animation, true);
+	Component->SetPosition(Animation->GetPlayLength() * Phase / FMath::Max(PhasesNumber, 1), false);
+	Component->SetComponentTickEnabled(false);
+
+	FCrowPoseLeader& Leader = Leaders.AddDefaulted_GetRef();
+	Leader.Component = Component;
+	Leader.Mesh = Mesh;
+	Leader.Animation = Animation;
+	Leader.Phase = Phase;
+	return Leaders.Num() - 1;
+}
+
+void UCPP_CrowAnimationSharing::SetLeader(const int32 Index, const int32 NewLeaderIndex)
+{
+	USkeletalMeshComponent* Mesh = Crows[Index]->GetMesh();
+	if (const int32 OldLeaderIndex = LeaderIndices[Index]; OldLeaderIndex != INDEX_NONE)
+	{
+		FCrowPoseLeader& OldLeader = Leaders[OldLeaderIndex];
+		OldLeader.FollowersNumber--;
+		FollowersNumber--;
+		if (OldLeader.FollowersNumber == 0 && IsValid(OldLeader.Component))
+		{
+			OldLeader.Component->SetComponentTickEnabled(false);
+		}
+	}
+	LeaderIndices[Index] = NewLeaderIndex;
+
+	if (NewLeaderIndex == INDEX_NONE)
+	{
+		Mesh->SetLeaderPoseComponent(nullptr);
+		Mesh->bPauseAnims = false;
+		return;
+	}
+
+	FCrowPoseLeader& NewLeader = Leaders[NewLeaderIndex];
+	if (NewLeader.FollowersNumber == 0)
+	{
+		NewLeader.Component->SetComponentTickEnabled(true);
+	}
+	NewLeader.FollowersNumber++;
+	FollowersNumber++;
+
+	// The follower's own graph isn't needed while it copies
+	// the leader's pose.
+	Mesh->bPauseAnims = true;
+	Mesh->SetLeaderPoseComponent(NewLeader.Component, true);
+}
\ No newline at end of file
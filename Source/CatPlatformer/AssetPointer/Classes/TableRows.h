@@ -51,6 +51,64 @@ struct FSoundManagersTableRow : public FTableRowBase
 	}
 };
 
+/** Enumeration for the types of virtual keyboard's keys. */
+UENUM(BlueprintType)
+enum class EVirtualKeyType : uint8
+{
+	Symbol,
+	Whitespace,
+	Backspace,
+	Enter
+};
+
+/**
+ * The table row for storing one key of the virtual
+ * keyboard. Keys are placed in the table's order from
+ * left to right inside their lines.
+ */
+USTRUCT(Blueprintable)
+struct FVirtualKeyboardKeyTableRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	/**
+	 * Name of the layout (for example, «English» or
+	 * «Symbols») this key belongs to.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FName Layout;
+
+	/** Index of the keyboard's line (from the top). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 Line;
+
+	/** Type of the key. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EVirtualKeyType KeyType;
+
+	/** Symbol that is typed in the lowercase mode. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString Symbol;
+
+	/**
+	 * Symbol that is typed in the uppercase mode (if it's
+	 * empty, the upper case of the Symbol is used).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString UppercaseSymbol;
+
+	/** Width of the key relative to the usual one. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Width;
+
+	/** The constructor to set default variables. */
+	FVirtualKeyboardKeyTableRow() : Line(0),
+	                                KeyType(EVirtualKeyType::Symbol),
+	                                Width(1.0f)
+	{
+	}
+};
+
 /** Container class for table row structs. */
 UCLASS()
 class CATPLATFORMER_API UTableRows : public UObject
@@ -44,12 +44,6 @@ protected:
 	 */
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	/** 
-	 * Function that is called every frame.
-	 * Is needed for updating platform's location.
-	 */
-	virtual void Tick(float DeltaSeconds) override;
-
 public:
 	/**
 	 * Function for initializing variables before this actor
@@ -153,9 +147,15 @@ protected:
 	float BuffRotationSpeed;
 
 private:
+	/**
+	 * Identifier of the rotation's update in the tick budget
+	 * manager.
+	 */
+	int32 BudgetedUpdateId;
+
 	/**
 	 * Function for rotating the actor around its own axis.
-	 * Will be called by a looped timer.
+	 * Is called by the tick budget manager.
 	 */
 	UFUNCTION()
 	void RotateBuffAroundItsAxis(const float DeltaSeconds);
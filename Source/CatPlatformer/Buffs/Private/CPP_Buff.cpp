@@ -10,18 +10,34 @@
 class ACPP_GameState;
 class ACPP_PlayerState;
 
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+#ifndef CPP_SIGNIFICANCEMANAGER_H
+#define CPP_SIGNIFICANCEMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_SignificanceManager.h"
+#endif
+
+#ifndef CPP_TICKBUDGETMANAGER_H
+#define CPP_TICKBUDGETMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_TickBudgetManager.h"
+#endif
+
 ACPP_Buff::ACPP_Buff() : BuffTypeId(-1),
                          EffectDuration(5.0f),
                          BuffImage(nullptr),
                          ScoreToAdd(10),
                          BuffRotationSpeed(4.5f),
+                         BudgetedUpdateId(0),
                          SmoothZMovementCurveFloat(nullptr),
                          StartPosition(FVector(0.0f)),
                          EndPosition(FVector(0.0f)),
                          bIsMovingUp(true),
                          ZPositionOffset(45.0f)
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	Root = CreateDefaultSubobject<USceneComponent>(FName(TEXT("Root")));
 	SetRootComponent(Root);
@@ -41,6 +57,24 @@ void ACPP_Buff::BeginPlay()
 
 	SM_Buff->OnComponentBeginOverlap.AddUniqueDynamic(this, &ACPP_Buff::StaticMeshOverlapBegin);
 
+	if (UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+		IsValid(SignificanceManager))
+	{
+		SignificanceManager->RegisterActor(this);
+	}
+
+	// The rotation is applied by the server only.
+	if (HasAuthority())
+	{
+		if (UCPP_TickBudgetManager* TickBudgetManager = GetWorld()->GetSubsystem<UCPP_TickBudgetManager>();
+			IsValid(TickBudgetManager))
+		{
+			BudgetedUpdateId = TickBudgetManager->RegisterUpdate(
+				this, FBudgetedUpdate::CreateUObject(this, &ACPP_Buff::RotateBuffAroundItsAxis),
+				ETickBudgetPriority::Low);
+		}
+	}
+
 	if (HasAuthority() && SmoothZMovementCurveFloat)
 	{
 		if (bIsMovingUp)
@@ -57,6 +91,18 @@ void ACPP_Buff::BeginPlay()
 void ACPP_Buff::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	SM_Buff->OnComponentBeginOverlap.RemoveDynamic(this, &ACPP_Buff::StaticMeshOverlapBegin);
+	if (UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+		IsValid(SignificanceManager))
+	{
+		SignificanceManager->UnregisterActor(this);
+	}
+
+	if (UCPP_TickBudgetManager* TickBudgetManager = GetWorld()->GetSubsystem<UCPP_TickBudgetManager>();
+		IsValid(TickBudgetManager))
+	{
+		TickBudgetManager->UnregisterUpdate(BudgetedUpdateId);
+		BudgetedUpdateId = 0;
+	}
 
 	if (HasAuthority())
 	{
@@ -66,12 +112,6 @@ void ACPP_Buff::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
-void ACPP_Buff::Tick(float DeltaSeconds)
-{
-	Super::Tick(DeltaSeconds);
-	RotateBuffAroundItsAxis(DeltaSeconds);
-}
-
 void ACPP_Buff::InitializeBasicVariables_Implementation(const FVector& StartLocation)
 {
 	if (!HasAuthority())
@@ -112,6 +152,8 @@ void ACPP_Buff::StaticMeshOverlapBegin(UPrimitiveComponent* OverlappedComponent,
 
 void ACPP_Buff::CollectBuff_Implementation(ACPP_Character* Character)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CollectBuff);
+
 	if (!HasAuthority())
 		return;
 
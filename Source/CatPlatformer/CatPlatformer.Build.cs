@@ -36,6 +36,13 @@ public class CatPlatformer : ModuleRules
 			"EnhancedInput"
 		});
 
+		// For migrating the animation blueprints to the C++
+		// animation instances (Cat.MigrateAnimBlueprints).
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.AddRange(new string[] { "UnrealEd", "BlueprintGraph" });
+		}
+
 		// To include OnlineSubsystemSteam, add it to the plugins section
 		// in your uproject file with the Enabled attribute set to true
 	}
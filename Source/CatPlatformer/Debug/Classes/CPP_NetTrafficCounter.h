@@ -0,0 +1,208 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+class UNetDriver;
+class UCanvas;
+
+#include "CPP_NetTrafficCounter.generated.h"
+
+/** Structure for storing traffic of one RPC. */
+USTRUCT()
+struct FRPCTrafficStats
+{
+	GENERATED_BODY()
+
+	/** Name of the native class that declares the RPC. */
+	FName ClassName;
+
+	/** Number of calls. */
+	uint64 Calls = 0;
+
+	/** Number of bits written to the connections. */
+	uint64 Bits = 0;
+
+	/** Is the RPC reliable? */
+	bool bIsReliable = false;
+};
+
+/** Structure for storing traffic of one actor class. */
+USTRUCT()
+struct FClassTrafficStats
+{
+	GENERATED_BODY()
+
+	/** Number of RPCs called on actors of this class. */
+	uint64 RPCCalls = 0;
+
+	/** Number of bits written by these RPCs. */
+	uint64 RPCBits = 0;
+
+	/**
+	 * Number of times the actors of this class were
+	 * replicated by the server.
+	 */
+	uint64 ReplicationUpdates = 0;
+
+	/**
+	 * Number of replicated actors of this class during the
+	 * last frame.
+	 */
+	int32 ActorsNumber = 0;
+};
+
+/**
+ * Subsystem for counting network traffic per RPC and per
+ * replicated actor class. Is controlled by the console
+ * command «Cat.NetCounters» with one of the arguments:
+ * start, stop, reset, dump, csv, overlay.
+ * Counting can be turned on from the start with the
+ * «-CatNetCounters» command line parameter.
+ * Outgoing RPCs are counted on the machine that sends them
+ * (Client and NetMulticast RPCs on the server, Server RPCs
+ * on the clients). RPCs aren't counted in Shipping builds.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_NetTrafficCounter : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Function for initializing the subsystem.
+	 * @param Collection Collection of subsystems.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/**
+	 * Function for cleaning up the subsystem. Writes the CSV
+	 * file if counting was turned on and the file wasn't
+	 * written yet.
+	 */
+	virtual void Deinitialize() override;
+
+	/**
+	 * Function that is called every frame while counting is
+	 * turned on. Is needed for counting replication updates.
+	 * @param DeltaTime Frame time.
+	 */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Should the subsystem be ticked now? */
+	virtual bool IsTickable() const override;
+
+	/** Stat ID of the subsystem's tick. */
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Function for limiting the subsystem to the game
+	 * worlds only.
+	 * @param WorldType Type of the world.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	/** Function for turning counting on. */
+	void StartCounting();
+
+	/** Function for turning counting off. */
+	void StopCounting();
+
+	/** Function for clearing all counters. */
+	void ResetCounters();
+
+	/** Function for printing all counters to the log. */
+	void DumpToLog() const;
+
+	/**
+	 * Function for writing all counters to the CSV file
+	 * inside the Saved/Profiling folder.
+	 */
+	void DumpToCSV();
+
+	/** Function for showing or hiding the overlay. */
+	void ToggleOverlay();
+
+	/** Is counting turned on at the moment? */
+	FORCEINLINE bool IsCounting() const { return bIsCounting; }
+
+private:
+	/** Is counting turned on at the moment? */
+	bool bIsCounting;
+
+	/**
+	 * Flag indicating if counters were written to the CSV
+	 * file since the last reset.
+	 */
+	bool bWasDumpedToCSV;
+
+	/**
+	 * Flag indicating that the RPC is being sent by this
+	 * subsystem right now (so it shouldn't be counted twice).
+	 */
+	bool bIsForwardingRPC;
+
+	/** Time (in seconds) when counting was started. */
+	double StartTime;
+
+	/**
+	 * World time during the previous tick. Is needed for
+	 * finding actors that were replicated after it.
+	 */
+	double PreviousTickWorldTime;
+
+	/** The net driver whose RPCs are counted. */
+	TWeakObjectPtr<UNetDriver> BoundNetDriver;
+
+	/** Traffic of every sent RPC («Class.Function» as key). */
+	TMap<FString, FRPCTrafficStats> RPCStats;
+
+	/** Traffic of every replicated actor class. */
+	TMap<FName, FClassTrafficStats> ClassStats;
+
+	/** Handle of the overlay's draw delegate. */
+	FDelegateHandle DH_DrawOverlay;
+
+	/**
+	 * Function for binding to the current world's net
+	 * driver (it can appear or change after the subsystem
+	 * was created).
+	 */
+	void BindToNetDriver();
+
+	/** Function for unbinding from the net driver. */
+	void UnbindFromNetDriver();
+
+#if !UE_BUILD_SHIPPING
+	/**
+	 * Function that is called by the net driver before
+	 * sending any RPC. Sends the RPC by itself for measuring
+	 * the written bits and blocks the original sending.
+	 */
+	void OnSendRPC(AActor* Actor, UFunction* Function, void* Parameters, FOutParmRec* OutParms,
+	               FFrame* Stack, UObject* SubObject, bool& bBlockSendRPC);
+#endif
+
+	/**
+	 * Function for getting number of bits written to all
+	 * connections of the bound net driver.
+	 */
+	int64 GetWrittenBits() const;
+
+	/**
+	 * Function for getting the closest native class (all
+	 * Blueprint children are counted as their C++ parent).
+	 * @param Object Object whose class is needed.
+	 */
+	static FName GetNativeClassName(const UObject* Object);
+
+	/**
+	 * Function for drawing the overlay.
+	 * @param Canvas Canvas to draw on.
+	 * @param PlayerController Viewport's player controller.
+	 */
+	void DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController);
+};
\ No newline at end of file
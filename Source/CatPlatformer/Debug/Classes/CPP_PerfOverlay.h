@@ -0,0 +1,113 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+class UCanvas;
+
+#include "CPP_PerfOverlay.generated.h"
+
+/**
+ * Subsystem for showing the game's performance counters
+ * (frame time, spawn queue, active AI, active timers and
+ * replicated actors) on the screen. Is toggled by the
+ * «Cat.PerfOverlay» console command. The same counters
+ * are written to the «stat CatPlatformer» group, so they
+ * are also updated while the group is shown.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_PerfOverlay : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Function for initializing the subsystem.
+	 * @param Collection Collection of subsystems.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Function for cleaning up the subsystem. */
+	virtual void Deinitialize() override;
+
+	/**
+	 * Function that is called every frame for updating the
+	 * counters.
+	 * @param DeltaTime Frame time.
+	 */
+	virtual void Tick(float DeltaTime) override;
+
+	/**
+	 * Should the subsystem be ticked now? The counters are
+	 * needed only by the overlay and by the shown
+	 * «stat CatPlatformer» group.
+	 */
+	virtual bool IsTickable() const override;
+
+	/** Stat ID of the subsystem's tick. */
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Function for limiting the subsystem to the game
+	 * worlds only.
+	 * @param WorldType Type of the world.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	/** Function for showing or hiding the overlay. */
+	void ToggleOverlay();
+
+private:
+	/** Handle of the overlay's draw delegate. */
+	FDelegateHandle DH_DrawOverlay;
+
+	/** Seconds until the next refresh of the counters. */
+	float SecondsToRefresh;
+
+	/** Average frame time (in milliseconds). */
+	float FrameTimeMs;
+
+	/** The longest frame during the previous half second. */
+	float MaxFrameTimeMs;
+
+	/** The longest frame since the previous refresh. */
+	float WindowMaxFrameTimeMs;
+
+	/**
+	 * Number of platforms and crows that are waiting to be
+	 * spawned.
+	 */
+	int32 SpawnQueueLength;
+
+	/** The longest spawn queue since the overlay was shown. */
+	int32 PeakSpawnQueueLength;
+
+	/** Number of crows that are waiting to be promoted. */
+	int32 PendingCrowsNumber;
+
+	/** Number of possessed enemy AI controllers. */
+	int32 ActiveAINumber;
+
+	/** Number of timers in the world's timer manager. */
+	int32 ActiveTimersNumber;
+
+	/** Number of replicated actors in the world. */
+	int32 ReplicatedActorsNumber;
+
+	/**
+	 * Function for counting the spawn queue, AI, timers and
+	 * replicated actors. Is called twice a second (iterating all
+	 * actors every frame would distort the frame time).
+	 */
+	void RefreshCounters();
+
+	/**
+	 * Function for drawing the overlay.
+	 * @param Canvas Canvas to draw on.
+	 * @param PlayerController Viewport's player controller.
+	 */
+	void DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController);
+};
\ No newline at end of file
@@ -0,0 +1,90 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "CPP_SoakRecorder.generated.h"
+
+/**
+ * Class for recording the server's health during long
+ * load and soak tests (usually with bot clients).
+ * Every few seconds appends one line with frame time,
+ * bandwidth, memory and players number to the CSV file
+ * inside the Saved/Profiling folder.
+ * Is turned on by the «-CatSoak» command line parameter;
+ * «-CatSoakInterval=N» changes the sampling period.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_SoakRecorder : public UObject
+{
+	GENERATED_BODY()
+
+	/** The constructor to set default variables. */
+	UCPP_SoakRecorder();
+
+public:
+	/**
+	 * Function for checking if soak recording was requested
+	 * from the command line.
+	 * @return True if «-CatSoak» parameter was passed.
+	 */
+	static bool IsRequestedFromCommandLine();
+
+	/**
+	 * Function for starting the recording.
+	 * @param InWorld The world whose frames and net driver
+	 * should be measured.
+	 */
+	void StartRecording(UWorld* InWorld);
+
+	/** Function for writing the last line and stopping. */
+	void StopRecording();
+
+private:
+	/** Weak pointer to the measured world. */
+	TWeakObjectPtr<UWorld> WorldRef;
+
+	/** Timer handle for calling the RecordSample function. */
+	FTimerHandle TH_RecordSample;
+
+	/**
+	 * Delegate handle for storing replying on the world's
+	 * Post Actor Tick event.
+	 */
+	FDelegateHandle DH_PostActorTick;
+
+	/** Full path to the CSV file. */
+	FString FilePath;
+
+	/** Number of seconds between two samples. */
+	float SampleInterval;
+
+	/** Time (in seconds) when the recording was started. */
+	double StartTime;
+
+	/** Memory used by the process when recording started. */
+	uint64 StartUsedPhysical;
+
+	/** Frames number since the previous sample. */
+	uint32 FramesNumber;
+
+	/** Summary frame time since the previous sample. */
+	double FrameTimeSum;
+
+	/** The longest frame since the previous sample. */
+	double MaxFrameTime;
+
+	/**
+	 * Function that is called after all actors of the
+	 * world were ticked.
+	 * @param World The ticked world.
+	 * @param TickType Type of the tick.
+	 * @param DeltaSeconds Frame time.
+	 */
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/** Function for appending one line to the CSV file. */
+	void RecordSample();
+};
\ No newline at end of file
@@ -0,0 +1,62 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stats of the game module. Can be viewed with the
+ * «stat CatPlatformer» console command or in Unreal
+ * Insights (CPU track).
+ */
+DECLARE_STATS_GROUP(TEXT("CatPlatformer"), STATGROUP_CatPlatformer, STATCAT_Advanced);
+
+//=====Cycle stats=====
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn Platforms"), STAT_Cat_SpawnPlatforms, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn Buffs"), STAT_Cat_SpawnBuffs, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Behavior Update"), STAT_Cat_EnemyBehavior, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Collect Buff"), STAT_Cat_CollectBuff, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Buff Effects"), STAT_Cat_BuffEffects, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Create Widget"), STAT_Cat_CreateWidget, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save Game I/O"), STAT_Cat_SaveIO, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Game Session Callback"), STAT_Cat_SessionCallback, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UI Preview Capture"), STAT_Cat_PreviewCapture, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Play SFX"), STAT_Cat_PlaySFX, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Significance Update"), STAT_Cat_Significance, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Budgeted Updates"), STAT_Cat_TickBudget, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Crow Promotion"), STAT_Cat_CrowPromotion, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Crow Animation Sharing"), STAT_Cat_AnimationSharing, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+
+//=====Counters=====
+
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Frame Time (ms)"), STAT_Cat_FrameTime, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawn Queue"), STAT_Cat_SpawnQueue, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active AI"), STAT_Cat_ActiveAI, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Timers"), STAT_Cat_ActiveTimers, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Replicated Actors"), STAT_Cat_ReplicatedActors, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("UI Preview Captures"), STAT_Cat_PreviewCaptures, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active SFX"), STAT_Cat_ActiveSFX, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Significant Objects"), STAT_Cat_SignificantObjects, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Budgeted Updates Called"), STAT_Cat_BudgetedUpdates, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Budgeted Updates Deferred"), STAT_Cat_DeferredUpdates, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Simulated Crows"), STAT_Cat_SimulatedCrows, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Proxy Crows"), STAT_Cat_ProxyCrows, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shared Crow Poses"), STAT_Cat_SharedCrowPoses, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Crow Pose Leaders"), STAT_Cat_CrowPoseLeaders, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Instanced Platforms"), STAT_Cat_InstancedPlatforms, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Platform Collision Chunks"), STAT_Cat_PlatformCollisionChunks, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Local Platforms"), STAT_Cat_LocalPlatforms, STATGROUP_CatPlatformer, CATPLATFORMER_API);
+
+/**
+ * Scope that is measured by the stat system and is shown
+ * in Unreal Insights. In builds without stats (Test) the
+ * scope is still sent to Insights as a CPU event.
+ */
+#if STATS
+#define CAT_SCOPE_CYCLE_COUNTER(Stat) SCOPE_CYCLE_COUNTER(Stat)
+#else
+#define CAT_SCOPE_CYCLE_COUNTER(Stat) TRACE_CPUPROFILER_EVENT_SCOPE(Stat)
+#endif
\ No newline at end of file
@@ -0,0 +1,216 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+
+#include "CPP_SyncLoadDetector.generated.h"
+
+/** Structure for storing one synchronous load. */
+USTRUCT()
+struct FSyncLoadRecord
+{
+	GENERATED_BODY()
+
+	/** Seconds since the recording was started. */
+	double Time = 0.0;
+
+	/** Function that has started the load. */
+	FString Function;
+
+	/** Game function that has called the Function. */
+	FString Caller;
+
+	/** Loaded packages (separated by «;»). */
+	FString Assets;
+
+	/**
+	 * Duration of the load (in milliseconds). Is negative
+	 * when the load wasn't wrapped into a measured scope.
+	 */
+	double DurationMs = -1.0;
+};
+
+/**
+ * Subsystem for catching synchronous asset loads on the
+ * game thread. Every load is printed to the log at once
+ * and all of them are written to the CSV file inside the
+ * Saved/Profiling folder when the game ends.
+ * Loads done through the CAT_LOAD_SYNCHRONOUS macro or
+ * inside the CAT_SYNC_LOAD_SCOPE scope are measured, all
+ * the other loads are caught by the engine's sync load
+ * delegate (without duration). Map loading is skipped.
+ * Is turned on in PIE and by the «-CatSyncLoads» command
+ * line parameter; the «Cat.SyncLoads» console command
+ * accepts: start, stop, dump, csv.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_SyncLoadDetector : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Function for initializing the subsystem.
+	 * @param Collection Collection of subsystems.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/**
+	 * Function for cleaning up the subsystem. Writes the CSV
+	 * file if there are any unsaved records.
+	 */
+	virtual void Deinitialize() override;
+
+	/** Function for turning recording on. */
+	void StartRecording();
+
+	/** Function for turning recording off. */
+	void StopRecording();
+
+	/** Function for printing all records to the log. */
+	void DumpToLog() const;
+
+	/**
+	 * Function for writing all records to the CSV file
+	 * inside the Saved/Profiling folder.
+	 */
+	void DumpToCSV();
+
+	/**
+	 * Function for loading the soft pointer's asset inside
+	 * the measured scope. Is used by CAT_LOAD_SYNCHRONOUS.
+	 * @param SoftPointer TSoftObjectPtr or TSoftClassPtr.
+	 * @param FunctionName Name of the calling function.
+	 * @return Loaded asset.
+	 */
+	template <typename TSoftPointer>
+	static auto LoadSynchronous(const TSoftPointer& SoftPointer, const ANSICHAR* FunctionName);
+
+	/**
+	 * Function that is called when the measured scope
+	 * begins (nested scopes are merged into the outer one).
+	 * @param FunctionName Name of the calling function.
+	 */
+	static void BeginScope(const ANSICHAR* FunctionName);
+
+	/** Function that is called when the measured scope ends. */
+	static void EndScope();
+
+private:
+	/** The detector that is recording at the moment. */
+	static UCPP_SyncLoadDetector* ActiveDetector;
+
+	/** Is recording turned on at the moment? */
+	bool bIsRecording;
+
+	/** Is the map being loaded at the moment? */
+	bool bIsLoadingMap;
+
+	/** Number of records that weren't written to CSV. */
+	int32 UnsavedRecordsNumber;
+
+	/** Time (in seconds) when recording was started. */
+	double StartTime;
+
+	/** Depth of the currently opened measured scopes. */
+	int32 ScopeDepth;
+
+	/** Function name of the outer measured scope. */
+	const ANSICHAR* ScopeFunctionName;
+
+	/** Time (in seconds) when the outer scope was opened. */
+	double ScopeStartTime;
+
+	/** Packages loaded inside the current scope. */
+	TArray<FString> ScopeAssets;
+
+	/** All recorded loads. */
+	TArray<FSyncLoadRecord> Records;
+
+	/**
+	 * Delegate handle for storing replying on the engine's
+	 * Sync Load Package event.
+	 */
+	FDelegateHandle DH_SyncLoadPackage;
+
+	/**
+	 * Delegate handle for storing replying on the engine's
+	 * Pre Load Map event.
+	 */
+	FDelegateHandle DH_PreLoadMap;
+
+	/**
+	 * Delegate handle for storing replying on the engine's
+	 * Post Load Map event.
+	 */
+	FDelegateHandle DH_PostLoadMap;
+
+	/**
+	 * Function that is called by the engine before any
+	 * synchronous package load.
+	 * @param PackageName Name of the loaded package.
+	 */
+	void OnSyncLoadPackage(const FString& PackageName);
+
+	/**
+	 * Function that is called before the map loading.
+	 * @param MapName Name of the loaded map.
+	 */
+	void OnPreLoadMap(const FString& MapName);
+
+	/**
+	 * Function that is called after the map loading.
+	 * @param LoadedWorld The loaded world.
+	 */
+	void OnPostLoadMap(UWorld* LoadedWorld);
+
+	/**
+	 * Function for saving the new record and printing it
+	 * to the log.
+	 * @param Function Function that has started the load.
+	 * @param Assets Loaded packages.
+	 * @param DurationMs Duration of the load.
+	 */
+	void AddRecord(const FString& Function, const FString& Assets, const double DurationMs);
+
+	/**
+	 * Function for finding the first game function in the
+	 * call stack that doesn't belong to the class of the
+	 * ExcludedFunction (and to this detector).
+	 * @param ExcludedFunction Function whose class should be
+	 * skipped.
+	 */
+	static FString FindGameCaller(const FString& ExcludedFunction);
+};
+
+/**
+ * Structure for measuring synchronous loads inside one
+ * C++ scope.
+ */
+struct FCatSyncLoadScope
+{
+	explicit FCatSyncLoadScope(const ANSICHAR* FunctionName)
+	{
+		UCPP_SyncLoadDetector::BeginScope(FunctionName);
+	}
+
+	~FCatSyncLoadScope()
+	{
+		UCPP_SyncLoadDetector::EndScope();
+	}
+};
+
+template <typename TSoftPointer>
+auto UCPP_SyncLoadDetector::LoadSynchronous(const TSoftPointer& SoftPointer, const ANSICHAR* FunctionName)
+{
+	FCatSyncLoadScope Scope(FunctionName);
+	return SoftPointer.LoadSynchronous();
+}
+
+/** Measured version of SoftPointer.LoadSynchronous(). */
+#define CAT_LOAD_SYNCHRONOUS(SoftPointer) UCPP_SyncLoadDetector::LoadSynchronous(SoftPointer, __FUNCTION__)
+
+/** Measures all synchronous loads till the end of the scope. */
+#define CAT_SYNC_LOAD_SCOPE() FCatSyncLoadScope ANONYMOUS_VARIABLE(SyncLoadScope)(__FUNCTION__)
\ No newline at end of file
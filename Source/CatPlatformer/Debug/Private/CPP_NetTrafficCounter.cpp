@@ -0,0 +1,381 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_NetTrafficCounter.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static FAutoConsoleCommandWithWorldAndArgs NetCountersCommand(
+	TEXT("Cat.NetCounters"),
+	TEXT("Per-RPC and per-class network traffic counters. Arguments: start, stop, reset, dump, csv, overlay."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UCPP_NetTrafficCounter* Counter = IsValid(World) ? World->GetSubsystem<UCPP_NetTrafficCounter>() : nullptr;
+		if (!IsValid(Counter))
+			return;
+
+		const FString Command = Args.Num() > 0 ? Args[0].ToLower() : TEXT("dump");
+		if (Command == TEXT("start"))
+		{
+			Counter->StartCounting();
+		}
+		else if (Command == TEXT("stop"))
+		{
+			Counter->StopCounting();
+		}
+		else if (Command == TEXT("reset"))
+		{
+			Counter->ResetCounters();
+		}
+		else if (Command == TEXT("csv"))
+		{
+			Counter->DumpToCSV();
+		}
+		else if (Command == TEXT("overlay"))
+		{
+			Counter->ToggleOverlay();
+		}
+		else
+		{
+			Counter->DumpToLog();
+		}
+	}));
+
+void UCPP_NetTrafficCounter::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	bIsCounting = false;
+	bWasDumpedToCSV = false;
+	bIsForwardingRPC = false;
+	StartTime = 0.0;
+	PreviousTickWorldTime = 0.0;
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("CatNetCounters")))
+	{
+		StartCounting();
+	}
+}
+
+void UCPP_NetTrafficCounter::Deinitialize()
+{
+	if (bIsCounting && !bWasDumpedToCSV)
+	{
+		DumpToCSV();
+	}
+	StopCounting();
+
+	if (DH_DrawOverlay.IsValid())
+	{
+		UDebugDrawService::Unregister(DH_DrawOverlay);
+		DH_DrawOverlay.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+bool UCPP_NetTrafficCounter::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UCPP_NetTrafficCounter::IsTickable() const
+{
+	return bIsCounting;
+}
+
+TStatId UCPP_NetTrafficCounter::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCPP_NetTrafficCounter, STATGROUP_Tickables);
+}
+
+void UCPP_NetTrafficCounter::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const UWorld* World = GetWorld();
+	if (!IsValid(World))
+		return;
+
+	UNetDriver* NetDriver = World->GetNetDriver();
+	if (NetDriver != BoundNetDriver.Get())
+	{
+		BindToNetDriver();
+	}
+	if (!IsValid(NetDriver) || !NetDriver->IsServer())
+		return;
+
+	for (auto& Pair : ClassStats)
+	{
+		Pair.Value.ActorsNumber = 0;
+	}
+
+	// Replication happens after the world's tick, so all actors
+	// with the last replication time not earlier than the
+	// previous tick were replicated during the previous frame.
+	for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : NetDriver->GetNetworkObjectList().GetActiveObjects())
+	{
+		if (!ObjectInfo.IsValid() || !IsValid(ObjectInfo->Actor))
+			continue;
+
+		FClassTrafficStats& Stats = ClassStats.FindOrAdd(GetNativeClassName(ObjectInfo->Actor));
+		Stats.ActorsNumber++;
+		if (ObjectInfo->LastNetReplicateTime >= PreviousTickWorldTime && PreviousTickWorldTime > 0.0)
+		{
+			Stats.ReplicationUpdates++;
+		}
+	}
+	PreviousTickWorldTime = World->GetTimeSeconds();
+}
+
+void UCPP_NetTrafficCounter::StartCounting()
+{
+	if (bIsCounting)
+		return;
+
+	bIsCounting = true;
+	StartTime = FPlatformTime::Seconds();
+	PreviousTickWorldTime = 0.0;
+	BindToNetDriver();
+}
+
+void UCPP_NetTrafficCounter::StopCounting()
+{
+	bIsCounting = false;
+	UnbindFromNetDriver();
+}
+
+void UCPP_NetTrafficCounter::ResetCounters()
+{
+	RPCStats.Reset();
+	ClassStats.Reset();
+	StartTime = FPlatformTime::Seconds();
+	PreviousTickWorldTime = 0.0;
+	bWasDumpedToCSV = false;
+}
+
+void UCPP_NetTrafficCounter::BindToNetDriver()
+{
+	UnbindFromNetDriver();
+
+	const UWorld* World = GetWorld();
+	if (!bIsCounting || !IsValid(World))
+		return;
+
+	if (UNetDriver* NetDriver = World->GetNetDriver(); IsValid(NetDriver))
+	{
+		// SendRPCDel exists only in non-Shipping builds, so
+		// Shipping builds count replication updates only.
+#if !UE_BUILD_SHIPPING
+		if (NetDriver->SendRPCDel.IsBound())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Net counters: SendRPCDel is already bound, RPCs won't be counted."));
+		}
+		else
+		{
+			NetDriver->SendRPCDel.BindUObject(this, &UCPP_NetTrafficCounter::OnSendRPC);
+		}
+#endif
+		BoundNetDriver = NetDriver;
+	}
+}
+
+void UCPP_NetTrafficCounter::UnbindFromNetDriver()
+{
+#if !UE_BUILD_SHIPPING
+	if (BoundNetDriver.IsValid() && BoundNetDriver->SendRPCDel.IsBoundToObject(this))
+	{
+		BoundNetDriver->SendRPCDel.Unbind();
+	}
+#endif
+	BoundNetDriver = nullptr;
+}
+
+#if !UE_BUILD_SHIPPING
+void UCPP_NetTrafficCounter::OnSendRPC(AActor* Actor, UFunction* Function, void* Parameters,
+                                       FOutParmRec* OutParms, FFrame* Stack, UObject* SubObject,
+                                       bool& bBlockSendRPC)
+{
+	if (bIsForwardingRPC || !bIsCounting || !BoundNetDriver.IsValid() || !Function)
+		return;
+
+	const int64 BitsBefore = GetWrittenBits();
+
+	bIsForwardingRPC = true;
+	BoundNetDriver->ProcessRemoteFunction(Actor, Function, Parameters, OutParms, Stack, SubObject);
+	bIsForwardingRPC = false;
+	bBlockSendRPC = true;
+
+	const uint64 WrittenBits = FMath::Max<int64>(GetWrittenBits() - BitsBefore, 0);
+	const FName ClassName = GetNativeClassName(IsValid(SubObject) ? SubObject : Actor);
+
+	FRPCTrafficStats& Stats = RPCStats.FindOrAdd(ClassName.ToString() + TEXT(".") + Function->GetName());
+	Stats.ClassName = ClassName;
+	Stats.bIsReliable = Function->HasAnyFunctionFlags(FUNC_NetReliable);
+	Stats.Calls++;
+	Stats.Bits += WrittenBits;
+
+	FClassTrafficStats& ActorClassStats = ClassStats.FindOrAdd(ClassName);
+	ActorClassStats.RPCCalls++;
+	ActorClassStats.RPCBits += WrittenBits;
+}
+#endif
+
+int64 UCPP_NetTrafficCounter::GetWrittenBits() const
+{
+	if (!BoundNetDriver.IsValid())
+		return 0;
+
+	// Bits that are already flushed plus bits that are still
+	// waiting in the send buffer.
+	int64 Bits = 0;
+	if (const UNetConnection* ServerConnection = BoundNetDriver->ServerConnection)
+	{
+		Bits += static_cast<int64>(ServerConnection->OutBytes) * 8 + ServerConnection->SendBuffer.GetNumBits();
+	}
+	for (const UNetConnection* Connection : BoundNetDriver->ClientConnections)
+	{
+		if (IsValid(Connection))
+		{
+			Bits += static_cast<int64>(Connection->OutBytes) * 8 + Connection->SendBuffer.GetNumBits();
+		}
+	}
+	return Bits;
+}
+
+FName UCPP_NetTrafficCounter::GetNativeClassName(const UObject* Object)
+{
+	if (!IsValid(Object))
+		return NAME_None;
+
+	const UClass* Class = Object->GetClass();
+	while (Class && !Class->HasAnyClassFlags(CLASS_Native))
+	{
+		Class = Class->GetSuperClass();
+	}
+	return Class ? Class->GetFName() : NAME_None;
+}
+
+void UCPP_NetTrafficCounter::DumpToLog() const
+{
+	const double Seconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 0.001);
+
+	UE_LOG(LogTemp, Warning, TEXT("===== Net counters (%.1f s) ====="), Seconds);
+	for (const auto& Pair : RPCStats)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("RPC %s%s: %llu calls (%.1f/s), %.2f KB (%.2f KB/s)"),
+		       *Pair.Key,
+		       Pair.Value.bIsReliable ? TEXT(" [Reliable]") : TEXT(""),
+		       Pair.Value.Calls, Pair.Value.Calls / Seconds,
+		       Pair.Value.Bits / 8192.0, Pair.Value.Bits / 8192.0 / Seconds);
+	}
+	for (const auto& Pair : ClassStats)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Class %s: %d actors, %llu updates (%.1f/s), %llu RPCs, %.2f KB of RPCs"),
+		       *Pair.Key.ToString(),
+		       Pair.Value.ActorsNumber,
+		       Pair.Value.ReplicationUpdates, Pair.Value.ReplicationUpdates / Seconds,
+		       Pair.Value.RPCCalls, Pair.Value.RPCBits / 8192.0);
+	}
+}
+
+void UCPP_NetTrafficCounter::DumpToCSV()
+{
+	const double Seconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 0.001);
+
+	FString Content = TEXT("Type,Name,Class,Reliable,Calls,CallsPerSecond,KB,KBPerSecond,Actors,Updates,UpdatesPerSecond\n");
+	for (const auto& Pair : RPCStats)
+	{
+		Content += FString::Printf(TEXT("RPC,%s,%s,%d,%llu,%.2f,%.3f,%.3f,,,\n"),
+		                           *Pair.Key,
+		                           *Pair.Value.ClassName.ToString(),
+		                           Pair.Value.bIsReliable ? 1 : 0,
+		                           Pair.Value.Calls, Pair.Value.Calls / Seconds,
+		                           Pair.Value.Bits / 8192.0, Pair.Value.Bits / 8192.0 / Seconds);
+	}
+	for (const auto& Pair : ClassStats)
+	{
+		Content += FString::Printf(TEXT("Class,%s,%s,,%llu,%.2f,%.3f,%.3f,%d,%llu,%.2f\n"),
+		                           *Pair.Key.ToString(),
+		                           *Pair.Key.ToString(),
+		                           Pair.Value.RPCCalls, Pair.Value.RPCCalls / Seconds,
+		                           Pair.Value.RPCBits / 8192.0, Pair.Value.RPCBits / 8192.0 / Seconds,
+		                           Pair.Value.ActorsNumber,
+		                           Pair.Value.ReplicationUpdates, Pair.Value.ReplicationUpdates / Seconds);
+	}
+
+	const FString FilePath = FPaths::ProjectSavedDir() / TEXT("Profiling") /
+		FString::Printf(TEXT("CatNetCounters_%s_%s.csv"),
+		                IsValid(GetWorld()) && GetWorld()->GetNetMode() == NM_Client ? TEXT("Client") : TEXT("Server"),
+		                *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Content, *FilePath))
+	{
+		bWasDumpedToCSV = true;
+		UE_LOG(LogTemp, Warning, TEXT("Net counters were written to %s"), *FilePath);
+	}
+}
+
+void UCPP_NetTrafficCounter::ToggleOverlay()
+{
+	if (DH_DrawOverlay.IsValid())
+	{
+		UDebugDrawService::Unregister(DH_DrawOverlay);
+		DH_DrawOverlay.Reset();
+	}
+	else
+	{
+		DH_DrawOverlay = UDebugDrawService::Register(
+			TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UCPP_NetTrafficCounter::DrawOverlay));
+	}
+}
+
+void UCPP_NetTrafficCounter::DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController)
+{
+	if (!Canvas || !GEngine || PlayerController != GetWorld()->GetFirstPlayerController())
+		return;
+
+	const double Seconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 0.001);
+	UFont* Font = GEngine->GetSmallFont();
+	constexpr float LineHeight = 14.0f;
+	float Y = 60.0f;
+
+	Canvas->SetDrawColor(FColor::Yellow);
+	Canvas->DrawText(Font, FString::Printf(TEXT("Net counters %s (%.0f s)"),
+	                                       bIsCounting ? TEXT("") : TEXT("[stopped]"), Seconds), 20.0f, Y);
+	Y += LineHeight;
+
+	// The most expensive RPCs go first.
+	TArray<TPair<FString, FRPCTrafficStats>> SortedRPCs = RPCStats.Array();
+	SortedRPCs.Sort([](const TPair<FString, FRPCTrafficStats>& A, const TPair<FString, FRPCTrafficStats>& B)
+	{
+		return A.Value.Bits > B.Value.Bits;
+	});
+	constexpr int32 MaxLines = 15;
+	Canvas->SetDrawColor(FColor::White);
+	for (int32 i = 0; i < SortedRPCs.Num() && i < MaxLines; i++)
+	{
+		Canvas->DrawText(Font, FString::Printf(TEXT("%s%s  %.1f calls/s  %.2f KB/s"),
+		                                       *SortedRPCs[i].Key,
+		                                       SortedRPCs[i].Value.bIsReliable ? TEXT(" [R]") : TEXT(""),
+		                                       SortedRPCs[i].Value.Calls / Seconds,
+		                                       SortedRPCs[i].Value.Bits / 8192.0 / Seconds), 20.0f, Y);
+		Y += LineHeight;
+	}
+
+	Y += LineHeight;
+	Canvas->SetDrawColor(FColor::Cyan);
+	for (const auto& Pair : ClassStats)
+	{
+		Canvas->DrawText(Font, FString::Printf(TEXT("%s  actors: %d  updates/s: %.1f  RPC KB/s: %.2f"),
+		                                       *Pair.Key.ToString(),
+		                                       Pair.Value.ActorsNumber,
+		                                       Pair.Value.ReplicationUpdates / Seconds,
+		                                       Pair.Value.RPCBits / 8192.0 / Seconds), 20.0f, Y);
+		Y += LineHeight;
+	}
+}
\ No newline at end of file
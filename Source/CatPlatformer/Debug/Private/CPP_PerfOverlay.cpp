@@ -0,0 +1,211 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_PerfOverlay.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+#include "EngineUtils.h"
+#include "TimerManager.h"
+
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+#ifndef CPP_ENEMYAICONTROLLER_H
+#define CPP_ENEMYAICONTROLLER_H
+#include "CatPlatformer/AI/Enemy/Classes/CPP_EnemyAIController.h"
+#endif
+class ACPP_EnemyAIController;
+
+#ifndef CPP_CROWSIMULATION_H
+#define CPP_CROWSIMULATION_H
+#include "CatPlatformer/AI/Enemy/Classes/CPP_CrowSimulation.h"
+#endif
+class UCPP_CrowSimulation;
+
+#ifndef CPP_LEVELSTATE_H
+#define CPP_LEVELSTATE_H
+#include "CatPlatformer/Platform/Classes/CPP_LevelState.h"
+#endif
+class ACPP_LevelState;
+
+static FAutoConsoleCommandWithWorld PerfOverlayCommand(
+	TEXT("Cat.PerfOverlay"),
+	TEXT("Shows or hides the game's performance overlay."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UCPP_PerfOverlay* PerfOverlay = IsValid(World) ? World->GetSubsystem<UCPP_PerfOverlay>() : nullptr;
+			IsValid(PerfOverlay))
+		{
+			PerfOverlay->ToggleOverlay();
+		}
+	}));
+
+void UCPP_PerfOverlay::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SecondsToRefresh = 0.0f;
+	FrameTimeMs = 0.0f;
+	MaxFrameTimeMs = 0.0f;
+	WindowMaxFrameTimeMs = 0.0f;
+	SpawnQueueLength = 0;
+	PeakSpawnQueueLength = 0;
+	PendingCrowsNumber = 0;
+	ActiveAINumber = 0;
+	ActiveTimersNumber = 0;
+	ReplicatedActorsNumber = 0;
+}
+
+void UCPP_PerfOverlay::Deinitialize()
+{
+	if (DH_DrawOverlay.IsValid())
+	{
+		UDebugDrawService::Unregister(DH_DrawOverlay);
+		DH_DrawOverlay.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+bool UCPP_PerfOverlay::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UCPP_PerfOverlay::IsTickable() const
+{
+#if STATS
+	// Stat IDs of the disabled groups aren't valid.
+	if (FThreadStats::IsCollectingData() && GET_STATID(STAT_Cat_SpawnQueue).IsValidStat())
+		return true;
+#endif
+	return DH_DrawOverlay.IsValid();
+}
+
+TStatId UCPP_PerfOverlay::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCPP_PerfOverlay, STATGROUP_Tickables);
+}
+
+void UCPP_PerfOverlay::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const float DeltaMs = FApp::GetDeltaTime() * 1000.0f;
+	FrameTimeMs = FMath::Lerp(FrameTimeMs, DeltaMs, 0.1f);
+	WindowMaxFrameTimeMs = FMath::Max(WindowMaxFrameTimeMs, DeltaMs);
+	SET_FLOAT_STAT(STAT_Cat_FrameTime, DeltaMs);
+
+	SecondsToRefresh -= DeltaTime;
+	if (SecondsToRefresh <= 0.0f)
+	{
+		SecondsToRefresh = 0.5f;
+		RefreshCounters();
+	}
+}
+
+void UCPP_PerfOverlay::ToggleOverlay()
+{
+	if (DH_DrawOverlay.IsValid())
+	{
+		UDebugDrawService::Unregister(DH_DrawOverlay);
+		DH_DrawOverlay.Reset();
+	}
+	else
+	{
+		SecondsToRefresh = 0.0f;
+		PeakSpawnQueueLength = 0;
+		DH_DrawOverlay = UDebugDrawService::Register(
+			TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UCPP_PerfOverlay::DrawOverlay));
+	}
+}
+
+void UCPP_PerfOverlay::RefreshCounters()
+{
+	UWorld* World = GetWorld();
+	if (!IsValid(World))
+		return;
+
+	MaxFrameTimeMs = WindowMaxFrameTimeMs;
+	WindowMaxFrameTimeMs = 0.0f;
+
+	int32 PendingPlatformsNumber = 0;
+	for (TActorIterator<ACPP_LevelState> It(World); It; ++It)
+	{
+		PendingPlatformsNumber += It->GetPendingPlatformsNumber();
+	}
+	const UCPP_CrowSimulation* CrowSimulation = World->GetSubsystem<UCPP_CrowSimulation>();
+	PendingCrowsNumber = IsValid(CrowSimulation) ? CrowSimulation->GetPendingPromotionsNumber() : 0;
+	SpawnQueueLength = PendingPlatformsNumber + PendingCrowsNumber;
+	PeakSpawnQueueLength = FMath::Max(PeakSpawnQueueLength, SpawnQueueLength);
+
+	ActiveAINumber = 0;
+	for (TActorIterator<ACPP_EnemyAIController> It(World); It; ++It)
+	{
+		if (IsValid(*It) && IsValid(It->GetPawn()))
+		{
+			ActiveAINumber++;
+		}
+	}
+
+	ActiveTimersNumber = 0;
+	World->GetTimerManager().ForEachHandle([this](FTimerHandle)
+	{
+		ActiveTimersNumber++;
+	});
+
+	// The server knows the exact list of replicated actors,
+	// clients have to look through all actors.
+	ReplicatedActorsNumber = 0;
+	if (const UNetDriver* NetDriver = World->GetNetDriver(); IsValid(NetDriver) && NetDriver->IsServer())
+	{
+		ReplicatedActorsNumber = NetDriver->GetNetworkObjectList().GetActiveObjects().Num();
+	}
+	else
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			if (It->GetIsReplicated())
+			{
+				ReplicatedActorsNumber++;
+			}
+		}
+	}
+
+	SET_DWORD_STAT(STAT_Cat_SpawnQueue, SpawnQueueLength);
+	SET_DWORD_STAT(STAT_Cat_ActiveAI, ActiveAINumber);
+	SET_DWORD_STAT(STAT_Cat_ActiveTimers, ActiveTimersNumber);
+	SET_DWORD_STAT(STAT_Cat_ReplicatedActors, ReplicatedActorsNumber);
+}
+
+void UCPP_PerfOverlay::DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController)
+{
+	if (!Canvas || !GEngine || PlayerController != GetWorld()->GetFirstPlayerController())
+		return;
+
+	UFont* Font = GEngine->GetSmallFont();
+	constexpr float LineHeight = 14.0f;
+	const float X = Canvas->ClipX - 260.0f;
+	float Y = 60.0f;
+
+	const TArray<FString> Lines = {
+		FString::Printf(TEXT("Frame: %.2f ms (max %.2f ms)"), FrameTimeMs, MaxFrameTimeMs),
+		FString::Printf(TEXT("Spawn queue: %d (crows %d, peak %d)"),
+		                SpawnQueueLength, PendingCrowsNumber, PeakSpawnQueueLength),
+		FString::Printf(TEXT("Active AI: %d"), ActiveAINumber),
+		FString::Printf(TEXT("Active timers: %d"), ActiveTimersNumber),
+		FString::Printf(TEXT("Replicated actors: %d"), ReplicatedActorsNumber)
+	};
+
+	Canvas->SetDrawColor(FrameTimeMs > 16.7f ? FColor::Red : FColor::Green);
+	for (const FString& Line : Lines)
+	{
+		Canvas->DrawText(Font, Line, X, Y);
+		Y += LineHeight;
+		Canvas->SetDrawColor(FColor::White);
+	}
+}
\ No newline at end of file
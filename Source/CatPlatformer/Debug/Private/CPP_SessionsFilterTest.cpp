@@ -0,0 +1,115 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#if !UE_BUILD_SHIPPING
+
+#include "OnlineSubsystemNames.h"
+#include "OnlineSubsystemUtils.h"
+
+#ifndef CPP_GAMESESSION_H
+#define CPP_GAMESESSION_H
+#include "CatPlatformer/Net/Classes/CPP_GameSession.h"
+#endif
+class ACPP_GameSession;
+
+static FAutoConsoleCommand TestSessionsFilterCommand(
+	TEXT("Cat.TestSessionsFilter"),
+	TEXT("Checks the filter of the found sessions on fabricated search results."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		ACPP_GameSession::TestSearchResultsFilter();
+	}));
+
+/**
+ * Session info of the fabricated search results. Is used
+ * only for checking the filter of the found sessions.
+ */
+class FTestSessionInfo : public FOnlineSessionInfo
+{
+public:
+	explicit FTestSessionInfo(const FUniqueNetIdRef& InSessionId) : SessionId(InSessionId)
+	{
+	}
+
+	virtual const uint8* GetBytes() const override { return nullptr; }
+	virtual int32 GetSize() const override { return sizeof(FTestSessionInfo); }
+	virtual bool IsValid() const override { return true; }
+	virtual const FUniqueNetId& GetSessionId() const override { return *SessionId; }
+	virtual FString ToString() const override { return SessionId->ToString(); }
+	virtual FString ToDebugString() const override { return ToString(); }
+
+private:
+	/** ID of the session. */
+	FUniqueNetIdRef SessionId;
+};
+
+bool ACPP_GameSession::TestSearchResultsFilter()
+{
+	const IOnlineSubsystem* NullSubsystem = IOnlineSubsystem::Get(NULL_SUBSYSTEM);
+	const IOnlineIdentityPtr Identity = NullSubsystem ? NullSubsystem->GetIdentityInterface() : nullptr;
+	if (!Identity.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Sessions filter test: the Null online subsystem isn't available."));
+		return false;
+	}
+
+	auto MakeResult = [&Identity](const FString& SessionId, const int64 Privacy, const FString& RoomNumber)
+	{
+		FOnlineSessionSearchResult Result;
+		if (const FUniqueNetIdPtr Id = Identity->CreateUniquePlayerId(SessionId); Id.IsValid())
+		{
+			Result.Session.SessionInfo = MakeShared<FTestSessionInfo>(Id.ToSharedRef());
+		}
+		Result.Session.SessionSettings.Set(FName(TEXT("SESSION_PRIVACY")), Privacy,
+		                                   EOnlineDataAdvertisementType::ViaOnlineService);
+		Result.Session.SessionSettings.Set(FName(TEXT("ROOM_NUMBER")), RoomNumber,
+		                                   EOnlineDataAdvertisementType::ViaOnlineService);
+		return Result;
+	};
+
+	// Public, private, duplicate of the first, public and
+	// invalid (without the session info) results.
+	TArray<FOnlineSessionSearchResult> Results;
+	Results.Emplace(MakeResult(TEXT("A"), 0, TEXT("100")));
+	Results.Emplace(MakeResult(TEXT("B"), 1, TEXT("200")));
+	Results.Emplace(MakeResult(TEXT("A"), 0, TEXT("100")));
+	Results.Emplace(MakeResult(TEXT("C"), 0, TEXT("300")));
+	Results.Emplace(FOnlineSessionSearchResult());
+	const TArray<FOnlineSessionSearchResult> AllResults = Results;
+
+	bool bPassed = true;
+	auto Check = [&bPassed](const bool bCondition, const TCHAR* Description)
+	{
+		if (!bCondition)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Sessions filter test failed: %s"), Description);
+			bPassed = false;
+		}
+	};
+
+	TMap<FString, int32> SessionIdIndex;
+	TMap<FString, int32> RoomNumberIndex;
+	FilterSearchResults(Results, true, FString(), SessionIdIndex, RoomNumberIndex);
+	Check(Results.Num() == 2, TEXT("public search keeps two sessions"));
+	Check(Results.Num() == 2 &&
+	      Results[0].GetSessionIdStr() == TEXT("A") &&
+	      Results[1].GetSessionIdStr() == TEXT("C"),
+	      TEXT("public search keeps the order of the sessions"));
+	Check(SessionIdIndex.FindRef(TEXT("C")) == 1 && !SessionIdIndex.Contains(TEXT("B")),
+	      TEXT("public search builds the session ID index"));
+
+	Results = AllResults;
+	FilterSearchResults(Results, false, TEXT("200"), SessionIdIndex, RoomNumberIndex);
+	Check(Results.Num() == 1 && Results[0].GetSessionIdStr() == TEXT("B"),
+	      TEXT("private search keeps only the session with the room number"));
+	Check(RoomNumberIndex.Num() == 1 && RoomNumberIndex.FindRef(TEXT("200")) == 0,
+	      TEXT("private search builds the room number index"));
+
+	Results = AllResults;
+	FilterSearchResults(Results, false, TEXT("999"), SessionIdIndex, RoomNumberIndex);
+	Check(Results.IsEmpty() && RoomNumberIndex.IsEmpty(), TEXT("unknown room number finds nothing"));
+
+	UE_LOG(LogTemp, Warning, TEXT("Sessions filter test %s."), bPassed ? TEXT("passed") : TEXT("failed"));
+	return bPassed;
+}
+
+#endif
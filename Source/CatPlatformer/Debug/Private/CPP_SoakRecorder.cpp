@@ -0,0 +1,132 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_SoakRecorder.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/GameStateBase.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UCPP_SoakRecorder::UCPP_SoakRecorder(): WorldRef(nullptr),
+                                        SampleInterval(10.0f),
+                                        StartTime(0.0),
+                                        StartUsedPhysical(0),
+                                        FramesNumber(0),
+                                        FrameTimeSum(0.0),
+                                        MaxFrameTime(0.0)
+{
+}
+
+bool UCPP_SoakRecorder::IsRequestedFromCommandLine()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("CatSoak"));
+}
+
+void UCPP_SoakRecorder::StartRecording(UWorld* InWorld)
+{
+	if (!IsValid(InWorld))
+		return;
+
+	WorldRef = InWorld;
+
+	float IntervalFromCommandLine = 0.0f;
+	if (FParse::Value(FCommandLine::Get(), TEXT("CatSoakInterval="), IntervalFromCommandLine) &&
+		IntervalFromCommandLine > 0.0f)
+	{
+		SampleInterval = IntervalFromCommandLine;
+	}
+
+	FilePath = FPaths::ProjectSavedDir() / TEXT("Profiling") /
+		FString::Printf(TEXT("CatSoak_%s.csv"), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(
+		TEXT("Seconds,Players,Frames,AvgFrameMs,MaxFrameMs,InKBps,OutKBps,UsedPhysicalMB,GrowthMB,UObjects\n"),
+		*FilePath);
+
+	StartTime = FPlatformTime::Seconds();
+	StartUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	FramesNumber = 0;
+	FrameTimeSum = 0.0;
+	MaxFrameTime = 0.0;
+
+	DH_PostActorTick = FWorldDelegates::OnWorldPostActorTick.AddUObject(
+		this, &UCPP_SoakRecorder::OnWorldPostActorTick);
+
+	InWorld->GetTimerManager().SetTimer(TH_RecordSample,
+	                                    this,
+	                                    &UCPP_SoakRecorder::RecordSample,
+	                                    SampleInterval,
+	                                    true);
+
+	UE_LOG(LogTemp, Warning, TEXT("Soak recording was started: %s"), *FilePath);
+}
+
+void UCPP_SoakRecorder::StopRecording()
+{
+	if (DH_PostActorTick.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(DH_PostActorTick);
+		DH_PostActorTick.Reset();
+	}
+
+	if (WorldRef.IsValid())
+	{
+		if (WorldRef->GetTimerManager().TimerExists(TH_RecordSample))
+		{
+			WorldRef->GetTimerManager().ClearTimer(TH_RecordSample);
+			RecordSample();
+		}
+	}
+	WorldRef = nullptr;
+}
+
+void UCPP_SoakRecorder::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != WorldRef.Get())
+		return;
+
+	FramesNumber++;
+	FrameTimeSum += DeltaSeconds;
+	MaxFrameTime = FMath::Max(MaxFrameTime, static_cast<double>(DeltaSeconds));
+}
+
+void UCPP_SoakRecorder::RecordSample()
+{
+	if (!WorldRef.IsValid())
+		return;
+
+	int32 PlayersNumber = 0;
+	if (const AGameStateBase* GameState = WorldRef->GetGameState())
+	{
+		PlayersNumber = GameState->PlayerArray.Num();
+	}
+
+	float InKBps = 0.0f;
+	float OutKBps = 0.0f;
+	if (const UNetDriver* NetDriver = WorldRef->GetNetDriver())
+	{
+		InKBps = NetDriver->InBytesPerSecond / 1024.0f;
+		OutKBps = NetDriver->OutBytesPerSecond / 1024.0f;
+	}
+
+	constexpr double BytesInMegabyte = 1024.0 * 1024.0;
+	const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	const double AvgFrameMs = FramesNumber > 0 ? FrameTimeSum / FramesNumber * 1000.0 : 0.0;
+
+	const FString Line = FString::Printf(TEXT("%.1f,%d,%u,%.2f,%.2f,%.2f,%.2f,%.1f,%.1f,%d\n"),
+	                                     FPlatformTime::Seconds() - StartTime,
+	                                     PlayersNumber,
+	                                     FramesNumber,
+	                                     AvgFrameMs,
+	                                     MaxFrameTime * 1000.0,
+	                                     InKBps,
+	                                     OutKBps,
+	                                     UsedPhysical / BytesInMegabyte,
+	                                     (static_cast<double>(UsedPhysical) - StartUsedPhysical) / BytesInMegabyte,
+	                                     GUObjectArray.GetObjectArrayNumMinusAvailable());
+	FFileHelper::SaveStringToFile(Line, *FilePath, FFileHelper::EEncodingOptions::AutoDetect,
+	                              &IFileManager::Get(), FILEWRITE_Append);
+
+	FramesNumber = 0;
+	FrameTimeSum = 0.0;
+	MaxFrameTime = 0.0;
+}
\ No newline at end of file
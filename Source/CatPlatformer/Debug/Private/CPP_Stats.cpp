@@ -0,0 +1,36 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_Stats.h"
+
+DEFINE_STAT(STAT_Cat_SpawnPlatforms);
+DEFINE_STAT(STAT_Cat_SpawnBuffs);
+DEFINE_STAT(STAT_Cat_EnemyBehavior);
+DEFINE_STAT(STAT_Cat_CollectBuff);
+DEFINE_STAT(STAT_Cat_BuffEffects);
+DEFINE_STAT(STAT_Cat_CreateWidget);
+DEFINE_STAT(STAT_Cat_SaveIO);
+DEFINE_STAT(STAT_Cat_SessionCallback);
+DEFINE_STAT(STAT_Cat_PreviewCapture);
+DEFINE_STAT(STAT_Cat_PlaySFX);
+DEFINE_STAT(STAT_Cat_Significance);
+DEFINE_STAT(STAT_Cat_TickBudget);
+DEFINE_STAT(STAT_Cat_CrowPromotion);
+DEFINE_STAT(STAT_Cat_AnimationSharing);
+
+DEFINE_STAT(STAT_Cat_FrameTime);
+DEFINE_STAT(STAT_Cat_SpawnQueue);
+DEFINE_STAT(STAT_Cat_ActiveAI);
+DEFINE_STAT(STAT_Cat_ActiveTimers);
+DEFINE_STAT(STAT_Cat_ReplicatedActors);
+DEFINE_STAT(STAT_Cat_PreviewCaptures);
+DEFINE_STAT(STAT_Cat_ActiveSFX);
+DEFINE_STAT(STAT_Cat_SignificantObjects);
+DEFINE_STAT(STAT_Cat_BudgetedUpdates);
+DEFINE_STAT(STAT_Cat_DeferredUpdates);
+DEFINE_STAT(STAT_Cat_SimulatedCrows);
+DEFINE_STAT(STAT_Cat_ProxyCrows);
+DEFINE_STAT(STAT_Cat_SharedCrowPoses);
+DEFINE_STAT(STAT_Cat_CrowPoseLeaders);
+DEFINE_STAT(STAT_Cat_InstancedPlatforms);
+DEFINE_STAT(STAT_Cat_PlatformCollisionChunks);
+DEFINE_STAT(STAT_Cat_LocalPlatforms);
\ No newline at end of file
@@ -0,0 +1,234 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_SyncLoadDetector.h"
+#include "HAL/PlatformStackWalk.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UCPP_SyncLoadDetector* UCPP_SyncLoadDetector::ActiveDetector = nullptr;
+
+static FAutoConsoleCommandWithWorldAndArgs SyncLoadsCommand(
+	TEXT("Cat.SyncLoads"),
+	TEXT("Detector of synchronous loads on the game thread. Arguments: start, stop, dump, csv."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const UGameInstance* GI = IsValid(World) ? World->GetGameInstance() : nullptr;
+		UCPP_SyncLoadDetector* Detector = IsValid(GI) ? GI->GetSubsystem<UCPP_SyncLoadDetector>() : nullptr;
+		if (!IsValid(Detector))
+			return;
+
+		const FString Command = Args.Num() > 0 ? Args[0].ToLower() : TEXT("dump");
+		if (Command == TEXT("start"))
+		{
+			Detector->StartRecording();
+		}
+		else if (Command == TEXT("stop"))
+		{
+			Detector->StopRecording();
+		}
+		else if (Command == TEXT("csv"))
+		{
+			Detector->DumpToCSV();
+		}
+		else
+		{
+			Detector->DumpToLog();
+		}
+	}));
+
+void UCPP_SyncLoadDetector::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	bIsRecording = false;
+	bIsLoadingMap = false;
+	UnsavedRecordsNumber = 0;
+	StartTime = 0.0;
+	ScopeDepth = 0;
+	ScopeFunctionName = nullptr;
+	ScopeStartTime = 0.0;
+
+	DH_PreLoadMap = FCoreUObjectDelegates::PreLoadMap.AddUObject(
+		this, &UCPP_SyncLoadDetector::OnPreLoadMap);
+	DH_PostLoadMap = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(
+		this, &UCPP_SyncLoadDetector::OnPostLoadMap);
+
+	if (GIsEditor || FParse::Param(FCommandLine::Get(), TEXT("CatSyncLoads")))
+	{
+		StartRecording();
+	}
+}
+
+void UCPP_SyncLoadDetector::Deinitialize()
+{
+	if (UnsavedRecordsNumber > 0)
+	{
+		DumpToCSV();
+	}
+	StopRecording();
+
+	FCoreUObjectDelegates::PreLoadMap.Remove(DH_PreLoadMap);
+	DH_PreLoadMap.Reset();
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(DH_PostLoadMap);
+	DH_PostLoadMap.Reset();
+
+	Super::Deinitialize();
+}
+
+void UCPP_SyncLoadDetector::StartRecording()
+{
+	if (bIsRecording)
+		return;
+
+	if (IsValid(ActiveDetector) && ActiveDetector != this)
+	{
+		// Only one game instance can be measured (PIE with
+		// several clients in one process).
+		return;
+	}
+
+	bIsRecording = true;
+	ActiveDetector = this;
+	StartTime = FPlatformTime::Seconds();
+	DH_SyncLoadPackage = FCoreUObjectDelegates::OnSyncLoadPackage.AddUObject(
+		this, &UCPP_SyncLoadDetector::OnSyncLoadPackage);
+}
+
+void UCPP_SyncLoadDetector::StopRecording()
+{
+	if (!bIsRecording)
+		return;
+
+	bIsRecording = false;
+	if (ActiveDetector == this)
+	{
+		ActiveDetector = nullptr;
+	}
+	FCoreUObjectDelegates::OnSyncLoadPackage.Remove(DH_SyncLoadPackage);
+	DH_SyncLoadPackage.Reset();
+	ScopeDepth = 0;
+	ScopeAssets.Reset();
+}
+
+void UCPP_SyncLoadDetector::BeginScope(const ANSICHAR* FunctionName)
+{
+	if (!ActiveDetector || !IsInGameThread())
+		return;
+
+	if (ActiveDetector->ScopeDepth++ == 0)
+	{
+		ActiveDetector->ScopeFunctionName = FunctionName;
+		ActiveDetector->ScopeAssets.Reset();
+		ActiveDetector->ScopeStartTime = FPlatformTime::Seconds();
+	}
+}
+
+void UCPP_SyncLoadDetector::EndScope()
+{
+	if (!ActiveDetector || !IsInGameThread() || ActiveDetector->ScopeDepth <= 0)
+		return;
+
+	if (--ActiveDetector->ScopeDepth == 0 && ActiveDetector->ScopeAssets.Num() > 0)
+	{
+		// Assets that are already in memory don't get here,
+		// so only the real loads are recorded.
+		const double DurationMs = (FPlatformTime::Seconds() - ActiveDetector->ScopeStartTime) * 1000.0;
+		ActiveDetector->AddRecord(ANSI_TO_TCHAR(ActiveDetector->ScopeFunctionName),
+		                          FString::Join(ActiveDetector->ScopeAssets, TEXT(";")),
+		                          DurationMs);
+		ActiveDetector->ScopeAssets.Reset();
+	}
+}
+
+void UCPP_SyncLoadDetector::OnSyncLoadPackage(const FString& PackageName)
+{
+	if (!bIsRecording || bIsLoadingMap || !IsInGameThread())
+		return;
+
+	if (ScopeDepth > 0)
+	{
+		ScopeAssets.AddUnique(PackageName);
+		return;
+	}
+
+	const FString Function = FindGameCaller(FString());
+	AddRecord(Function.IsEmpty() ? FString(TEXT("Unknown")) : Function, PackageName, -1.0);
+}
+
+void UCPP_SyncLoadDetector::OnPreLoadMap(const FString& MapName)
+{
+	bIsLoadingMap = true;
+}
+
+void UCPP_SyncLoadDetector::OnPostLoadMap(UWorld* LoadedWorld)
+{
+	bIsLoadingMap = false;
+}
+
+void UCPP_SyncLoadDetector::AddRecord(const FString& Function, const FString& Assets, const double DurationMs)
+{
+	FSyncLoadRecord& Record = Records.AddDefaulted_GetRef();
+	Record.Time = FPlatformTime::Seconds() - StartTime;
+	Record.Function = Function;
+	Record.Caller = FindGameCaller(Function);
+	Record.Assets = Assets;
+	Record.DurationMs = DurationMs;
+	UnsavedRecordsNumber++;
+
+	UE_LOG(LogTemp, Warning, TEXT("Sync load on the game thread: %s (%s) in %s, called from %s"),
+	       *Record.Assets,
+	       DurationMs >= 0.0 ? *FString::Printf(TEXT("%.2f ms"), DurationMs) : TEXT("not measured"),
+	       *Record.Function,
+	       Record.Caller.IsEmpty() ? TEXT("unknown") : *Record.Caller);
+}
+
+FString UCPP_SyncLoadDetector::FindGameCaller(const FString& ExcludedFunction)
+{
+	FString ExcludedClass;
+	if (!ExcludedFunction.Split(TEXT("::"), &ExcludedClass, nullptr))
+	{
+		ExcludedClass = ExcludedFunction;
+	}
+
+	// Game classes are the only ones with the «CPP_» prefix.
+	for (const FProgramCounterSymbolInfo& Frame : FPlatformStackWalk::GetStack(2, 64))
+	{
+		const FString FunctionName = ANSI_TO_TCHAR(Frame.FunctionName);
+		if (!FunctionName.Contains(TEXT("CPP_")) ||
+			FunctionName.Contains(TEXT("SyncLoad")) ||
+			(!ExcludedClass.IsEmpty() && FunctionName.StartsWith(ExcludedClass + TEXT("::"))))
+			continue;
+
+		return FunctionName;
+	}
+	return FString();
+}
+
+void UCPP_SyncLoadDetector::DumpToLog() const
+{
+	UE_LOG(LogTemp, Warning, TEXT("===== Sync loads on the game thread: %d ====="), Records.Num());
+	for (const FSyncLoadRecord& Record : Records)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%.1f s: %s (%.2f ms) in %s, called from %s"),
+		       Record.Time, *Record.Assets, Record.DurationMs, *Record.Function, *Record.Caller);
+	}
+}
+
+void UCPP_SyncLoadDetector::DumpToCSV()
+{
+	FString Content = TEXT("Seconds,DurationMs,Function,Caller,Assets\n");
+	for (const FSyncLoadRecord& Record : Records)
+	{
+		Content += FString::Printf(TEXT("%.2f,%.2f,\"%s\",\"%s\",\"%s\"\n"),
+		                           Record.Time, Record.DurationMs,
+		                           *Record.Function, *Record.Caller, *Record.Assets);
+	}
+
+	const FString FilePath = FPaths::ProjectSavedDir() / TEXT("Profiling") /
+		FString::Printf(TEXT("CatSyncLoads_%s.csv"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Content, *FilePath))
+	{
+		UnsavedRecordsNumber = 0;
+		UE_LOG(LogTemp, Warning, TEXT("Sync loads were written to %s"), *FilePath);
+	}
+}
\ No newline at end of file
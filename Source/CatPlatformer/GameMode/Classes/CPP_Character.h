@@ -47,6 +47,20 @@ enum class ECatSoundState : uint8
 	HitGround
 };
 
+/**
+ * Enumeration for the cat's movement state that defines
+ * which movement sound should be played.
+ */
+UENUM(Blueprintable)
+enum class ECatMovementSoundState : uint8
+{
+	Idle,
+	Walk,
+	Sprint,
+	Ice,
+	Air
+};
+
 /**
  * C++ parent class for the player character.
  */
@@ -89,14 +103,6 @@ protected:
 		meta = (AllowPrivateAccess = "true"))
 	UCameraComponent* FollowCamera;
 
-	/**
-	 * Niagara Component for correct working with particle
-	 * system.
-	 */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components | Niagara",
-		meta = (AllowPrivateAccess = "true"))
-	UNiagaraComponent* NiagaraComponent;
-
 	/**
 	 * Collision sphere for checking intersections with
 	 * objects during attacking.
@@ -185,18 +191,89 @@ protected:
 	UFUNCTION()
 	void OnReceiveDamageMontageEnded(UAnimMontage* AnimMontage, bool bInterrupted);
 
+	/**
+	 * Sounds of the cat. Are played by the pooled audio
+	 * components of the UCPP_SFXPool subsystem.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Cat's Sounds")
+	TMap<ECatSoundState, USoundBase*> CatSounds;
+
+	/**
+	 * Pitch multiplier of the running sounds (the walking
+	 * sounds are reused for running).
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Cat's Sounds")
+	float RunSoundsPitchMultiplier;
+
+	/**
+	 * Identifier of the current movement sound in the
+	 * UCPP_SFXPool subsystem (0 if there is no sound).
+	 */
+	int32 MovementSoundId;
+
+	/** The current movement sound state. */
+	ECatSoundState CurrentMovementSound;
+
+	/**
+	 * Movement state that was used for choosing the current
+	 * movement sound.
+	 */
+	ECatMovementSoundState MovementSoundState;
+
+	/**
+	 * Was the cat on the grass when the current movement
+	 * sound was chosen?
+	 */
+	bool bMovementSoundIsOnGrass;
+
+	/**
+	 * Function for getting the actual movement state by
+	 * the movement component and the current floor.
+	 * @param bOutIsOnGrass Is the floor a platform with
+	 * grass?
+	 */
+	ECatMovementSoundState CalculateMovementSoundState(bool& bOutIsOnGrass) const;
+
 public:
-	/** Function for stopping active movements sounds. */
+	/**
+	 * Old event for stopping the movement sounds that
+	 * BP_CatCharacter still implements with its own audio
+	 * components. Isn't called anymore (see
+	 * StopPlayingMovementSound).
+	 */
 	UFUNCTION(BlueprintImplementableEvent)
 	void StopAllMovementSounds();
 
 	/**
-	 * Function for starting playing the cat's sound.
+	 * Old event for playing the cat's sound that
+	 * BP_CatCharacter still implements with its own audio
+	 * components. Isn't called anymore (see
+	 * StartPlayingCatSound).
 	 * @param CatSound Sound state.
 	 */
 	UFUNCTION(BlueprintImplementableEvent)
 	void PlaySound(ECatSoundState CatSound);
 
+	/** Function for stopping the active movement sound. */
+	UFUNCTION(BlueprintCallable)
+	void StopPlayingMovementSound();
+
+	/**
+	 * Function for starting playing the cat's sound. The
+	 * movement sound isn't restarted if it is playing now.
+	 * @param CatSound Sound state.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void StartPlayingCatSound(const ECatSoundState CatSound);
+
+	/**
+	 * Function for switching the movement sound if the
+	 * movement state or the surface was changed since the
+	 * previous call. Works for the locally controlled cat
+	 * only.
+	 */
+	void UpdateMovementSoundState();
+
 	/**
 	 * Flag indicating if the player is on the platform with
 	 * grass. Is needed for correct sound spawning.
@@ -208,6 +285,37 @@ public:
 
 	/** Getter for the bIsOnGrass variable. */
 	FORCEINLINE bool GetIsOnGrass() const { return bIsOnGrass; }
+
+	/** Getter for the platform the character is standing on. */
+	FORCEINLINE AActor* GetFloorPlatform() const { return FloorPlatform.Get(); }
+
+private:
+	/**
+	 * Platform (actor with ICPP_PlatformInterface) the
+	 * character is standing on now.
+	 */
+	TWeakObjectPtr<AActor> FloorPlatform;
+
+	/**
+	 * Function for checking the movement component's current
+	 * floor after every movement update. Is bound to the
+	 * OnCharacterMovementUpdated delegate.
+	 * @param DeltaSeconds Time of the movement update.
+	 * @param OldLocation Location before the update.
+	 * @param OldVelocity Velocity before the update.
+	 */
+	UFUNCTION()
+	void UpdateFloorPlatform(float DeltaSeconds, FVector OldLocation, FVector OldVelocity);
+
+	/**
+	 * Function for changing the current platform and for
+	 * calling the leave and enter events of the platforms.
+	 * @param NewFloorActor Actor of the current floor (can
+	 * be nullptr or an actor without the interface).
+	 */
+	void SetFloorPlatform(AActor* NewFloorActor);
+
+public:
 	
 	/** Is the character jumping (or falling) now? */
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Cat's State")
@@ -290,9 +398,36 @@ public:
 	bool bShieldBuffIsActive;
 
 	/** Particle system for shield spawning. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Niagara", meta = (AllowPrivateAccess = "true"))
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Niagara", meta = (AllowPrivateAccess = "true"))
 	UNiagaraSystem* ShieldNiagara;
 
+	/**
+	 * Shield's Niagara Component taken from the world's
+	 * component pool (nullptr if the shield isn't shown).
+	 */
+	UPROPERTY()
+	UNiagaraComponent* ShieldComponent;
+
+	/**
+	 * Maximum distance from the local players' views at
+	 * which the shield is shown.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Niagara", meta = (AllowPrivateAccess = "true"))
+	float MaxShieldDistance;
+
+	/**
+	 * Maximum number of shields shown at once (the closest
+	 * ones to the local players' views are shown).
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Niagara", meta = (AllowPrivateAccess = "true"))
+	int32 MaxShownShields;
+
+	/**
+	 * Timer handle for checking if the shield should be
+	 * shown while the shield buff is active.
+	 */
+	FTimerHandle TH_ShieldCulling;
+
 	//======================Player State===========================
 private:
 	/** Reference to the associated player state instance. */
@@ -376,11 +511,25 @@ public:
 
 	/** Function for spawning the shield. */
 	UFUNCTION()
-	void SpawnShield() const;
+	void SpawnShield();
 
 	/** Function for destroying the shield. */
 	UFUNCTION()
-	void DestroyShield() const;
+	void DestroyShield();
+
+	/**
+	 * Function for showing or hiding the shield up to the
+	 * distance to the local players' views and the budget
+	 * of the shown shields.
+	 */
+	UFUNCTION()
+	void UpdateShieldCulling();
+
+	/**
+	 * Function for getting the squared distance to the
+	 * closest local player's view.
+	 */
+	float GetDistanceSquaredToLocalView() const;
 
 	/**
 	 * A function for changing the sliding properties of the
@@ -47,8 +47,9 @@ DECLARE_DELEGATE_TwoParams(FStartFindingSessions,
                            FUniqueNetIdRepl /* UserId */,
                            bool /* bIsLAN */);
 
-DECLARE_MULTICAST_DELEGATE_OneParam(FFindingSessionsCompleted,
-                                    const TSharedPtr<FOnlineSessionSearch>& /* FoundSessions */);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FFindingSessionsCompleted,
+                                     const TSharedPtr<FOnlineSessionSearch>& /* FoundSessions */,
+                                     bool /* bIsCachedResult */);
 
 DECLARE_DELEGATE(FCancelFindingSessions);
 
@@ -194,7 +195,9 @@ public:
 
 	/**
 	 * Delegate for passing found online sessions to other
-	 * class.
+	 * class. Can be broadcast twice for one search: first
+	 * with the cached results (if they are still fresh),
+	 * and then with the refreshed ones.
 	 */
 	FFindingSessionsCompleted FindingSessionsCompletedDelegate;
 
@@ -277,6 +280,15 @@ public:
 	 */
 	UClass* GetWidgetClassBySoftReference(const TSoftClassPtr<UUserWidget>& WidgetPointer);
 
+	/**
+	 * Function for asynchronous loading of any given soft
+	 * asset reference by using the asset loader.
+	 * @param AssetToLoad Asset reference.
+	 * @return Handle for tracking the loading (the asset
+	 * stays in memory while the handle is kept).
+	 */
+	TSharedPtr<FStreamableHandle> RequestAsyncLoad(const FSoftObjectPath& AssetToLoad);
+
 private:
 	/**
 	 * Function for synchronous receiving class from any
@@ -19,6 +19,7 @@ class UCPP_PlatformSpawner;
 class ACPP_Platform;
 class ACPP_Buff;
 class ACPP_VictoryActor;
+class UCPP_SoakRecorder;
 
 #include "CPP_GameMode.generated.h"
 
@@ -81,6 +82,23 @@ protected:
 	 */
 	virtual void PostLogin(APlayerController* NewPlayer) override;
 
+	/**
+	 * Function for spawning the player controller for the
+	 * new player. Clients joined with the «?Bot» URL option
+	 * get the BotControllerClass controller.
+	 * @param InRemoteRole Remote role of the new controller.
+	 * @param Options URL options the player joined with.
+	 * @return The spawned player controller.
+	 */
+	virtual APlayerController* SpawnPlayerController(ENetRole InRemoteRole, const FString& Options) override;
+
+	/**
+	 * The player controller class for headless bot clients
+	 * (is used for load and soak testing).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bot")
+	TSubclassOf<APlayerController> BotControllerClass;
+
 public:
 	/**
 	 * Function for unregister disconnected online player.
@@ -224,4 +242,12 @@ private:
 
 	/** Timer for calling loading screens destroying. */
 	FTimerHandle TH_CallLoadingScreenDestroying;
+
+	/**
+	 * Reference to the object that records the server's
+	 * health during soak tests (is only created with
+	 * «-CatSoak» command line parameter).
+	 */
+	UPROPERTY()
+	UCPP_SoakRecorder* SoakRecorder;
 };
@@ -208,7 +208,33 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Victory")
 	TSubclassOf<ACPP_VictoryFirework> VictoryFireworkClass;
 
+	/**
+	 * Maximum number of fireworks that can be launched at
+	 * the same time (the excess ones, starting from the
+	 * farthest, are culled). The same number of firework
+	 * actors is spawned in advance.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Victory", meta = (ClampMin = "0"))
+	int32 MaxVictoryFireworks;
+
+	/**
+	 * Maximum distance from the nearest local player's view
+	 * point to the firework that should be launched.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Victory", meta = (ClampMin = "0.0"))
+	float MaxVictoryFireworkDistance;
+
 private:
+	/** Firework actors that were spawned in advance. */
+	UPROPERTY()
+	TArray<ACPP_VictoryFirework*> VictoryFireworks;
+
+	/**
+	 * Function for spawning the firework actors in advance
+	 * (on every machine except the dedicated server).
+	 */
+	void SpawnVictoryFireworksPool();
+
 	/**
 	 * Function for spawning the firework nearby the winners. 
 	 * @param InWinners The list of winners.
@@ -39,6 +39,7 @@ class CATPLATFORMER_API ACPP_PlayerController : public APlayerController
 {
 	GENERATED_BODY()
 
+protected:
 	/** The constructor to set default variables. */
 	ACPP_PlayerController();
 
@@ -5,7 +5,13 @@
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "EngineUtils.h"
+#include "Sound/SoundBase.h"
+#include "UObject/ConstructorHelpers.h"
 
 #ifndef CPP_GAMESTATE_H
 #define CPP_GAMESTATE_H
@@ -17,12 +23,49 @@ class ACPP_GameState;
 #include "Components/PrimitiveComponent.h"
 #include "Components/BoxComponent.h"
 
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+#ifndef CPP_SYNCLOADDETECTOR_H
+#define CPP_SYNCLOADDETECTOR_H
+#include "CatPlatformer/Debug/Classes/CPP_SyncLoadDetector.h"
+#endif
+
+#ifndef CPP_SFXPOOL_H
+#define CPP_SFXPOOL_H
+#include "CatPlatformer/Sound/Classes/CPP_SFXPool.h"
+#endif
+
+#ifndef CPP_FALLINGPLATFORM_H
+#define CPP_FALLINGPLATFORM_H
+#include "CatPlatformer/Platform/Classes/CPP_FallingPlatform.h"
+#endif
+class ACPP_FallingPlatform;
+
+#ifndef CPP_SLIPPERYPLATFORM_H
+#define CPP_SLIPPERYPLATFORM_H
+#include "CatPlatformer/Platform/Classes/CPP_SlipperyPlatform.h"
+#endif
+class ACPP_SlipperyPlatform;
+
+#ifndef CPP_PLATFORMINTERFACE_H
+#define CPP_PLATFORMINTERFACE_H
+#include "CatPlatformer/Platform/Classes/CPP_PlatformInterface.h"
+#endif
+
 ACPP_Character::ACPP_Character() : bSprintNow(false), BaseSpeed(165.0f), SprintSpeed(300.0f),
                                    BaseTurnRate(45.f), BaseLookUpRate(45.f), // Set turn rates for input.
                                    BaseJumpZVelocity(400.0f), HighJumpZVelocity(900.0f),
                                    AnimInstance(nullptr),
                                    AttackMontage(nullptr),
                                    ReceiveDamageMontage(nullptr),
+                                   RunSoundsPitchMultiplier(1.35f),
+                                   MovementSoundId(0),
+                                   CurrentMovementSound(ECatSoundState::None),
+                                   MovementSoundState(ECatMovementSoundState::Idle),
+                                   bMovementSoundIsOnGrass(false),
                                    bIsOnGrass(false),
                                    bIsJumping(false),
                                    bIsAttacking(false),
@@ -32,6 +75,9 @@ ACPP_Character::ACPP_Character() : bSprintNow(false), BaseSpeed(165.0f), SprintS
                                    bDoubleJumpBuffIsActive(false), bHighJumpBuffIsActive(false),
                                    bSlowBuffIsActive(false), bFastBuffIsActive(false),
                                    bShieldBuffIsActive(false), ShieldNiagara(nullptr),
+                                   ShieldComponent(nullptr),
+                                   MaxShieldDistance(5000.0f),
+                                   MaxShownShields(4),
                                    PlayerStateRef(nullptr)
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -64,14 +110,55 @@ ACPP_Character::ACPP_Character() : bSprintNow(false), BaseSpeed(165.0f), SprintS
 	// Camera does not rotate relative to arm.
 	FollowCamera->bUsePawnControlRotation = false;
 
-	NiagaraComponent = CreateDefaultSubobject<UNiagaraComponent>(FName(TEXT("Niagara Component")));
-	NiagaraComponent->SetupAttachment(GetMesh());
-
 	LeftPawCollision = CreateDefaultSubobject<USphereComponent>(FName(TEXT("Paw Sphere")));
 	LeftPawCollision->AttachToComponent(GetMesh(), FAttachmentTransformRules::KeepRelativeTransform,
 	                                    FName(TEXT("left_foot_socket")));
 	LeftPawCollision->InitSphereRadius(0.05f);
 
+	// The same cues that BP_CatCharacter had on its own
+	// audio components.
+	static ConstructorHelpers::FObjectFinder<USoundBase> WalkSound
+		(TEXT("/Game/CatPlatformer/Sounds/SFX/Cat/CatCarpetWalk_Sound_Cue"));
+	static ConstructorHelpers::FObjectFinder<USoundBase> GrassWalkSound
+		(TEXT("/Game/CatPlatformer/Sounds/SFX/Cat/CatWalkGrass_Sound_Cue"));
+	static ConstructorHelpers::FObjectFinder<USoundBase> HissSound
+		(TEXT("/Game/CatPlatformer/Sounds/SFX/Cat/CatHiss_Sound_Cue"));
+	static ConstructorHelpers::FObjectFinder<USoundBase> AttackSound
+		(TEXT("/Game/CatPlatformer/Sounds/SFX/Cat/CatAttack_Sound_Cue"));
+	static ConstructorHelpers::FObjectFinder<USoundBase> HitGroundSound
+		(TEXT("/Game/CatPlatformer/Sounds/SFX/Cat/HitTheGround_Sound_Cue"));
+	if (WalkSound.Succeeded())
+	{
+		CatSounds.Add(ECatSoundState::BasicWalk, WalkSound.Object);
+		CatSounds.Add(ECatSoundState::BasicRun, WalkSound.Object);
+	}
+	if (GrassWalkSound.Succeeded())
+	{
+		CatSounds.Add(ECatSoundState::GrassWalk, GrassWalkSound.Object);
+		CatSounds.Add(ECatSoundState::GrassRun, GrassWalkSound.Object);
+	}
+	if (HissSound.Succeeded())
+	{
+		CatSounds.Add(ECatSoundState::Hiss, HissSound.Object);
+	}
+	if (AttackSound.Succeeded())
+	{
+		CatSounds.Add(ECatSoundState::Attack, AttackSound.Object);
+	}
+	if (HitGroundSound.Succeeded())
+	{
+		CatSounds.Add(ECatSoundState::HitGround, HitGroundSound.Object);
+	}
+
+	// The system that BP_CatCharacter had on the removed
+	// shield component.
+	static ConstructorHelpers::FObjectFinder<UNiagaraSystem> ShieldSystem
+		(TEXT("/Game/CatPlatformer/Assets/MegaMagicVFXBundle/Systems/N_TranslucentShield"));
+	if (ShieldSystem.Succeeded())
+	{
+		ShieldNiagara = ShieldSystem.Object;
+	}
+
 	AutoPossessPlayer = EAutoReceiveInput::Disabled;
 }
 
@@ -79,10 +166,17 @@ void ACPP_Character::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (IsValid(NiagaraComponent) && !NiagaraComponent->IsActive())
+	// Warming up the pool, so the first shield doesn't
+	// create the component when the buff is collected.
+	if (IsValid(ShieldNiagara) && GetNetMode() != NM_DedicatedServer)
 	{
-		NiagaraComponent->ActivateSystem();
-		NiagaraComponent->DeactivateImmediate();
+		if (UNiagaraComponent* WarmUpComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(
+			ShieldNiagara, GetMesh(), NAME_None, FVector::ZeroVector, FRotator::ZeroRotator,
+			EAttachLocation::SnapToTarget, false, false,
+			ENCPoolMethod::ManualRelease, false); IsValid(WarmUpComponent))
+		{
+			WarmUpComponent->ReleaseToPool();
+		}
 	}
 
 	AnimInstance = GetMesh()->GetAnimInstance();
@@ -99,6 +193,8 @@ void ACPP_Character::BeginPlay()
 	{
 		PlayerStateRef->UpdateCatsColorUpToSavedIndex();
 	}
+
+	OnCharacterMovementUpdated.AddDynamic(this, &ACPP_Character::UpdateFloorPlatform);
 }
 
 void ACPP_Character::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -115,8 +211,17 @@ void ACPP_Character::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		GetWorld()->GetTimerManager().ClearTimer(TH_CheckForHittingTheGround);
 	}
+	if (GetWorld()->GetTimerManager().TimerExists(TH_ShieldCulling))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_ShieldCulling);
+	}
+
+	OnCharacterMovementUpdated.RemoveDynamic(this, &ACPP_Character::UpdateFloorPlatform);
+	SetFloorPlatform(nullptr);
 
 	ResetAllActiveBuffs();
+	DestroyShield();
+	StopPlayingMovementSound();
 	if (PlayerStateChangedDelegate.IsBound())
 	{
 		PlayerStateChangedDelegate.Clear();
@@ -179,6 +284,8 @@ void ACPP_Character::OnPlayerStateChanged(APlayerState* NewPlayerState, APlayerS
 
 void ACPP_Character::ResetAllActiveBuffs()
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_BuffEffects);
+
 	if (bDoubleJumpBuffIsActive && GetWorld()->GetTimerManager().TimerExists(TH_DoubleJump))
 	{
 		GetWorld()->GetTimerManager().ClearTimer(TH_DoubleJump);
@@ -199,10 +306,16 @@ void ACPP_Character::ResetAllActiveBuffs()
 	{
 		GetWorld()->GetTimerManager().ClearTimer(TH_ShieldBuff);
 	}
+	if (GetWorld()->GetTimerManager().TimerExists(TH_ShieldCulling))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_ShieldCulling);
+	}
 }
 
 void ACPP_Character::LaunchDoubleJumpBuff(const float Duration, USlateBrushAsset* Image)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_BuffEffects);
+
 	if (IsValid(PlayerStateRef))
 	{
 		PlayerStateRef->IncrementCollectedBuffsNumber();
@@ -246,6 +359,8 @@ void ACPP_Character::ResetDoubleJumpBuff()
 
 void ACPP_Character::LaunchHighJumpBuff(const float Duration, USlateBrushAsset* Image)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_BuffEffects);
+
 	if (IsValid(PlayerStateRef))
 	{
 		PlayerStateRef->IncrementCollectedBuffsNumber();
@@ -289,6 +404,8 @@ void ACPP_Character::ResetHighJumpBuff()
 
 void ACPP_Character::LaunchSlowBuff(const float Duration, USlateBrushAsset* Image)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_BuffEffects);
+
 	if (IsValid(PlayerStateRef))
 	{
 		PlayerStateRef->IncrementCollectedBuffsNumber();
@@ -341,6 +458,8 @@ void ACPP_Character::ResetSlowBuff()
 
 void ACPP_Character::LaunchFastBuff(const float Duration, USlateBrushAsset* Image)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_BuffEffects);
+
 	if (IsValid(PlayerStateRef))
 	{
 		PlayerStateRef->IncrementCollectedBuffsNumber();
@@ -393,6 +512,8 @@ void ACPP_Character::ResetFastBuff()
 
 void ACPP_Character::LaunchShieldBuff(const float Duration, USlateBrushAsset* Image)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_BuffEffects);
+
 	if (IsValid(PlayerStateRef))
 	{
 		PlayerStateRef->IncrementCollectedBuffsNumber();
@@ -401,7 +522,16 @@ void ACPP_Character::LaunchShieldBuff(const float Duration, USlateBrushAsset* Im
 	CollectBuffDelegate.ExecuteIfBound(5, Image, Duration);
 
 	bShieldBuffIsActive = true;
-	SpawnShield();
+	UpdateShieldCulling();
+	if (GetNetMode() != NM_DedicatedServer && !GetWorld()->GetTimerManager().TimerExists(TH_ShieldCulling))
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			TH_ShieldCulling,
+			this,
+			&ACPP_Character::UpdateShieldCulling,
+			0.5f,
+			true);
+	}
 
 	if (GetWorld()->GetTimerManager().TimerExists(TH_ShieldBuff))
 	{
@@ -426,26 +556,97 @@ void ACPP_Character::ResetShieldBuff()
 	bShieldBuffIsActive = false;
 	DestroyShield();
 
+	if (GetWorld()->GetTimerManager().TimerExists(TH_ShieldCulling))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_ShieldCulling);
+	}
+
 	if (GetWorld()->GetTimerManager().TimerExists(TH_ShieldBuff))
 	{
 		GetWorld()->GetTimerManager().ClearTimer(TH_ShieldBuff);
 	}
 }
 
-void ACPP_Character::SpawnShield() const
+void ACPP_Character::SpawnShield()
 {
-	if (IsValid(NiagaraComponent) && !NiagaraComponent->IsActive())
+	if (IsValid(ShieldComponent) || !IsValid(ShieldNiagara) || GetNetMode() == NM_DedicatedServer)
+		return;
+
+	// The distance and the number of shields are limited by
+	// UpdateShieldCulling; the pre-cull check also applies
+	// the effect type's scalability if the asset has one.
+	ShieldComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(
+		ShieldNiagara, GetMesh(), NAME_None, FVector::ZeroVector, FRotator::ZeroRotator,
+		EAttachLocation::SnapToTarget, false, true,
+		ENCPoolMethod::ManualRelease, true);
+}
+
+void ACPP_Character::DestroyShield()
+{
+	if (!IsValid(ShieldComponent))
+	{
+		ShieldComponent = nullptr;
+		return;
+	}
+
+	if (ShieldComponent->IsActive())
+	{
+		ShieldComponent->DeactivateImmediate();
+	}
+	ShieldComponent->ReleaseToPool();
+	ShieldComponent = nullptr;
+}
+
+void ACPP_Character::UpdateShieldCulling()
+{
+	if (!bShieldBuffIsActive)
+	{
+		DestroyShield();
+		return;
+	}
+
+	const float DistanceSquared = GetDistanceSquaredToLocalView();
+	bool bShouldBeShown = DistanceSquared <= FMath::Square(MaxShieldDistance);
+	if (bShouldBeShown)
+	{
+		// Shields of the cats that are closer to the views
+		// have priority.
+		int32 CloserShieldsNumber = 0;
+		for (TActorIterator<ACPP_Character> It(GetWorld()); It; ++It)
+		{
+			if (*It != this && It->bShieldBuffIsActive && It->GetDistanceSquaredToLocalView() < DistanceSquared)
+			{
+				CloserShieldsNumber++;
+			}
+		}
+		bShouldBeShown = CloserShieldsNumber < MaxShownShields;
+	}
+
+	if (bShouldBeShown)
 	{
-		NiagaraComponent->ActivateSystem();
+		SpawnShield();
+	}
+	else
+	{
+		DestroyShield();
 	}
 }
 
-void ACPP_Character::DestroyShield() const
+float ACPP_Character::GetDistanceSquaredToLocalView() const
 {
-	if (IsValid(NiagaraComponent) && NiagaraComponent->IsActive())
+	float MinDistanceSquared = TNumericLimits<float>::Max();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
 	{
-		NiagaraComponent->DeactivateImmediate();
+		if (const APlayerController* PC = It->Get(); IsValid(PC) && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			MinDistanceSquared = FMath::Min(MinDistanceSquared,
+			                                FVector::DistSquared(GetActorLocation(), ViewLocation));
+		}
 	}
+	return MinDistanceSquared;
 }
 
 void ACPP_Character::ChangeCharactersSliding(const bool bShouldSlide) const
@@ -540,6 +741,150 @@ void ACPP_Character::Multicast_CustomStopJumping_Implementation()
 	StopJumping();
 }
 
+void ACPP_Character::StopPlayingMovementSound()
+{
+	if (MovementSoundId != 0)
+	{
+		if (UCPP_SFXPool* SFXPool = GetWorld()->GetSubsystem<UCPP_SFXPool>(); IsValid(SFXPool))
+		{
+			SFXPool->StopSound(MovementSoundId);
+		}
+	}
+	MovementSoundId = 0;
+	CurrentMovementSound = ECatSoundState::None;
+}
+
+void ACPP_Character::StartPlayingCatSound(const ECatSoundState CatSound)
+{
+	UCPP_SFXPool* SFXPool = GetWorld()->GetSubsystem<UCPP_SFXPool>();
+	if (!IsValid(SFXPool))
+		return;
+
+	const bool bIsMovementSound = CatSound == ECatSoundState::BasicWalk ||
+		CatSound == ECatSoundState::BasicRun ||
+		CatSound == ECatSoundState::GrassWalk ||
+		CatSound == ECatSoundState::GrassRun;
+	if (bIsMovementSound)
+	{
+		if (CatSound == CurrentMovementSound && SFXPool->IsSoundPlaying(MovementSoundId))
+			return;
+
+		StopPlayingMovementSound();
+	}
+
+	USoundBase* const* Sound = CatSounds.Find(CatSound);
+	if (!Sound)
+		return;
+
+	const ESFXCategory Category = CatSound == ECatSoundState::Hiss || CatSound == ECatSoundState::Attack
+		                              ? ESFXCategory::Attack
+		                              : ESFXCategory::Footsteps;
+	const bool bIsRunSound = CatSound == ECatSoundState::BasicRun || CatSound == ECatSoundState::GrassRun;
+	const int32 SoundId = SFXPool->PlaySound(*Sound, Category, GetActorLocation(), GetRootComponent(),
+	                                         Cast<APlayerController>(GetController()),
+	                                         bIsRunSound ? RunSoundsPitchMultiplier : 1.0f);
+	if (bIsMovementSound)
+	{
+		MovementSoundId = SoundId;
+		CurrentMovementSound = CatSound;
+	}
+}
+
+ECatMovementSoundState ACPP_Character::CalculateMovementSoundState(bool& bOutIsOnGrass) const
+{
+	bOutIsOnGrass = false;
+
+	const UCharacterMovementComponent* Movement = GetCharacterMovement();
+	if (bIsJumping || Movement->IsFalling())
+		return ECatMovementSoundState::Air;
+
+	if (Movement->Velocity.IsZero())
+		return ECatMovementSoundState::Idle;
+
+	if (const AActor* FloorActor = Movement->CurrentFloor.HitResult.GetActor(); IsValid(FloorActor))
+	{
+		if (FloorActor->IsA<ACPP_SlipperyPlatform>())
+			return ECatMovementSoundState::Ice;
+
+		bOutIsOnGrass = FloorActor->IsA<ACPP_FallingPlatform>();
+	}
+	return bSprintNow ? ECatMovementSoundState::Sprint : ECatMovementSoundState::Walk;
+}
+
+void ACPP_Character::UpdateMovementSoundState()
+{
+	if (!IsLocallyControlled())
+		return;
+
+	bool bIsOnGrassNow;
+	const ECatMovementSoundState NewState = CalculateMovementSoundState(bIsOnGrassNow);
+	const bool bIsMoving = NewState == ECatMovementSoundState::Walk || NewState == ECatMovementSoundState::Sprint;
+
+	if (NewState == MovementSoundState && bIsOnGrassNow == bMovementSoundIsOnGrass)
+	{
+		// Non-looping movement sound should be restarted
+		// after it ends.
+		if (!bIsMoving)
+			return;
+		if (const UCPP_SFXPool* SFXPool = GetWorld()->GetSubsystem<UCPP_SFXPool>();
+			!IsValid(SFXPool) || SFXPool->IsSoundPlaying(MovementSoundId))
+			return;
+	}
+	MovementSoundState = NewState;
+	bMovementSoundIsOnGrass = bIsOnGrassNow;
+
+	if (bIsMoving)
+	{
+		if (NewState == ECatMovementSoundState::Sprint)
+		{
+			StartPlayingCatSound(bIsOnGrassNow ? ECatSoundState::GrassRun : ECatSoundState::BasicRun);
+		}
+		else
+		{
+			StartPlayingCatSound(bIsOnGrassNow ? ECatSoundState::GrassWalk : ECatSoundState::BasicWalk);
+		}
+	}
+	else
+	{
+		// The ice sound is played by the platform itself.
+		StopPlayingMovementSound();
+	}
+}
+
+void ACPP_Character::UpdateFloorPlatform(float DeltaSeconds, FVector OldLocation, FVector OldVelocity)
+{
+	const UCharacterMovementComponent* Movement = GetCharacterMovement();
+	AActor* FloorActor = nullptr;
+	if (Movement->IsMovingOnGround() && Movement->CurrentFloor.IsWalkableFloor())
+	{
+		FloorActor = Movement->CurrentFloor.HitResult.GetActor();
+	}
+	SetFloorPlatform(FloorActor);
+}
+
+void ACPP_Character::SetFloorPlatform(AActor* NewFloorActor)
+{
+	// Only the platforms with the interface are tracked.
+	if (!IsValid(NewFloorActor) || !NewFloorActor->Implements<UCPP_PlatformInterface>())
+	{
+		NewFloorActor = nullptr;
+	}
+	if (NewFloorActor == FloorPlatform.Get())
+		return;
+
+	AActor* OldFloorActor = FloorPlatform.Get();
+	FloorPlatform = NewFloorActor;
+
+	if (ICPP_PlatformInterface* OldPlatform = Cast<ICPP_PlatformInterface>(OldFloorActor))
+	{
+		OldPlatform->CharacterLeftPlatform(this);
+	}
+	if (ICPP_PlatformInterface* NewPlatform = Cast<ICPP_PlatformInterface>(NewFloorActor))
+	{
+		NewPlatform->CharacterEnteredPlatform(this);
+	}
+}
+
 void ACPP_Character::CheckForHittingTheGround()
 {
 	if (!bPressedJump && !GetMovementComponent()->IsFalling())
@@ -549,7 +894,7 @@ void ACPP_Character::CheckForHittingTheGround()
 			GetWorld()->GetTimerManager().ClearTimer(TH_CheckForHittingTheGround);
 		}
 		bIsJumping = false;
-		PlaySound(ECatSoundState::HitGround);
+		StartPlayingCatSound(ECatSoundState::HitGround);
 	}
 }
 
@@ -576,7 +921,7 @@ void ACPP_Character::Server_Attack_Implementation()
 
 void ACPP_Character::Multicast_Attack_Implementation()
 {
-	if (AnimInstance.IsValid() && IsValid(AttackMontage.LoadSynchronous()))
+	if (AnimInstance.IsValid() && IsValid(CAT_LOAD_SYNCHRONOUS(AttackMontage)))
 	{
 		bIsAttacking = true;
 		if (UAnimMontage* MontagePointer = AttackMontage.Get();
@@ -607,7 +952,7 @@ float ACPP_Character::TakeDamage(float DamageAmount, FDamageEvent const& DamageE
 		if (!AnimInstance->Montage_IsActive(ReceiveDamageMontage))
 		{
 			bIsReceivingDamage = true;
-			PlaySound(ECatSoundState::Hiss);
+			StartPlayingCatSound(ECatSoundState::Hiss);
 			AnimInstance->Montage_Play(ReceiveDamageMontage);
 			AnimInstance->Montage_SetEndDelegate(ReceiveDamageMontageEndedDelegate, ReceiveDamageMontage);
 		}
@@ -671,7 +1016,7 @@ void ACPP_Character::Multicast_CallApplyingDamage_Implementation()
 	}
 	if (OutOverlappingComponents.Num() > 0)
 	{
-		PlaySound(ECatSoundState::Attack);
+		StartPlayingCatSound(ECatSoundState::Attack);
 	}
 	const TArray<AActor*> IgnoreActors{};
 	UGameplayStatics::ApplyRadialDamage(GetWorld(), 100.0f, Origin, 20.0f,
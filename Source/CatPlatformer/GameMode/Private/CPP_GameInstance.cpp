@@ -18,6 +18,11 @@
 #include "CatPlatformer/GameMode/Classes/CPP_PlayerState.h"
 #endif
 
+#ifndef CPP_SYNCLOADDETECTOR_H
+#define CPP_SYNCLOADDETECTOR_H
+#include "CatPlatformer/Debug/Classes/CPP_SyncLoadDetector.h"
+#endif
+
 UCPP_GameInstance::UCPP_GameInstance()
 {
 	PlayingMode = EPlayingMode::SinglePlayer;
@@ -110,8 +115,18 @@ UClass* UCPP_GameInstance::GetWidgetClassBySoftReference(const TSoftClassPtr<UUs
 	return GetClassByAssetLoader(AssetToLoad);
 }
 
+TSharedPtr<FStreamableHandle> UCPP_GameInstance::RequestAsyncLoad(const FSoftObjectPath& AssetToLoad)
+{
+	if (AssetToLoad.IsNull())
+		return nullptr;
+
+	return AssetLoader.RequestAsyncLoad(AssetToLoad);
+}
+
 UClass* UCPP_GameInstance::GetClassByAssetLoader(const FSoftObjectPath& AssetToLoad)
 {
+	CAT_SYNC_LOAD_SCOPE();
+
 	AssetLoader.LoadSynchronous(AssetToLoad);
 	return Cast<UClass>(StaticLoadObject(UClass::StaticClass(),
 	                                     nullptr,
@@ -25,6 +25,16 @@
 #include "CatPlatformer/Net/Classes/CPP_GameSession.h"
 #endif
 
+#ifndef CPP_BOTCONTROLLER_H
+#define CPP_BOTCONTROLLER_H
+#include "CatPlatformer/AI/Bot/Classes/CPP_BotController.h"
+#endif
+
+#ifndef CPP_SOAKRECORDER_H
+#define CPP_SOAKRECORDER_H
+#include "CatPlatformer/Debug/Classes/CPP_SoakRecorder.h"
+#endif
+
 ACPP_GameMode::ACPP_GameMode()
 {
 	static ConstructorHelpers::FClassFinder<ACharacter> CharacterBPClass
@@ -63,8 +73,10 @@ ACPP_GameMode::ACPP_GameMode()
 	GameStateClass = ACPP_GameState::StaticClass();
 	PlayerStateClass = ACPP_PlayerState::StaticClass();
 	GameSessionClass = ACPP_GameSession::StaticClass();
+	BotControllerClass = ACPP_BotController::StaticClass();
 
 	PlatformSpawner = nullptr;
+	SoakRecorder = nullptr;
 	SpawnDistance = 100.0f;
 
 	GameStateRef = nullptr;
@@ -78,6 +90,12 @@ void ACPP_GameMode::BeginPlay()
 	Super::BeginPlay();
 
 	GameStateRef = GetGameState<ACPP_GameState>();
+
+	if (UCPP_SoakRecorder::IsRequestedFromCommandLine())
+	{
+		SoakRecorder = NewObject<UCPP_SoakRecorder>(this);
+		SoakRecorder->StartRecording(GetWorld());
+	}
 }
 
 void ACPP_GameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -87,6 +105,12 @@ void ACPP_GameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		GetWorld()->GetTimerManager().ClearTimer(TH_CallLoadingScreenDestroying);
 	}
 
+	if (IsValid(SoakRecorder))
+	{
+		SoakRecorder->StopRecording();
+		SoakRecorder = nullptr;
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -146,6 +170,16 @@ void ACPP_GameMode::PostLogin(APlayerController* NewPlayer)
 	                                       false);
 }
 
+APlayerController* ACPP_GameMode::SpawnPlayerController(ENetRole InRemoteRole, const FString& Options)
+{
+	if (BotControllerClass && UGameplayStatics::HasOption(Options, TEXT("Bot")))
+	{
+		return SpawnPlayerControllerCommon(InRemoteRole, FVector::ZeroVector, FRotator::ZeroRotator,
+		                                   BotControllerClass);
+	}
+	return Super::SpawnPlayerController(InRemoteRole, Options);
+}
+
 void ACPP_GameMode::PreLogout(const APlayerController* InPlayerController) const
 {
 	if (!IsValid(InPlayerController))
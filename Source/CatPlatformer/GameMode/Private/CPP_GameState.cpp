@@ -2,7 +2,6 @@
 
 #include "../Classes/CPP_GameState.h"
 #include "Engine/Engine.h"
-#include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
 
 #ifndef CPP_PLAYERCONTROLLER_H
@@ -17,23 +16,62 @@ class ACPP_PlayerController;
 #endif
 class ACPP_GameMode;
 
+#ifndef CPP_NETTRAFFICCOUNTER_H
+#define CPP_NETTRAFFICCOUNTER_H
+#include "CatPlatformer/Debug/Classes/CPP_NetTrafficCounter.h"
+#endif
+class UCPP_NetTrafficCounter;
+
 ACPP_GameState::ACPP_GameState()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 	SkyMaterialIndex = 0;
 	LevelNumber = 1;
+	MaxVictoryFireworks = 4;
+	MaxVictoryFireworkDistance = 6000.0f;
 }
 
 void ACPP_GameState::BeginPlay()
 {
 	Super::BeginPlay();
+
+	SpawnVictoryFireworksPool();
 }
 
 void ACPP_GameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	for (ACPP_VictoryFirework* Firework : VictoryFireworks)
+	{
+		if (IsValid(Firework))
+		{
+			Firework->Destroy();
+		}
+	}
+	VictoryFireworks.Empty();
+
 	Super::EndPlay(EndPlayReason);
 }
 
+void ACPP_GameState::SpawnVictoryFireworksPool()
+{
+	if (!VictoryFireworkClass || GetNetMode() == NM_DedicatedServer)
+		return;
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Owner = this;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	VictoryFireworks.Reserve(MaxVictoryFireworks);
+	for (int32 i = 0; i < MaxVictoryFireworks; i++)
+	{
+		if (ACPP_VictoryFirework* Firework = GetWorld()->SpawnActor<ACPP_VictoryFirework>(
+			VictoryFireworkClass, FTransform::Identity, SpawnParameters); IsValid(Firework))
+		{
+			VictoryFireworks.Add(Firework);
+		}
+	}
+}
+
 void ACPP_GameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -214,6 +252,13 @@ void ACPP_GameState::LevelWasEnded_Implementation()
 				       " PlayerState is not valid"));
 		}
 	}
+
+	// Saving the traffic of the whole level for the profiling.
+	if (UCPP_NetTrafficCounter* NetTrafficCounter = GetWorld()->GetSubsystem<UCPP_NetTrafficCounter>();
+		IsValid(NetTrafficCounter) && NetTrafficCounter->IsCounting())
+	{
+		NetTrafficCounter->DumpToCSV();
+	}
 }
 
 void ACPP_GameState::GetTheWinner(TArray<ACPP_PlayerState*>& OutWinners)
@@ -323,21 +368,55 @@ void ACPP_GameState::SpawnVictoryFireworks_Implementation(const TArray<ACPP_Play
 void ACPP_GameState::Multicast_SpawnVictoryFireworks_Implementation(const TArray<bool>& SoundsToPlay,
                                                                     const TArray<FVector>& FireworkLocations)
 {
-	for (auto It = FireworkLocations.CreateConstIterator(); It; ++It)
+	if (VictoryFireworks.Num() == 0)
+		return;
+
+	TArray<FVector> ViewLocations{};
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PC = It->Get(); IsValid(PC) && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	// Distance from every firework to the nearest local view
+	// point; the farthest fireworks are culled first.
+	TArray<TPair<float, FVector>> SortedLocations{};
+	SortedLocations.Reserve(FireworkLocations.Num());
+	const float MaxDistanceSquared = FMath::Square(MaxVictoryFireworkDistance);
+	for (const FVector& Location : FireworkLocations)
+	{
+		float MinDistanceSquared = ViewLocations.Num() > 0 ? TNumericLimits<float>::Max() : 0.0f;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(Location, ViewLocation));
+		}
+		if (MinDistanceSquared <= MaxDistanceSquared)
+		{
+			SortedLocations.Emplace(MinDistanceSquared, Location);
+		}
+	}
+	SortedLocations.Sort([](const TPair<float, FVector>& A, const TPair<float, FVector>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	int32 FireworkIndex = 0;
+	for (const TPair<float, FVector>& SortedLocation : SortedLocations)
 	{
-		ACPP_VictoryFirework* Firework = GetWorld()->SpawnActorDeferred<ACPP_VictoryFirework>(
-			VictoryFireworkClass,
-			FTransform::Identity,
-			nullptr,
-			nullptr,
-			ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
-
-		Firework->SoundsToPlay = SoundsToPlay;
-		Firework->SpawnLocation = *It;
-
-		UGameplayStatics::FinishSpawningActor(Firework, FTransform(FRotator(),
-		                                                           *It,
-		                                                           FVector(1.0f)));
+		while (FireworkIndex < VictoryFireworks.Num() &&
+			(!IsValid(VictoryFireworks[FireworkIndex]) || VictoryFireworks[FireworkIndex]->IsLaunched()))
+		{
+			FireworkIndex++;
+		}
+		if (FireworkIndex >= VictoryFireworks.Num())
+			break;
+
+		VictoryFireworks[FireworkIndex++]->Launch(SortedLocation.Value, SoundsToPlay);
 	}
 }
 
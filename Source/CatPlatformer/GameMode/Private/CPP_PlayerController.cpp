@@ -216,25 +216,6 @@ void ACPP_PlayerController::Move(const FInputActionValue& Value)
 			// Add movement.
 			CharacterRef->AddMovementInput(ForwardDirection, MovementVector.Y);
 			CharacterRef->AddMovementInput(RightDirection, MovementVector.X);
-			if (!CharacterRef->bIsJumping)
-			{
-				if (CharacterRef->GetIsOnGrass())
-				{
-					CharacterRef->PlaySound(CharacterRef->GetSprintNow()
-						                        ? ECatSoundState::GrassRun
-						                        : ECatSoundState::GrassWalk);
-				}
-				else
-				{
-					CharacterRef->PlaySound(CharacterRef->GetSprintNow()
-						                        ? ECatSoundState::BasicRun
-						                        : ECatSoundState::BasicWalk);
-				}
-			}
-			else
-			{
-				CharacterRef->StopAllMovementSounds();
-			}
 		}
 	}
 }
@@ -244,6 +225,10 @@ void ACPP_PlayerController::CheckVelocity()
 	if (bIsMainMenu || !IsValid(CharacterRef))
 		return;
 
+	// Movement sounds are switched only when the movement
+	// state (or the surface) changes.
+	CharacterRef->UpdateMovementSoundState();
+
 	if (!CharacterRef->GetCharacterMovement()->Velocity.IsZero())
 	{
 		if (bCharacterIsIdle)
@@ -254,7 +239,6 @@ void ACPP_PlayerController::CheckVelocity()
 	}
 	else
 	{
-		CharacterRef->StopAllMovementSounds();
 		if (!bCharacterIsIdle)
 		{
 			bCharacterIsIdle = true;
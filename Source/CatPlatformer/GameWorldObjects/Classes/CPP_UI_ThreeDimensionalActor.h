@@ -10,7 +10,10 @@
 
 /**
  * Actor that is needed to be shown as three-dimensional
- * object in widgets.
+ * object in widgets. The scene is captured only while at
+ * least one widget shows the actor and only when something
+ * has changed; otherwise the render target keeps the last
+ * captured frame.
  */
 UCLASS(Abstract)
 class CATPLATFORMER_API ACPP_UI_ThreeDimensionalActor : public AActor
@@ -42,7 +45,16 @@ protected:
 	 */
 	virtual void PostInitProperties() override;
 
+public:
+	/**
+	 * Function that is called every frame while the actor
+	 * is shown in any widget.
+	 * @param DeltaSeconds Frame time.
+	 */
+	virtual void Tick(float DeltaSeconds) override;
+
 	//==================Scene Components===========================
+protected:
 
 	/**
 	 * The root component for storing all other components
@@ -94,19 +106,117 @@ private:
 	 * Should be called by a looped timer.
 	 */
 	UFUNCTION()
-	void RotateThreeDimensionalObjectAxisX() const;
+	void RotateThreeDimensionalObjectAxisX();
 	/**
 	 * Function for rotating the Scene Component that contains
 	 * three-dimensional object around its own Y axis.
 	 * Should be called by a looped timer.
 	 */
 	UFUNCTION()
-	void RotateThreeDimensionalObjectAxisY() const;
+	void RotateThreeDimensionalObjectAxisY();
 	/**
 	 * Function for rotating the Scene Component that contains
 	 * three-dimensional object around its own Z axis.
 	 * Should be called by a looped timer.
 	 */
 	UFUNCTION()
-	void RotateThreeDimensionalObjectAxisZ() const;
+	void RotateThreeDimensionalObjectAxisZ();
+
+	/**
+	 * Function for starting the looped rotation timer (if
+	 * the actor should rotate).
+	 */
+	void StartRotation();
+
+	/** Function for stopping the rotation timer. */
+	void StopRotation();
+
+	//=====================Capturing===============================
+protected:
+	/**
+	 * Scale of the render target's resolution relative to
+	 * the displayed widget's size.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI Actor | Capture")
+	float CaptureResolutionScale;
+
+	/** Minimal side of the render target (in pixels). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI Actor | Capture")
+	int32 MinCaptureResolution;
+
+	/** Maximal side of the render target (in pixels). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI Actor | Capture")
+	int32 MaxCaptureResolution;
+
+	/**
+	 * Number of seconds between captures for the actors
+	 * with animated meshes (0 if the actor changes only by
+	 * rotation or by explicit requests).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI Actor | Capture")
+	float AnimatedCaptureInterval;
+
+private:
+	/** Number of widgets that show the actor right now. */
+	int32 PreviewViewersNumber;
+
+	/** Should the scene be captured during the next tick? */
+	bool bCaptureIsRequested;
+
+	/** Seconds since the last capture. */
+	float SecondsSinceLastCapture;
+
+	/** Number of captures made by all actors of this class. */
+	static uint32 CapturesNumber;
+
+	/** Number of ticks made by all actors of this class. */
+	static uint32 TicksNumber;
+
+protected:
+	/**
+	 * Function that is called when the actor starts or
+	 * stops being shown in widgets.
+	 * @param bIsVisible Is the actor shown now?
+	 */
+	virtual void PreviewVisibilityChanged(const bool bIsVisible);
+
+public:
+	/**
+	 * Function for notifying that new widget shows the
+	 * actor.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UI Actor | Capture")
+	void AddPreviewViewer();
+
+	/**
+	 * Function for notifying that the widget stopped
+	 * showing the actor.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UI Actor | Capture")
+	void RemovePreviewViewer();
+
+	/** Is the actor shown in any widget right now? */
+	UFUNCTION(BlueprintPure, Category = "UI Actor | Capture")
+	bool IsPreviewVisible() const { return PreviewViewersNumber > 0; }
+
+	/**
+	 * Function for asking to capture the scene during the
+	 * next tick (e.g. after changing the mesh's material).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UI Actor | Capture")
+	void RequestCapture();
+
+	/**
+	 * Function for resizing the render target up to the
+	 * size of the widget that shows it.
+	 * @param DisplayedSize Size of the widget in pixels.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UI Actor | Capture")
+	void SetDisplayedSize(const FVector2D& DisplayedSize);
+
+	/** Number of captures made by all actors of this class. */
+	static uint32 GetCapturesNumber() { return CapturesNumber; }
+
+	/** Number of ticks made by all actors of this class. */
+	static uint32 GetTicksNumber() { return TicksNumber; }
 };
@@ -33,6 +33,13 @@ protected:
 	 */
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	/**
+	 * Function for playing the shaking animation only while
+	 * the actor is shown in widgets.
+	 * @param bIsVisible Is the actor shown now?
+	 */
+	virtual void PreviewVisibilityChanged(const bool bIsVisible) override;
+
 	/** Static mesh for the platform's representation. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI Actor | Components",
 		meta = (AllowPrivateAccess = "true"))
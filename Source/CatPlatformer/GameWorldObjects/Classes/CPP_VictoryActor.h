@@ -45,12 +45,6 @@ protected:
 	 */
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	/** 
-	 * Function that is called every frame.
-	 * Is needed for updating platform's location.
-	 */
-	virtual void Tick(float DeltaSeconds) override;
-
 	/**
 	 * Returns the properties used for network replication.
 	 * @param OutLifetimeProps Lifetime properties.
@@ -141,13 +135,19 @@ private:
 	/** Timer Handle for the actor's rotation. */
 	FTimerHandle TH_Rotation;
 
+	/**
+	 * Identifier of the rotation's update in the tick budget
+	 * manager.
+	 */
+	int32 BudgetedUpdateId;
+
 	/** The actor's rotation speed. */
 	UPROPERTY(EditAnywhere, Category = "Victory Actor | Rotation", meta = (AllowPrivateAccess = true))
 	float RotationSpeed;
 
 	/**
 	 * Function for rotating the actor around its own axis.
-	 * Will be called by a looped timer.
+	 * Is called by the tick budget manager.
 	 */
 	UFUNCTION()
 	void RotateActorAroundItsAxis(const float DeltaSeconds);
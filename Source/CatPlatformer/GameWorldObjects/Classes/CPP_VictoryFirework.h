@@ -8,7 +8,12 @@
 #include "NiagaraComponent.h"
 #include "CPP_VictoryFirework.generated.h"
 
-/** Actor representing the victory firework. */
+/**
+ * Actor representing the victory firework. The actors are
+ * spawned in advance and are reused: the Niagara System is
+ * taken from the world's component pool on every launch
+ * and is returned to it when the firework finishes.
+ */
 UCLASS()
 class CATPLATFORMER_API ACPP_VictoryFirework : public AActor
 {
@@ -52,7 +57,6 @@ private:
 	UPROPERTY()
 	UNiagaraComponent* NiagaraComponent;
 
-public:
 	/** Location to spawn sound and the niagara effect. */
 	FVector SpawnLocation;
 
@@ -62,6 +66,26 @@ public:
 	 */
 	TArray<bool> SoundsToPlay;
 
+public:
+	/**
+	 * Function for launching the firework.
+	 * @param Location Location of the firework.
+	 * @param InSoundsToPlay Flags indicating which sound
+	 * should be spawned in every new explosion.
+	 * @return True if the effect was spawned (it could be
+	 * culled by the effect's scalability settings).
+	 */
+	bool Launch(const FVector& Location, const TArray<bool>& InSoundsToPlay);
+
+	/**
+	 * Function for stopping the firework and for returning
+	 * its Niagara Component to the pool.
+	 */
+	void Stop();
+
+	/** Function for checking if the firework is launched. */
+	bool IsLaunched() const;
+
 private:
 	/** Current number of firework explosions. */
 	int8 FireworkExplosionsCounter;
@@ -79,6 +103,12 @@ private:
 	UFUNCTION()
 	void OnFireworkSystemFinished(UNiagaraComponent* PSystem);
 
+	/**
+	 * Function for returning the Niagara Component to the
+	 * pool.
+	 */
+	void ReleaseFireworkSystem();
+
 	/** Function for clearing the timer. */
 	void ClearSoundSpawningTimer();
 };
@@ -1,16 +1,34 @@
 ﻿// (c) M. A. Shalaeva, 2024
 
 #include "../Classes/CPP_UI_ThreeDimensionalActor.h"
+#include "Engine/TextureRenderTarget2D.h"
+
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+uint32 ACPP_UI_ThreeDimensionalActor::CapturesNumber = 0;
+uint32 ACPP_UI_ThreeDimensionalActor::TicksNumber = 0;
 
 ACPP_UI_ThreeDimensionalActor::ACPP_UI_ThreeDimensionalActor()
 {
+	// The actor ticks only while it is shown in widgets.
 	PrimaryActorTick.bCanEverTick = true;
-	SetActorTickInterval(0.025);
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	SceneComponentRotationSpeed = 3.5f;
 	RotationAxis = FString(TEXT("Z"));
 	bShouldRotate = true;
 
+	CaptureResolutionScale = 1.0f;
+	MinCaptureResolution = 64;
+	MaxCaptureResolution = 1024;
+	AnimatedCaptureInterval = 0.0f;
+	PreviewViewersNumber = 0;
+	bCaptureIsRequested = false;
+	SecondsSinceLastCapture = 0.0f;
+
 	Root = CreateDefaultSubobject<USceneComponent>(FName(TEXT("Root")));
 	SetRootComponent(Root);
 
@@ -25,47 +43,15 @@ void ACPP_UI_ThreeDimensionalActor::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (bShouldRotate)
-	{
-		if (RotationAxis.Equals(FString(TEXT("X"))))
-		{
-			GetWorld()->GetTimerManager().SetTimer(
-				TH_SceneComponentRotation,
-				this,
-				&ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisX,
-				0.05f,
-				true);
-		}
-		else if (RotationAxis.Equals(FString(TEXT("Y"))))
-		{
-			GetWorld()->GetTimerManager().SetTimer(
-				TH_SceneComponentRotation,
-				this,
-				&ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisY,
-				0.05f,
-				true);
-		}
-		else
-		{
-			GetWorld()->GetTimerManager().SetTimer(
-				TH_SceneComponentRotation,
-				this,
-				&ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisZ,
-				0.05f,
-				true);
-		}
-	}
+	// The first frame is captured anyway, so the render
+	// target isn't empty when the widget appears.
+	RequestCapture();
+	SetActorTickEnabled(true);
 }
 
 void ACPP_UI_ThreeDimensionalActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (bShouldRotate)
-	{
-		if (GetWorld()->GetTimerManager().TimerExists(TH_SceneComponentRotation))
-		{
-			GetWorld()->GetTimerManager().ClearTimer(TH_SceneComponentRotation);
-		}
-	}
+	StopRotation();
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -75,19 +61,157 @@ void ACPP_UI_ThreeDimensionalActor::PostInitProperties()
 
 	SceneCaptureComponent2D->SetRelativeRotation(FRotator(0.0f, -90.0f, 0.0f));
 	SceneCaptureComponent2D->FOVAngle = 45.0f;
+	SceneCaptureComponent2D->bCaptureEveryFrame = false;
+	SceneCaptureComponent2D->bCaptureOnMovement = false;
+}
+
+void ACPP_UI_ThreeDimensionalActor::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	TicksNumber++;
+
+	SecondsSinceLastCapture += DeltaSeconds;
+	if (AnimatedCaptureInterval > 0.0f && SecondsSinceLastCapture >= AnimatedCaptureInterval)
+	{
+		bCaptureIsRequested = true;
+	}
+
+	if (bCaptureIsRequested)
+	{
+		CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_PreviewCapture);
+
+		SceneCaptureComponent2D->CaptureScene();
+		bCaptureIsRequested = false;
+		SecondsSinceLastCapture = 0.0f;
+		CapturesNumber++;
+		INC_DWORD_STAT(STAT_Cat_PreviewCaptures);
+	}
+
+	if (!IsPreviewVisible())
+	{
+		SetActorTickEnabled(false);
+	}
 }
 
-void ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisX() const
+void ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisX()
 {
 	ComponentToRotate->AddLocalRotation(FRotator(0.0f, 0.0f, SceneComponentRotationSpeed));
+	RequestCapture();
 }
 
-void ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisY() const
+void ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisY()
 {
 	ComponentToRotate->AddLocalRotation(FRotator(SceneComponentRotationSpeed, 0.0f, 0.0f));
+	RequestCapture();
 }
 
-void ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisZ() const
+void ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisZ()
 {
 	ComponentToRotate->AddLocalRotation(FRotator(0.0f, SceneComponentRotationSpeed, 0.0f));
+	RequestCapture();
+}
+
+void ACPP_UI_ThreeDimensionalActor::StartRotation()
+{
+	if (!bShouldRotate || GetWorld()->GetTimerManager().TimerExists(TH_SceneComponentRotation))
+		return;
+
+	if (RotationAxis.Equals(FString(TEXT("X"))))
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			TH_SceneComponentRotation,
+			this,
+			&ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisX,
+			0.05f,
+			true);
+	}
+	else if (RotationAxis.Equals(FString(TEXT("Y"))))
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			TH_SceneComponentRotation,
+			this,
+			&ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisY,
+			0.05f,
+			true);
+	}
+	else
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			TH_SceneComponentRotation,
+			this,
+			&ACPP_UI_ThreeDimensionalActor::RotateThreeDimensionalObjectAxisZ,
+			0.05f,
+			true);
+	}
+}
+
+void ACPP_UI_ThreeDimensionalActor::StopRotation()
+{
+	if (GetWorld()->GetTimerManager().TimerExists(TH_SceneComponentRotation))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_SceneComponentRotation);
+	}
+}
+
+void ACPP_UI_ThreeDimensionalActor::PreviewVisibilityChanged(const bool bIsVisible)
+{
+	if (bIsVisible)
+	{
+		StartRotation();
+		RequestCapture();
+	}
+	else
+	{
+		StopRotation();
+	}
+}
+
+void ACPP_UI_ThreeDimensionalActor::AddPreviewViewer()
+{
+	PreviewViewersNumber++;
+	if (PreviewViewersNumber == 1)
+	{
+		PreviewVisibilityChanged(true);
+	}
+}
+
+void ACPP_UI_ThreeDimensionalActor::RemovePreviewViewer()
+{
+	if (PreviewViewersNumber == 0)
+		return;
+
+	PreviewViewersNumber--;
+	if (PreviewViewersNumber == 0)
+	{
+		PreviewVisibilityChanged(false);
+	}
+}
+
+void ACPP_UI_ThreeDimensionalActor::RequestCapture()
+{
+	bCaptureIsRequested = true;
+
+	// Tick is turned off again after the capture if no
+	// widget shows the actor.
+	SetActorTickEnabled(true);
+}
+
+void ACPP_UI_ThreeDimensionalActor::SetDisplayedSize(const FVector2D& DisplayedSize)
+{
+	UTextureRenderTarget2D* RenderTarget = SceneCaptureComponent2D->TextureTarget;
+	if (!IsValid(RenderTarget) || DisplayedSize.IsNearlyZero())
+		return;
+
+	const int32 NewSizeX = FMath::Clamp(FMath::RoundToInt32(DisplayedSize.X * CaptureResolutionScale),
+	                                    MinCaptureResolution,
+	                                    MaxCaptureResolution);
+	const int32 NewSizeY = FMath::Clamp(FMath::RoundToInt32(DisplayedSize.Y * CaptureResolutionScale),
+	                                    MinCaptureResolution,
+	                                    MaxCaptureResolution);
+	if (RenderTarget->SizeX != NewSizeX || RenderTarget->SizeY != NewSizeY)
+	{
+		RenderTarget->ResizeTarget(NewSizeX, NewSizeY);
+		RequestCapture();
+	}
 }
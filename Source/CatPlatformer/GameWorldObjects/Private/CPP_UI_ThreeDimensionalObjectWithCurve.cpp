@@ -29,7 +29,10 @@ void ACPP_UI_ThreeDimensionalObjectWithCurve::BeginPlay()
 		TimelineComp->AddInterpVector(CurveVector, TimelineProgressDelegate);
 		TimelineComp->SetLooping(true);
 		TimelineComp->SetIgnoreTimeDilation(true);
-		TimelineComp->PlayFromStart();
+		if (IsPreviewVisible())
+		{
+			TimelineComp->PlayFromStart();
+		}
 	}
 }
 
@@ -43,10 +46,28 @@ void ACPP_UI_ThreeDimensionalObjectWithCurve::EndPlay(const EEndPlayReason::Type
 	Super::EndPlay(EndPlayReason);
 }
 
+void ACPP_UI_ThreeDimensionalObjectWithCurve::PreviewVisibilityChanged(const bool bIsVisible)
+{
+	Super::PreviewVisibilityChanged(bIsVisible);
+
+	if (!CurveVector || !HasActorBegunPlay())
+		return;
+
+	if (bIsVisible)
+	{
+		TimelineComp->Play();
+	}
+	else
+	{
+		TimelineComp->Stop();
+	}
+}
+
 void ACPP_UI_ThreeDimensionalObjectWithCurve::ShakingTimelineProgress(FVector Value)
 {
 	const FRotator NewRotation = FRotator(FMath::Lerp(StartRotation.Pitch, EndRotation.Pitch, Value.Y),
 	                                      FMath::Lerp(StartRotation.Yaw, EndRotation.Yaw, Value.Z),
 	                                      FMath::Lerp(StartRotation.Roll, EndRotation.Roll, Value.X));
 	PlatformBase->SetRelativeRotation(NewRotation);
+	RequestCapture();
 }
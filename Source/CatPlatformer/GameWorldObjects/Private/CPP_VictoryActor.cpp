@@ -10,14 +10,25 @@
 #endif
 class ACPP_GameState;
 
+#ifndef CPP_SIGNIFICANCEMANAGER_H
+#define CPP_SIGNIFICANCEMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_SignificanceManager.h"
+#endif
+
+#ifndef CPP_TICKBUDGETMANAGER_H
+#define CPP_TICKBUDGETMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_TickBudgetManager.h"
+#endif
+
 ACPP_VictoryActor::ACPP_VictoryActor() : ScoreToAdd(30),
                                          SpawningOffset(FVector(-34.0f, -38.0f, 255.0f)),
+                                         BudgetedUpdateId(0),
                                          RotationSpeed(4.4f),
                                          StartPosition(FVector(0.0f)),
                                          EndPosition(FVector(0.0f)),
                                          ZPositionOffset(30.0f)
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
 	SetRootComponent(Root);
@@ -47,6 +58,20 @@ void ACPP_VictoryActor::BeginPlay()
 
 	SM_Base->OnComponentBeginOverlap.AddUniqueDynamic(this, &ACPP_VictoryActor::StaticMeshOverlapBegin);
 
+	if (UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+		IsValid(SignificanceManager))
+	{
+		SignificanceManager->RegisterActor(this);
+	}
+
+	if (UCPP_TickBudgetManager* TickBudgetManager = GetWorld()->GetSubsystem<UCPP_TickBudgetManager>();
+		IsValid(TickBudgetManager))
+	{
+		BudgetedUpdateId = TickBudgetManager->RegisterUpdate(
+			this, FBudgetedUpdate::CreateUObject(this, &ACPP_VictoryActor::RotateActorAroundItsAxis),
+			ETickBudgetPriority::Normal);
+	}
+
 	if (HasAuthority() && SmoothZMovementCurveFloat)
 	{
 		TimelineComp->Play();
@@ -56,6 +81,18 @@ void ACPP_VictoryActor::BeginPlay()
 void ACPP_VictoryActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	SM_Base->OnComponentBeginOverlap.RemoveDynamic(this, &ACPP_VictoryActor::StaticMeshOverlapBegin);
+	if (UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+		IsValid(SignificanceManager))
+	{
+		SignificanceManager->UnregisterActor(this);
+	}
+
+	if (UCPP_TickBudgetManager* TickBudgetManager = GetWorld()->GetSubsystem<UCPP_TickBudgetManager>();
+		IsValid(TickBudgetManager))
+	{
+		TickBudgetManager->UnregisterUpdate(BudgetedUpdateId);
+		BudgetedUpdateId = 0;
+	}
 
 	if (HasAuthority())
 	{
@@ -65,12 +102,6 @@ void ACPP_VictoryActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
-void ACPP_VictoryActor::Tick(float DeltaSeconds)
-{
-	Super::Tick(DeltaSeconds);
-	RotateActorAroundItsAxis(DeltaSeconds);
-}
-
 void ACPP_VictoryActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
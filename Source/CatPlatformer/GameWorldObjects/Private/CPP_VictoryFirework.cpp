@@ -2,7 +2,11 @@
 
 #include "../Classes/CPP_VictoryFirework.h"
 #include "NiagaraFunctionLibrary.h"
-#include "Kismet/GameplayStatics.h"
+
+#ifndef CPP_SFXPOOL_H
+#define CPP_SFXPOOL_H
+#include "CatPlatformer/Sound/Classes/CPP_SFXPool.h"
+#endif
 
 ACPP_VictoryFirework::ACPP_VictoryFirework() : FireworkSoundCue0(nullptr),
                                                FireworkSoundCue1(nullptr),
@@ -17,39 +21,67 @@ void ACPP_VictoryFirework::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (NS_Firework->IsValid())
+	// Warming up the pool, so the first launch doesn't
+	// create the component at the victory moment.
+	if (IsValid(NS_Firework) && GetNetMode() != NM_DedicatedServer)
 	{
-		NiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(), NS_Firework, SpawnLocation, FRotator(),
-			FVector(1.0f), true, true,
-			ENCPoolMethod::None, true);
-
-		if (IsValid(NiagaraComponent) && !NiagaraComponent->OnSystemFinished.IsAlreadyBound(
-			this, &ACPP_VictoryFirework::OnFireworkSystemFinished))
+		if (UNiagaraComponent* WarmUpComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+			GetWorld(), NS_Firework, GetActorLocation(), FRotator::ZeroRotator,
+			FVector(1.0f), false, false,
+			ENCPoolMethod::ManualRelease, false); IsValid(WarmUpComponent))
 		{
-			NiagaraComponent->OnSystemFinished.AddUniqueDynamic(this, &ACPP_VictoryFirework::OnFireworkSystemFinished);
+			WarmUpComponent->ReleaseToPool();
 		}
-
-		GetWorld()->GetTimerManager().SetTimer(TH_SoundSpawning,
-		                                       this,
-		                                       &ACPP_VictoryFirework::SpawnSound,
-		                                       2.0f,
-		                                       true,
-		                                       0.0f);
 	}
 }
 
 void ACPP_VictoryFirework::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (IsValid(NiagaraComponent) && NiagaraComponent->OnSystemFinished.IsAlreadyBound(
-		this, &ACPP_VictoryFirework::OnFireworkSystemFinished))
-	{
-		NiagaraComponent->OnSystemFinished.RemoveDynamic(this, &ACPP_VictoryFirework::OnFireworkSystemFinished);
-	}
-	ClearSoundSpawningTimer();
+	Stop();
 	Super::EndPlay(EndPlayReason);
 }
 
+bool ACPP_VictoryFirework::Launch(const FVector& Location, const TArray<bool>& InSoundsToPlay)
+{
+	Stop();
+
+	if (!IsValid(NS_Firework) || !NS_Firework->IsValid())
+		return false;
+
+	SpawnLocation = Location;
+	SoundsToPlay = InSoundsToPlay;
+	FireworkExplosionsCounter = 0;
+	SetActorLocation(SpawnLocation);
+
+	NiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		GetWorld(), NS_Firework, SpawnLocation, FRotator::ZeroRotator,
+		FVector(1.0f), false, true,
+		ENCPoolMethod::ManualRelease, true);
+	if (!IsValid(NiagaraComponent))
+		return false;
+
+	NiagaraComponent->OnSystemFinished.AddUniqueDynamic(this, &ACPP_VictoryFirework::OnFireworkSystemFinished);
+
+	GetWorld()->GetTimerManager().SetTimer(TH_SoundSpawning,
+	                                       this,
+	                                       &ACPP_VictoryFirework::SpawnSound,
+	                                       2.0f,
+	                                       true,
+	                                       0.0f);
+	return true;
+}
+
+void ACPP_VictoryFirework::Stop()
+{
+	ClearSoundSpawningTimer();
+	ReleaseFireworkSystem();
+}
+
+bool ACPP_VictoryFirework::IsLaunched() const
+{
+	return IsValid(NiagaraComponent);
+}
+
 void ACPP_VictoryFirework::SpawnSound()
 {
 	FireworkExplosionsCounter++;
@@ -57,19 +89,10 @@ void ACPP_VictoryFirework::SpawnSound()
 	{
 		if (SoundsToPlay.Num() >= FireworkExplosionsCounter)
 		{
-			if (SoundsToPlay[FireworkExplosionsCounter - 1])
-			{
-				if (IsValid(FireworkSoundCue1))
-				{
-					UGameplayStatics::SpawnSoundAtLocation(GetWorld(), FireworkSoundCue1, SpawnLocation);
-				}
-			}
-			else
+			if (UCPP_SFXPool* SFXPool = GetWorld()->GetSubsystem<UCPP_SFXPool>(); IsValid(SFXPool))
 			{
-				if (IsValid(FireworkSoundCue0))
-				{
-					UGameplayStatics::SpawnSoundAtLocation(GetWorld(), FireworkSoundCue0, SpawnLocation);
-				}
+				SFXPool->PlaySound(SoundsToPlay[FireworkExplosionsCounter - 1] ? FireworkSoundCue1 : FireworkSoundCue0,
+				                   ESFXCategory::Firework, SpawnLocation);
 			}
 		}
 	}
@@ -82,6 +105,24 @@ void ACPP_VictoryFirework::SpawnSound()
 void ACPP_VictoryFirework::OnFireworkSystemFinished(UNiagaraComponent* PSystem)
 {
 	ClearSoundSpawningTimer();
+	ReleaseFireworkSystem();
+}
+
+void ACPP_VictoryFirework::ReleaseFireworkSystem()
+{
+	if (!IsValid(NiagaraComponent))
+	{
+		NiagaraComponent = nullptr;
+		return;
+	}
+
+	NiagaraComponent->OnSystemFinished.RemoveDynamic(this, &ACPP_VictoryFirework::OnFireworkSystemFinished);
+	if (NiagaraComponent->IsActive())
+	{
+		NiagaraComponent->DeactivateImmediate();
+	}
+	NiagaraComponent->ReleaseToPool();
+	NiagaraComponent = nullptr;
 }
 
 void ACPP_VictoryFirework::ClearSoundSpawningTimer()
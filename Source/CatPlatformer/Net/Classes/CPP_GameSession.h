@@ -197,7 +197,78 @@ private:
 	/** Code of the session we are looking for. */
 	FString SearchingPrivateSessionCode;
 
+	//=================Sessions' search cache======================
+
+	/**
+	 * Results of the last successful public sessions'
+	 * search. Are passed to the browser instantly while
+	 * they are fresh.
+	 */
+	TSharedPtr<FOnlineSessionSearch> CachedPublicSessions;
+
+	/** Time (in seconds) when the cache was filled. */
+	double CachedPublicSessionsTime;
+
+	/** Were the cached sessions found on the local network? */
+	bool bCachedPublicSessionsAreLAN;
+
+	/**
+	 * How long (in seconds) the cached search results are
+	 * considered fresh.
+	 */
+	UPROPERTY(Config)
+	float SessionsCacheLifetime;
+
+	/**
+	 * Function for checking if the cached search results
+	 * can be shown to the player.
+	 * @param bIsLAN Are we looking on the local network?
+	 * @return True if the cache isn't empty and isn't
+	 * outdated.
+	 */
+	bool IsPublicSessionsCacheFresh(const bool bIsLAN) const;
+
+	/**
+	 * Function for removing unsuitable search results in a
+	 * single pass (the order of the rest results is kept).
+	 * Duplicates of the same session are removed too. Is
+	 * used only for LAN results, because online queries
+	 * already apply the query settings. Integer settings are read as int64, because they are
+	 * stored so (EOS keeps all integers as int64).
+	 * @param Results Search results to filter.
+	 * @param bPublicOnly Should private sessions be removed?
+	 * @param RoomNumber If not empty, only the session with
+	 * this room number is kept.
+	 * @param OutSessionIdIndex Indices of the kept results
+	 * by the session ID.
+	 * @param OutRoomNumberIndex Indices of the kept results
+	 * by the room number.
+	 */
+	static void FilterSearchResults(TArray<FOnlineSessionSearchResult>& Results,
+	                                const bool bPublicOnly,
+	                                const FString& RoomNumber,
+	                                TMap<FString, int32>& OutSessionIdIndex,
+	                                TMap<FString, int32>& OutRoomNumberIndex);
+
 public:
+#if !UE_BUILD_SHIPPING
+	/**
+	 * Function for checking FilterSearchResults on the
+	 * fabricated search results (with the session IDs of the
+	 * Null online subsystem). Is called by the
+	 * «Cat.TestSessionsFilter» console command.
+	 * @return True if all checks have passed.
+	 */
+	static bool TestSearchResultsFilter();
+#endif
+
+	/**
+	 * Function for forgetting the cached search results
+	 * (for example, when the list of sessions is known to
+	 * have changed).
+	 */
+	void InvalidatePublicSessionsCache();
+
 	/**
 	 * Function for working with external online subsystems
 	 * for finding other players.
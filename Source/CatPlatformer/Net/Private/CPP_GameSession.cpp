@@ -5,12 +5,20 @@
 #include "OnlineSubsystemUtils.h"
 #include "Online/OnlineSessionNames.h"
 
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
 ACPP_GameSession::ACPP_GameSession() : GameInstanceRef(nullptr),
                                        GameModeRef(nullptr),
                                        bSearchingForLANSession(false),
-                                       bSearchingForPublicSession(false)
+                                       bSearchingForPublicSession(false),
+                                       CachedPublicSessionsTime(0.0),
+                                       bCachedPublicSessionsAreLAN(false),
+                                       SessionsCacheLifetime(30.0f)
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	MaxPlayers = 4;
 	MaxSplitscreensPerConnection = 2;
@@ -200,6 +208,8 @@ void ACPP_GameSession::LoginToEOS()
 void ACPP_GameSession::OnLoginCompleteCustom(int32 InLocalUserNum, bool bWasSuccessful, const FUniqueNetId& InUserId,
                                              const FString& Error)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SessionCallback);
+
 	// Getting the online subsystem.
 	const IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get();
 	if (!OnlineSub)
@@ -315,14 +325,16 @@ void ACPP_GameSession::CreateSession(const FString& PlayerName, bool bPublicServ
 		// 0 - Is public
 		// 1 - Is private
 		Settings->Set(FName(TEXT("SESSION_PRIVACY")),
-		              FOnlineSessionSetting(0, EOnlineDataAdvertisementType::ViaOnlineService));
+		              FOnlineSessionSetting(static_cast<int64>(0),
+		                                    EOnlineDataAdvertisementType::ViaOnlineService));
 	}
 	else
 	{
 		// 0 - Is public
 		// 1 - Is private
 		Settings->Set(FName(TEXT("SESSION_PRIVACY")),
-		              FOnlineSessionSetting(1, EOnlineDataAdvertisementType::ViaOnlineService));
+		              FOnlineSessionSetting(static_cast<int64>(1),
+		                                    EOnlineDataAdvertisementType::ViaOnlineService));
 	}
 
 	SessionName = UserSessionName;
@@ -336,6 +348,8 @@ void ACPP_GameSession::CreateSession(const FString& PlayerName, bool bPublicServ
 
 void ACPP_GameSession::OnCreateSessionComplete(FName InSessionName, bool bWasSuccessful)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SessionCallback);
+
 	UE_LOG(LogTemp, Warning, TEXT("OnCreateSessionComplete, Success = %hhd"), bWasSuccessful);
 
 	// Getting the online subsystem.
@@ -374,6 +388,8 @@ void ACPP_GameSession::OnCreateSessionComplete(FName InSessionName, bool bWasSuc
 
 void ACPP_GameSession::OnStartOnlineGameComplete(FName InSessionName, bool bWasSuccessful)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SessionCallback);
+
 	// Getting the online subsystem.
 	const IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get();
 	if (!OnlineSub)
@@ -413,7 +429,7 @@ void ACPP_GameSession::FindSessions(FUniqueNetIdRepl UserId, bool bIsLAN)
 	{
 		if (GameInstanceRef.IsValid() && GameInstanceRef->FindingSessionsCompletedDelegate.IsBound())
 		{
-			GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr);
+			GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr, false);
 		}
 		return;
 	}
@@ -424,7 +440,7 @@ void ACPP_GameSession::FindSessions(FUniqueNetIdRepl UserId, bool bIsLAN)
 	{
 		if (GameInstanceRef.IsValid() && GameInstanceRef->FindingSessionsCompletedDelegate.IsBound())
 		{
-			GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr);
+			GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr, false);
 		}
 		return;
 	}
@@ -444,6 +460,14 @@ void ACPP_GameSession::FindSessions(FUniqueNetIdRepl UserId, bool bIsLAN)
 		OnFindSessionsCompleteDelegate.Unbind();
 	}
 
+	// Showing the cached results instantly, the search below
+	// refreshes them in the background.
+	if (IsPublicSessionsCacheFresh(bIsLAN) &&
+		GameInstanceRef.IsValid() && GameInstanceRef->FindingSessionsCompletedDelegate.IsBound())
+	{
+		GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(CachedPublicSessions, true);
+	}
+
 	SearchSettings.Reset();
 	SearchSettings = MakeShareable(new FOnlineSessionSearch());
 
@@ -456,7 +480,7 @@ void ACPP_GameSession::FindSessions(FUniqueNetIdRepl UserId, bool bIsLAN)
 
 	// 0 - Is public
 	// 1 - Is private
-	SearchSettings->QuerySettings.Set(FName(TEXT("SESSION_PRIVACY")), 0,
+	SearchSettings->QuerySettings.Set(FName(TEXT("SESSION_PRIVACY")), static_cast<int64>(0),
 	                                  EOnlineComparisonOp::Equals);
 
 	SearchSettings->bIsLanQuery = bIsLAN;
@@ -477,13 +501,15 @@ void ACPP_GameSession::FindSessions(FUniqueNetIdRepl UserId, bool bIsLAN)
 
 void ACPP_GameSession::OnFindSessionsComplete(bool bWasSuccessful)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SessionCallback);
+
 	UE_LOG(LogTemp, Warning, TEXT("OnFindSessionsComplete, Success = %hhd"), bWasSuccessful);
 
 	// Getting the online subsystem.
 	const IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get();
 	if (!OnlineSub)
 	{
-		GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr);
+		GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr, false);
 		return;
 	}
 
@@ -491,7 +517,7 @@ void ACPP_GameSession::OnFindSessionsComplete(bool bWasSuccessful)
 	const IOnlineSessionPtr Sessions = OnlineSub->GetSessionInterface();
 	if (!Sessions.IsValid())
 	{
-		GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr);
+		GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr, false);
 		return;
 	}
 
@@ -503,27 +529,101 @@ void ACPP_GameSession::OnFindSessionsComplete(bool bWasSuccessful)
 		OnFindSessionsCompleteDelegate.Unbind();
 	}
 
-	// If the number of sessions found is not zero.
-	if (bWasSuccessful && SearchSettings->SearchResults.Num() > 0)
+	if (bWasSuccessful && SearchSettings.IsValid())
 	{
+		// LAN queries ignore the query settings, so private
+		// sessions have to be removed here.
 		if (bSearchingForLANSession)
 		{
-			for (int32 SearchIdx = 0; SearchIdx < SearchSettings->SearchResults.Num(); SearchIdx++)
-			{
-				if (bSearchingForPublicSession &&
-					SearchSettings->SearchResults[SearchIdx].Session.SessionSettings.Settings.FindRef(
-						FName(TEXT("SESSION_PRIVACY"))).Data == 1)
-				{
-					SearchSettings->SearchResults.RemoveAt(SearchIdx);
-					SearchIdx--;
-				}
-			}
+			TMap<FString, int32> SessionIdIndex;
+			TMap<FString, int32> RoomNumberIndex;
+			FilterSearchResults(SearchSettings->SearchResults, bSearchingForPublicSession, FString(),
+			                    SessionIdIndex, RoomNumberIndex);
+		}
+
+		// If the number of sessions found is not zero.
+		if (SearchSettings->SearchResults.Num() > 0)
+		{
+			CachedPublicSessions = SearchSettings;
+			CachedPublicSessionsTime = FPlatformTime::Seconds();
+			bCachedPublicSessionsAreLAN = bSearchingForLANSession;
+
+			GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(SearchSettings, false);
+			return;
 		}
-		GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(SearchSettings);
-		return;
 	}
 
-	GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr);
+	InvalidatePublicSessionsCache();
+	GameInstanceRef->FindingSessionsCompletedDelegate.Broadcast(nullptr, false);
+}
+
+bool ACPP_GameSession::IsPublicSessionsCacheFresh(const bool bIsLAN) const
+{
+	return CachedPublicSessions.IsValid() &&
+		CachedPublicSessions->SearchResults.Num() > 0 &&
+		bCachedPublicSessionsAreLAN == bIsLAN &&
+		FPlatformTime::Seconds() - CachedPublicSessionsTime <= SessionsCacheLifetime;
+}
+
+void ACPP_GameSession::InvalidatePublicSessionsCache()
+{
+	CachedPublicSessions.Reset();
+	CachedPublicSessionsTime = 0.0;
+}
+
+void ACPP_GameSession::FilterSearchResults(TArray<FOnlineSessionSearchResult>& Results,
+                                           const bool bPublicOnly,
+                                           const FString& RoomNumber,
+                                           TMap<FString, int32>& OutSessionIdIndex,
+                                           TMap<FString, int32>& OutRoomNumberIndex)
+{
+	OutSessionIdIndex.Reset();
+	OutRoomNumberIndex.Reset();
+	OutSessionIdIndex.Reserve(Results.Num());
+	OutRoomNumberIndex.Reserve(Results.Num());
+
+	// Suitable results are moved to the beginning of the
+	// array, so every result is visited only once.
+	int32 KeptNumber = 0;
+	for (int32 SearchIdx = 0; SearchIdx < Results.Num(); SearchIdx++)
+	{
+		FOnlineSessionSearchResult& Result = Results[SearchIdx];
+		if (!Result.IsValid())
+			continue;
+
+		const FOnlineSessionSettings& Settings = Result.Session.SessionSettings;
+
+		if (bPublicOnly)
+		{
+			int64 Privacy = 0;
+			Settings.Get(FName(TEXT("SESSION_PRIVACY")), Privacy);
+			if (Privacy == 1)
+				continue;
+		}
+
+		FString ResultRoomNumber;
+		Settings.Get(FName(TEXT("ROOM_NUMBER")), ResultRoomNumber);
+		if (!RoomNumber.IsEmpty() && ResultRoomNumber != RoomNumber)
+			continue;
+
+		// The same session can be reported several times
+		// (for example, by several LAN beacons).
+		const FString SessionId = Result.GetSessionIdStr();
+		if (OutSessionIdIndex.Contains(SessionId))
+			continue;
+
+		if (SearchIdx != KeptNumber)
+		{
+			Results[KeptNumber] = MoveTemp(Result);
+		}
+		OutSessionIdIndex.Emplace(SessionId, KeptNumber);
+		if (!ResultRoomNumber.IsEmpty())
+		{
+			OutRoomNumberIndex.Emplace(ResultRoomNumber, KeptNumber);
+		}
+		KeptNumber++;
+	}
+	Results.SetNum(KeptNumber, EAllowShrinking::No);
 }
 
 bool ACPP_GameSession::FindPrivateSession(FUniqueNetIdRepl LocalUserId, const FString& RoomNumber, const bool bIsLAN)
@@ -590,7 +690,7 @@ bool ACPP_GameSession::FindPrivateSession(FUniqueNetIdRepl LocalUserId, const FS
 	                                  EOnlineComparisonOp::Equals);
 	// 0 - Is public
 	// 1 - Is private
-	SearchSettings->QuerySettings.Set(FName(TEXT("SESSION_PRIVACY")), 1,
+	SearchSettings->QuerySettings.Set(FName(TEXT("SESSION_PRIVACY")), static_cast<int64>(1),
 	                                  EOnlineComparisonOp::LessThanEquals);
 
 	SearchSettings->bIsLanQuery = bIsLAN;
@@ -607,6 +707,8 @@ bool ACPP_GameSession::FindPrivateSession(FUniqueNetIdRepl LocalUserId, const FS
 
 void ACPP_GameSession::OnFindPrivateSessionComplete(bool bWasSuccessful)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SessionCallback);
+
 	UE_LOG(LogTemp, Warning, TEXT("OnFindPrivateSessionComplete, Success = %hhd"), bWasSuccessful);
 
 	if (bWasSuccessful)
@@ -646,22 +748,23 @@ void ACPP_GameSession::OnFindPrivateSessionComplete(bool bWasSuccessful)
 
 		if (SearchSettings->SearchResults.Num() > 0)
 		{
+			// LAN queries ignore the query settings, so the room
+			// number has to be checked here.
+			int32 ResultIdx = 0;
 			if (bSearchingForLANSession)
 			{
-				for (int32 SearchIdx = 0; SearchIdx < SearchSettings->SearchResults.Num(); SearchIdx++)
-				{
-					if (!bSearchingForPublicSession &&
-						SearchSettings->SearchResults[SearchIdx].Session.SessionSettings.Settings.FindRef(
-							FName(TEXT("ROOM_NUMBER"))).Data != SearchingPrivateSessionCode)
-					{
-						SearchSettings->SearchResults.RemoveAt(SearchIdx);
-						SearchIdx--;
-					}
-				}
+				TMap<FString, int32> SessionIdIndex;
+				TMap<FString, int32> RoomNumberIndex;
+				FilterSearchResults(SearchSettings->SearchResults, bSearchingForPublicSession,
+				                    SearchingPrivateSessionCode, SessionIdIndex, RoomNumberIndex);
+
+				const int32* FoundIdx = RoomNumberIndex.Find(SearchingPrivateSessionCode);
+				ResultIdx = FoundIdx ? *FoundIdx : INDEX_NONE;
 			}
-			if (SearchSettings->SearchResults.Num() > 0)
+
+			if (SearchSettings->SearchResults.IsValidIndex(ResultIdx))
 			{
-				const FOnlineSessionSearchResult Result = SearchSettings->SearchResults[0];
+				const FOnlineSessionSearchResult Result = SearchSettings->SearchResults[ResultIdx];
 				if (Result.IsValid())
 				{
 					SessionName = FName(Result.Session.SessionSettings.Settings.FindRef(FName("SESSION_NAME")).
@@ -770,6 +873,8 @@ bool ACPP_GameSession::JoinSession(FUniqueNetIdRepl InUserId,
 
 void ACPP_GameSession::OnJoinSessionComplete(FName InSessionName, EOnJoinSessionCompleteResult::Type Result)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SessionCallback);
+
 	/** Result:
 	 * 0 Success,
 	 * 1 SessionIsFull,
@@ -807,6 +912,13 @@ void ACPP_GameSession::OnJoinSessionComplete(FName InSessionName, EOnJoinSession
 	}
 	else if (Result != 4 && GameInstanceRef.IsValid())
 	{
+		// The cached search results are outdated if the session
+		// is already full or doesn't exist.
+		if (Result == EOnJoinSessionCompleteResult::SessionIsFull ||
+			Result == EOnJoinSessionCompleteResult::SessionDoesNotExist)
+		{
+			InvalidatePublicSessionsCache();
+		}
 		if (GameInstanceRef->JoiningSessionFailedDelegate.IsBound())
 		{
 			GameInstanceRef->JoiningSessionFailedDelegate.Execute();
@@ -846,6 +958,8 @@ bool ACPP_GameSession::EndSession(const FName& InSessionName)
 
 void ACPP_GameSession::OnEndSessionCompleteCustom(FName InSessionName, bool bWasSuccessful)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SessionCallback);
+
 	UE_LOG(LogTemp, Warning, TEXT("OnEndSessionCompleteCustom"));
 
 	// Getting the online subsystem.
@@ -889,6 +1003,8 @@ bool ACPP_GameSession::DestroySessionCustom(const FName& InSessionName)
 
 void ACPP_GameSession::OnDestroySessionComplete(FName InSessionName, bool bWasSuccessful)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SessionCallback);
+
 	UE_LOG(LogTemp, Warning, TEXT("OnDestroySessionComplete, bWasSuccessful = %hhd"),
 	       bWasSuccessful);
 
@@ -1006,6 +1122,8 @@ void ACPP_GameSession::UnregisterPlayerCustom(const APlayerController* InPlayerC
 void ACPP_GameSession::OnUnregisterPlayerCustomComplete(FName InSessionName, const TArray<FUniqueNetIdRef>& PlayerId,
                                                         bool bWasSuccessful)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SessionCallback);
+
 	// Getting the online subsystem.
 	const IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get();
 	if (!OnlineSub)
@@ -0,0 +1,192 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "CPP_SignificanceManager.generated.h"
+
+/** Enumeration for the objects' significance levels. */
+UENUM(Blueprintable)
+enum class ESignificanceLevel : uint8
+{
+	High,
+	Medium,
+	Low,
+	Insignificant,
+	Max UMETA(Hidden)
+};
+
+/** Structure for storing information about the registered actor. */
+USTRUCT()
+struct FSignificantObject
+{
+	GENERATED_BODY()
+
+	/** Registered actor. */
+	UPROPERTY()
+	AActor* Actor = nullptr;
+
+	/** Score from 0 (insignificant) to 1 (the most significant). */
+	float Score = 1.0f;
+
+	/** Current significance level. */
+	ESignificanceLevel Level = ESignificanceLevel::High;
+
+	/** Actor's tick interval before the registration. */
+	float BaseTickInterval = 0.0f;
+
+	/** Actor's net update frequency before the registration. */
+	float BaseNetUpdateFrequency = 100.0f;
+};
+
+/**
+ * Subsystem for scoring the registered actors by distance
+ * and visibility to the players' views. The score is
+ * turned into a significance level that drives the actor's
+ * tick interval, the tick interval of its timelines,
+ * skeletal meshes (animation) and audio components, and
+ * its net update frequency (on the server only). Clients
+ * use the local players' views, the server uses the views
+ * of all players. The scores are refreshed a few times per
+ * second, and the settings are applied only when the level
+ * changes.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_SignificanceManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Function for initializing the subsystem.
+	 * @param Collection Collection of subsystems.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Function for cleaning up the subsystem. */
+	virtual void Deinitialize() override;
+
+	/**
+	 * Function that is called every frame for refreshing
+	 * the scores with the fixed interval.
+	 * @param DeltaTime Frame time.
+	 */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Should the subsystem be ticked now? */
+	virtual bool IsTickable() const override;
+
+	/** Stat ID of the subsystem's tick. */
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Function for limiting the subsystem to the game
+	 * worlds only.
+	 * @param WorldType Type of the world.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	/**
+	 * Function for registering the actor. Should be called
+	 * from the actor's BeginPlay.
+	 * @param Actor Actor to score.
+	 */
+	void RegisterActor(AActor* Actor);
+
+	/**
+	 * Function for unregistering the actor and restoring
+	 * its settings. Should be called from the actor's
+	 * EndPlay.
+	 * @param Actor Registered actor.
+	 */
+	void UnregisterActor(AActor* Actor);
+
+	/**
+	 * Getter for the actor's significance level (High if
+	 * the actor isn't registered).
+	 */
+	ESignificanceLevel GetSignificanceLevel(const AActor* Actor) const;
+
+	/**
+	 * Getter for the actor's score (1 if the actor isn't
+	 * registered).
+	 */
+	float GetSignificanceScore(const AActor* Actor) const;
+
+	/**
+	 * Getter for the tick interval of the actor's
+	 * significance level (0 if the actor isn't registered).
+	 */
+	float GetTickInterval(const AActor* Actor) const;
+
+private:
+	/** Registered actors. */
+	UPROPERTY()
+	TArray<FSignificantObject> Objects;
+
+	/** Seconds until the next refresh of the scores. */
+	float SecondsToRefresh;
+
+	/** Interval between the refreshes of the scores. */
+	float RefreshInterval;
+
+	/**
+	 * Distance from the view at which the score becomes 0
+	 * (the actor becomes insignificant).
+	 */
+	float MaxDistance;
+
+	/**
+	 * Multiplier for the score of the actors that are
+	 * behind the view or weren't rendered recently.
+	 */
+	float HiddenScoreMultiplier;
+
+	/**
+	 * Minimum score of the High and Medium levels (the
+	 * rest scores above zero are Low).
+	 */
+	float HighScoreThreshold;
+	float MediumScoreThreshold;
+
+	/** Tick interval of every significance level. */
+	TStaticArray<float, static_cast<int32>(ESignificanceLevel::Max)> TickIntervals;
+
+	/**
+	 * Net update frequency multiplier of every
+	 * significance level.
+	 */
+	TStaticArray<float, static_cast<int32>(ESignificanceLevel::Max)> NetUpdateFrequencyMultipliers;
+
+	/**
+	 * Function for collecting the views that the actors are
+	 * scored against.
+	 * @param OutLocations Locations of the views.
+	 * @param OutDirections Forward vectors of the views.
+	 * @param OutIsLocal Flags indicating if the view
+	 * belongs to a local player (is rendered).
+	 */
+	void GetViews(TArray<FVector>& OutLocations, TArray<FVector>& OutDirections, TArray<bool>& OutIsLocal) const;
+
+	/** Function for refreshing the scores of all actors. */
+	void RefreshSignificance();
+
+	/**
+	 * Function for applying the level's settings to the
+	 * actor.
+	 * @param Object Registered actor.
+	 */
+	void ApplySignificance(const FSignificantObject& Object) const;
+
+	/**
+	 * Function for applying the tick interval to the actor
+	 * and its components.
+	 * @param Actor Actor to change.
+	 * @param TickInterval New tick interval.
+	 */
+	static void SetTickInterval(AActor* Actor, const float TickInterval);
+};
\ No newline at end of file
@@ -0,0 +1,198 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "CPP_TickBudgetManager.generated.h"
+
+/**
+ * Delegate of the budgeted update. Receives the time since
+ * the previous call of the same update.
+ */
+DECLARE_DELEGATE_OneParam(FBudgetedUpdate, float);
+
+/** Enumeration for the budgeted updates' priorities. */
+UENUM(Blueprintable)
+enum class ETickBudgetPriority : uint8
+{
+	/** Is called every frame regardless of the budget. */
+	High,
+	/** Is called while the frame's budget isn't used up. */
+	Normal,
+	/**
+	 * Is called after all normal updates, if time is left
+	 * (but at least one low update is called every frame).
+	 */
+	Low,
+	Max UMETA(Hidden)
+};
+
+/** Structure for storing information about the registered update. */
+USTRUCT()
+struct FBudgetedUpdateEntry
+{
+	GENERATED_BODY()
+
+	/** Actor that owns the update. */
+	UPROPERTY()
+	AActor* Owner = nullptr;
+
+	/** Function to call. */
+	FBudgetedUpdate Callback;
+
+	/** Identifier that was returned to the caller. */
+	int32 UpdateId = 0;
+
+	/** Priority of the update. */
+	ETickBudgetPriority Priority = ETickBudgetPriority::Normal;
+
+	/** World time of the previous call. */
+	double LastUpdateTime = 0.0;
+
+	/**
+	 * Flag indicating if the update was unregistered while
+	 * the updates were running.
+	 */
+	bool bIsRemoved = false;
+};
+
+/** Structure for storing one line of the frame's report. */
+struct FTickBudgetReportLine
+{
+	/** Number of calls during the frame. */
+	int32 Calls = 0;
+
+	/** Time spent during the frame (in milliseconds). */
+	double TimeMs = 0.0;
+};
+
+/**
+ * Subsystem that calls lightweight updates of the gameplay
+ * actors instead of their own ticks. High priority updates
+ * are called every frame. Normal and low priority updates
+ * share the frame's time budget. When the budget is used
+ * up, the rest of them are called in the next frames
+ * (round-robin), with the accumulated delta time. Updates
+ * of the actors registered in the significance manager
+ * are also throttled to the actor's significance tick
+ * interval. The report of the last frame (time spent by
+ * every class) is printed by the «Cat.TickBudgetReport»
+ * console command.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_TickBudgetManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Function for initializing the subsystem.
+	 * @param Collection Collection of subsystems.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Function for cleaning up the subsystem. */
+	virtual void Deinitialize() override;
+
+	/**
+	 * Function that is called every frame for running the
+	 * registered updates.
+	 * @param DeltaTime Frame time.
+	 */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Should the subsystem be ticked now? */
+	virtual bool IsTickable() const override;
+
+	/** Stat ID of the subsystem's tick. */
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Function for limiting the subsystem to the game
+	 * worlds only.
+	 * @param WorldType Type of the world.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	/**
+	 * Function for registering the update. Should be called
+	 * from the actor's BeginPlay.
+	 * @param Owner Actor that owns the update.
+	 * @param Callback Function to call.
+	 * @param Priority Priority of the update.
+	 * @return Identifier of the update or 0 if it wasn't
+	 * registered.
+	 */
+	int32 RegisterUpdate(AActor* Owner, FBudgetedUpdate&& Callback,
+	                     const ETickBudgetPriority Priority = ETickBudgetPriority::Normal);
+
+	/**
+	 * Function for unregistering the update. Should be
+	 * called from the actor's EndPlay.
+	 * @param UpdateId Identifier returned by RegisterUpdate.
+	 */
+	void UnregisterUpdate(const int32 UpdateId);
+
+	/**
+	 * Setter for the frame's time budget of the normal and
+	 * low priority updates.
+	 * @param NewBudgetMs Budget in milliseconds.
+	 */
+	void SetFrameBudget(const float NewBudgetMs);
+
+	/** Function for printing the report of the last frame. */
+	void PrintReport() const;
+
+private:
+	/** Registered updates (sorted by priority). */
+	UPROPERTY()
+	TArray<FBudgetedUpdateEntry> Updates;
+
+	/**
+	 * Updates that were registered while the updates were
+	 * running.
+	 */
+	UPROPERTY()
+	TArray<FBudgetedUpdateEntry> PendingUpdates;
+
+	/**
+	 * Offset of the first update to call in the next frame
+	 * (for every priority).
+	 */
+	TStaticArray<int32, static_cast<int32>(ETickBudgetPriority::Max)> Cursors;
+
+	/**
+	 * Time budget of the normal and low priority updates
+	 * (in milliseconds).
+	 */
+	float FrameBudgetMs;
+
+	/** Identifier of the last registered update. */
+	int32 LastUpdateId;
+
+	/** Flag indicating if the updates are running now. */
+	bool bIsUpdating;
+
+	/** Time spent by every class during the last frame. */
+	TMap<FName, FTickBudgetReportLine> FrameReport;
+
+	/** Number of updates postponed during the last frame. */
+	int32 DeferredUpdatesNumber;
+
+	/**
+	 * Function for adding the update to the end of its
+	 * priority group.
+	 * @param Entry Update to add.
+	 */
+	void InsertUpdate(FBudgetedUpdateEntry&& Entry);
+
+	/**
+	 * Function for removing the unregistered updates and for
+	 * adding the pending ones.
+	 */
+	void FlushChanges();
+};
\ No newline at end of file
@@ -0,0 +1,263 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_SignificanceManager.h"
+#include "Components/AudioComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/TimelineComponent.h"
+#include "GameFramework/PlayerController.h"
+
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+void UCPP_SignificanceManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SecondsToRefresh = 0.0f;
+	RefreshInterval = 0.25f;
+	MaxDistance = 12000.0f;
+	HiddenScoreMultiplier = 0.5f;
+	HighScoreThreshold = 0.6f;
+	MediumScoreThreshold = 0.3f;
+
+	TickIntervals[static_cast<int32>(ESignificanceLevel::High)] = 0.0f;
+	TickIntervals[static_cast<int32>(ESignificanceLevel::Medium)] = 0.033f;
+	TickIntervals[static_cast<int32>(ESignificanceLevel::Low)] = 0.1f;
+	TickIntervals[static_cast<int32>(ESignificanceLevel::Insignificant)] = 0.5f;
+
+	NetUpdateFrequencyMultipliers[static_cast<int32>(ESignificanceLevel::High)] = 1.0f;
+	NetUpdateFrequencyMultipliers[static_cast<int32>(ESignificanceLevel::Medium)] = 0.5f;
+	NetUpdateFrequencyMultipliers[static_cast<int32>(ESignificanceLevel::Low)] = 0.25f;
+	NetUpdateFrequencyMultipliers[static_cast<int32>(ESignificanceLevel::Insignificant)] = 0.1f;
+}
+
+void UCPP_SignificanceManager::Deinitialize()
+{
+	Objects.Empty();
+	SET_DWORD_STAT(STAT_Cat_SignificantObjects, 0);
+
+	Super::Deinitialize();
+}
+
+bool UCPP_SignificanceManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UCPP_SignificanceManager::IsTickable() const
+{
+	return Objects.Num() > 0;
+}
+
+TStatId UCPP_SignificanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCPP_SignificanceManager, STATGROUP_Tickables);
+}
+
+void UCPP_SignificanceManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SecondsToRefresh -= DeltaTime;
+	if (SecondsToRefresh <= 0.0f)
+	{
+		SecondsToRefresh = RefreshInterval;
+		RefreshSignificance();
+	}
+}
+
+void UCPP_SignificanceManager::RegisterActor(AActor* Actor)
+{
+	if (!IsValid(Actor) || Objects.ContainsByPredicate([Actor](const FSignificantObject& Object)
+	{
+		return Object.Actor == Actor;
+	}))
+	{
+		return;
+	}
+
+	FSignificantObject& Object = Objects.AddDefaulted_GetRef();
+	Object.Actor = Actor;
+	Object.BaseTickInterval = Actor->GetActorTickInterval();
+	Object.BaseNetUpdateFrequency = Actor->NetUpdateFrequency;
+	SET_DWORD_STAT(STAT_Cat_SignificantObjects, Objects.Num());
+
+	// The first refresh should score the new actor soon.
+	SecondsToRefresh = FMath::Min(SecondsToRefresh, 0.0f);
+}
+
+void UCPP_SignificanceManager::UnregisterActor(AActor* Actor)
+{
+	const int32 Index = Objects.IndexOfByPredicate([Actor](const FSignificantObject& Object)
+	{
+		return Object.Actor == Actor;
+	});
+	if (Index == INDEX_NONE)
+		return;
+
+	if (IsValid(Actor))
+	{
+		SetTickInterval(Actor, Objects[Index].BaseTickInterval);
+		if (Actor->HasAuthority() && Actor->GetIsReplicated())
+		{
+			Actor->NetUpdateFrequency = Objects[Index].BaseNetUpdateFrequency;
+		}
+	}
+	Objects.RemoveAtSwap(Index);
+	SET_DWORD_STAT(STAT_Cat_SignificantObjects, Objects.Num());
+}
+
+ESignificanceLevel UCPP_SignificanceManager::GetSignificanceLevel(const AActor* Actor) const
+{
+	const FSignificantObject* Object = Objects.FindByPredicate([Actor](const FSignificantObject& Other)
+	{
+		return Other.Actor == Actor;
+	});
+	return Object ? Object->Level : ESignificanceLevel::High;
+}
+
+float UCPP_SignificanceManager::GetSignificanceScore(const AActor* Actor) const
+{
+	const FSignificantObject* Object = Objects.FindByPredicate([Actor](const FSignificantObject& Other)
+	{
+		return Other.Actor == Actor;
+	});
+	return Object ? Object->Score : 1.0f;
+}
+
+float UCPP_SignificanceManager::GetTickInterval(const AActor* Actor) const
+{
+	const FSignificantObject* Object = Objects.FindByPredicate([Actor](const FSignificantObject& Other)
+	{
+		return Other.Actor == Actor;
+	});
+	return Object ? FMath::Max(Object->BaseTickInterval, TickIntervals[static_cast<int32>(Object->Level)]) : 0.0f;
+}
+
+void UCPP_SignificanceManager::GetViews(TArray<FVector>& OutLocations, TArray<FVector>& OutDirections,
+                                        TArray<bool>& OutIsLocal) const
+{
+	// The server scores against every player (for the net
+	// update frequency), clients only against the local ones.
+	const bool bIsServer = GetWorld()->GetNetMode() < NM_Client;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!IsValid(PlayerController))
+			continue;
+
+		const bool bIsLocal = PlayerController->IsLocalController();
+		if (!bIsLocal && !bIsServer)
+			continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		OutLocations.Add(ViewLocation);
+		OutDirections.Add(ViewRotation.Vector());
+		OutIsLocal.Add(bIsLocal);
+	}
+}
+
+void UCPP_SignificanceManager::RefreshSignificance()
+{
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_Significance);
+
+	TArray<FVector> ViewLocations{};
+	TArray<FVector> ViewDirections{};
+	TArray<bool> ViewIsLocal{};
+	GetViews(ViewLocations, ViewDirections, ViewIsLocal);
+
+	// Without any view (e.g. while players are loading)
+	// everything stays at the full rate.
+	const bool bHasViews = ViewLocations.Num() > 0;
+	const float InvMaxDistance = 1.0f / FMath::Max(MaxDistance, 1.0f);
+
+	for (int32 i = Objects.Num() - 1; i >= 0; i--)
+	{
+		FSignificantObject& Object = Objects[i];
+		if (!IsValid(Object.Actor))
+		{
+			Objects.RemoveAtSwap(i);
+			continue;
+		}
+
+		float Score = bHasViews ? 0.0f : 1.0f;
+		const FVector ActorLocation = Object.Actor->GetActorLocation();
+		const bool bWasRendered = Object.Actor->WasRecentlyRendered(0.5f);
+		for (int32 j = 0; j < ViewLocations.Num(); j++)
+		{
+			const FVector ToActor = ActorLocation - ViewLocations[j];
+			const float Distance = ToActor.Size();
+			float ViewScore = 1.0f - FMath::Clamp(Distance * InvMaxDistance, 0.0f, 1.0f);
+
+			// Actors behind the view (or hidden from the local
+			// player) are less significant.
+			const bool bIsInFront = Distance < KINDA_SMALL_NUMBER ||
+				FVector::DotProduct(ToActor / Distance, ViewDirections[j]) > 0.5f;
+			if (!bIsInFront || (ViewIsLocal[j] && !bWasRendered))
+			{
+				ViewScore *= HiddenScoreMultiplier;
+			}
+			Score = FMath::Max(Score, ViewScore);
+		}
+
+		ESignificanceLevel NewLevel;
+		if (Score >= HighScoreThreshold)
+		{
+			NewLevel = ESignificanceLevel::High;
+		}
+		else if (Score >= MediumScoreThreshold)
+		{
+			NewLevel = ESignificanceLevel::Medium;
+		}
+		else if (Score > 0.0f)
+		{
+			NewLevel = ESignificanceLevel::Low;
+		}
+		else
+		{
+			NewLevel = ESignificanceLevel::Insignificant;
+		}
+
+		Object.Score = Score;
+		if (NewLevel != Object.Level)
+		{
+			Object.Level = NewLevel;
+			ApplySignificance(Object);
+		}
+	}
+	SET_DWORD_STAT(STAT_Cat_SignificantObjects, Objects.Num());
+}
+
+void UCPP_SignificanceManager::ApplySignificance(const FSignificantObject& Object) const
+{
+	const int32 LevelIndex = static_cast<int32>(Object.Level);
+	SetTickInterval(Object.Actor, FMath::Max(Object.BaseTickInterval, TickIntervals[LevelIndex]));
+
+	if (Object.Actor->HasAuthority() && Object.Actor->GetIsReplicated())
+	{
+		Object.Actor->NetUpdateFrequency = FMath::Max(
+			Object.BaseNetUpdateFrequency * NetUpdateFrequencyMultipliers[LevelIndex], 1.0f);
+	}
+}
+
+void UCPP_SignificanceManager::SetTickInterval(AActor* Actor, const float TickInterval)
+{
+	Actor->SetActorTickInterval(TickInterval);
+
+	// Timelines, animation and audio of the actor. Movement
+	// components are left at the full rate, so the physics
+	// stays the same on every machine.
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (Component && (Component->IsA<UTimelineComponent>() ||
+			Component->IsA<USkeletalMeshComponent>() ||
+			Component->IsA<UAudioComponent>()))
+		{
+			Component->SetComponentTickInterval(TickInterval);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,289 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_TickBudgetManager.h"
+
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+#ifndef CPP_SIGNIFICANCEMANAGER_H
+#define CPP_SIGNIFICANCEMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_SignificanceManager.h"
+#endif
+
+static FAutoConsoleCommandWithWorld TickBudgetReportCommand(
+	TEXT("Cat.TickBudgetReport"),
+	TEXT("Prints the time spent by the budgeted updates during the last frame."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UCPP_TickBudgetManager* TickBudgetManager =
+				IsValid(World) ? World->GetSubsystem<UCPP_TickBudgetManager>() : nullptr;
+			IsValid(TickBudgetManager))
+		{
+			TickBudgetManager->PrintReport();
+		}
+	}));
+
+void UCPP_TickBudgetManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	for (int32& Cursor : Cursors)
+	{
+		Cursor = 0;
+	}
+	FrameBudgetMs = 1.5f;
+	LastUpdateId = 0;
+	bIsUpdating = false;
+	DeferredUpdatesNumber = 0;
+}
+
+void UCPP_TickBudgetManager::Deinitialize()
+{
+	Updates.Empty();
+	PendingUpdates.Empty();
+	FrameReport.Empty();
+	SET_DWORD_STAT(STAT_Cat_BudgetedUpdates, 0);
+	SET_DWORD_STAT(STAT_Cat_DeferredUpdates, 0);
+
+	Super::Deinitialize();
+}
+
+bool UCPP_TickBudgetManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UCPP_TickBudgetManager::IsTickable() const
+{
+	return Updates.Num() > 0 || PendingUpdates.Num() > 0;
+}
+
+TStatId UCPP_TickBudgetManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCPP_TickBudgetManager, STATGROUP_Tickables);
+}
+
+void UCPP_TickBudgetManager::Tick(float DeltaTime)
+{
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_TickBudget);
+
+	Super::Tick(DeltaTime);
+
+	const UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double BudgetEndTime = FPlatformTime::Seconds() + FrameBudgetMs / 1000.0;
+
+	FrameReport.Reset();
+	DeferredUpdatesNumber = 0;
+	int32 CalledUpdatesNumber = 0;
+	bIsUpdating = true;
+
+	// The updates are sorted by priority, so every group
+	// is a continuous range of the array.
+	int32 GroupBegin = 0;
+	for (int32 PriorityIndex = 0; PriorityIndex < static_cast<int32>(ETickBudgetPriority::Max); PriorityIndex++)
+	{
+		int32 GroupEnd = GroupBegin;
+		while (GroupEnd < Updates.Num() && static_cast<int32>(Updates[GroupEnd].Priority) == PriorityIndex)
+		{
+			GroupEnd++;
+		}
+		const int32 GroupSize = GroupEnd - GroupBegin;
+		if (GroupSize == 0)
+			continue;
+
+		const bool bIsBudgeted = PriorityIndex != static_cast<int32>(ETickBudgetPriority::High);
+		const int32 FirstOffset = Cursors[PriorityIndex] % GroupSize;
+		// Every group calls at least one update per frame, so
+		// the low priority updates aren't starved when the
+		// normal ones use up the whole budget.
+		int32 GroupCalledUpdatesNumber = 0;
+		bool bIsGroupCompleted = true;
+		for (int32 i = 0; i < GroupSize; i++)
+		{
+			const int32 Offset = (FirstOffset + i) % GroupSize;
+			if (bIsBudgeted && GroupCalledUpdatesNumber > 0 && FPlatformTime::Seconds() >= BudgetEndTime)
+			{
+				// The rest of the group starts the next frame.
+				Cursors[PriorityIndex] = Offset;
+				DeferredUpdatesNumber += GroupSize - i;
+				bIsGroupCompleted = false;
+				break;
+			}
+
+			FBudgetedUpdateEntry& Entry = Updates[GroupBegin + Offset];
+			if (Entry.bIsRemoved || !IsValid(Entry.Owner))
+				continue;
+
+			const float UpdateDeltaTime = static_cast<float>(Now - Entry.LastUpdateTime);
+			if (IsValid(SignificanceManager) && UpdateDeltaTime < SignificanceManager->GetTickInterval(Entry.Owner))
+				continue;
+
+			const double StartTime = FPlatformTime::Seconds();
+			Entry.LastUpdateTime = Now;
+			// The callback can register or unregister updates, so
+			// the entry is copied.
+			const FBudgetedUpdate Callback = Entry.Callback;
+			const FName OwnerClassName = Entry.Owner->GetClass()->GetFName();
+			Callback.ExecuteIfBound(UpdateDeltaTime);
+			CalledUpdatesNumber++;
+			GroupCalledUpdatesNumber++;
+
+			FTickBudgetReportLine& ReportLine = FrameReport.FindOrAdd(OwnerClassName);
+			ReportLine.Calls++;
+			ReportLine.TimeMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		}
+		if (bIsGroupCompleted)
+		{
+			Cursors[PriorityIndex] = 0;
+		}
+		GroupBegin = GroupEnd;
+	}
+
+	bIsUpdating = false;
+	FlushChanges();
+
+	SET_DWORD_STAT(STAT_Cat_BudgetedUpdates, CalledUpdatesNumber);
+	SET_DWORD_STAT(STAT_Cat_DeferredUpdates, DeferredUpdatesNumber);
+}
+
+int32 UCPP_TickBudgetManager::RegisterUpdate(AActor* Owner, FBudgetedUpdate&& Callback,
+                                             const ETickBudgetPriority Priority)
+{
+	if (!IsValid(Owner) || !Callback.IsBound() || Priority == ETickBudgetPriority::Max)
+		return 0;
+
+	FBudgetedUpdateEntry Entry;
+	Entry.Owner = Owner;
+	Entry.Callback = MoveTemp(Callback);
+	Entry.UpdateId = ++LastUpdateId;
+	Entry.Priority = Priority;
+	Entry.LastUpdateTime = GetWorld()->GetTimeSeconds();
+
+	const int32 UpdateId = Entry.UpdateId;
+	if (bIsUpdating)
+	{
+		PendingUpdates.Add(MoveTemp(Entry));
+	}
+	else
+	{
+		InsertUpdate(MoveTemp(Entry));
+	}
+	return UpdateId;
+}
+
+void UCPP_TickBudgetManager::UnregisterUpdate(const int32 UpdateId)
+{
+	if (UpdateId == 0)
+		return;
+
+	if (const int32 PendingIndex = PendingUpdates.IndexOfByPredicate([UpdateId](const FBudgetedUpdateEntry& Entry)
+	{
+		return Entry.UpdateId == UpdateId;
+	}); PendingIndex != INDEX_NONE)
+	{
+		PendingUpdates.RemoveAt(PendingIndex);
+		return;
+	}
+
+	const int32 Index = Updates.IndexOfByPredicate([UpdateId](const FBudgetedUpdateEntry& Entry)
+	{
+		return Entry.UpdateId == UpdateId;
+	});
+	if (Index == INDEX_NONE)
+		return;
+
+	// Removing from the array would shift the running loop.
+	Updates[Index].bIsRemoved = true;
+	Updates[Index].Callback.Unbind();
+	if (!bIsUpdating)
+	{
+		FlushChanges();
+	}
+}
+
+void UCPP_TickBudgetManager::SetFrameBudget(const float NewBudgetMs)
+{
+	FrameBudgetMs = FMath::Max(NewBudgetMs, 0.0f);
+}
+
+void UCPP_TickBudgetManager::PrintReport() const
+{
+	TArray<TPair<FName, FTickBudgetReportLine>> Lines = FrameReport.Array();
+	Lines.Sort([](const TPair<FName, FTickBudgetReportLine>& A, const TPair<FName, FTickBudgetReportLine>& B)
+	{
+		return A.Value.TimeMs > B.Value.TimeMs;
+	});
+
+	UE_LOG(LogTemp, Log, TEXT("Tick budget: %d updates registered, %d deferred, budget %.2f ms."),
+	       Updates.Num(), DeferredUpdatesNumber, FrameBudgetMs);
+	for (const TPair<FName, FTickBudgetReportLine>& Line : Lines)
+	{
+		UE_LOG(LogTemp, Log, TEXT("  %s: %d calls, %.3f ms"),
+		       *Line.Key.ToString(), Line.Value.Calls, Line.Value.TimeMs);
+	}
+}
+
+void UCPP_TickBudgetManager::InsertUpdate(FBudgetedUpdateEntry&& Entry)
+{
+	int32 Index = Updates.Num();
+	while (Index > 0 && Updates[Index - 1].Priority > Entry.Priority)
+	{
+		Index--;
+	}
+	Updates.Insert(MoveTemp(Entry), Index);
+}
+
+void UCPP_TickBudgetManager::FlushChanges()
+{
+	// Updates removed before the cursor shift the rest of
+	// their group, so the cursor is moved back by their
+	// number (otherwise some updates would be skipped).
+	const TStaticArray<int32, static_cast<int32>(ETickBudgetPriority::Max)> OldCursors = Cursors;
+	int32 GroupBegin = 0;
+	for (int32 i = 0; i < Updates.Num(); i++)
+	{
+		if (i > 0 && Updates[i].Priority != Updates[i - 1].Priority)
+		{
+			GroupBegin = i;
+		}
+		if (!Updates[i].bIsRemoved && IsValid(Updates[i].Owner))
+			continue;
+
+		if (const int32 PriorityIndex = static_cast<int32>(Updates[i].Priority);
+			i - GroupBegin < OldCursors[PriorityIndex])
+		{
+			Cursors[PriorityIndex]--;
+		}
+	}
+
+	Updates.RemoveAll([](const FBudgetedUpdateEntry& Entry)
+	{
+		return Entry.bIsRemoved || !IsValid(Entry.Owner);
+	});
+
+	for (FBudgetedUpdateEntry& Entry : PendingUpdates)
+	{
+		InsertUpdate(MoveTemp(Entry));
+	}
+	PendingUpdates.Reset();
+
+	TStaticArray<int32, static_cast<int32>(ETickBudgetPriority::Max)> GroupSizes;
+	for (int32& GroupSize : GroupSizes)
+	{
+		GroupSize = 0;
+	}
+	for (const FBudgetedUpdateEntry& Entry : Updates)
+	{
+		GroupSizes[static_cast<int32>(Entry.Priority)]++;
+	}
+	for (int32 PriorityIndex = 0; PriorityIndex < static_cast<int32>(ETickBudgetPriority::Max); PriorityIndex++)
+	{
+		if (Cursors[PriorityIndex] >= GroupSizes[PriorityIndex])
+		{
+			Cursors[PriorityIndex] = 0;
+		}
+	}
+}
\ No newline at end of file
@@ -10,7 +10,6 @@
 #include "CatPlatformer/Platform/Classes/CPP_Platform.h"
 #endif
 class ACPP_Platform;
-class UBoxComponent;
 
 #include "CPP_FallingPlatform.generated.h"
 
@@ -46,55 +45,43 @@ protected:
 	 * actor appears in the game world.
 	 * Should be called before BeginPlay() (between
 	 * SpawnActorDeferred() and FinishSpawningActor()).
+	 * @param NewCellIndex Index of the platform's cell.
+	 * @param StartLocation Start location of the platform.
+	 * @param RandomStream Stream for the random variables.
 	 */
-	virtual void InitializeBasicVariables_Implementation(const FVector StartLocation) override;
+	virtual void InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+	                                      FRandomStream& RandomStream) override;
 
 	/**
-	 * Function for replying to the start of overlap with a
-	 * static mesh component.
-	 * @param OverlappedComponent The component whose
-	 * intersection we are checking (CollisionBox).
-	 * @param OtherActor The actor who overlapped the
-	 * component being checked.
-	 * @param OtherComp The component that overlaps with the
-	 * component being checked.
-	 * @param OtherBodyIndex Refers to the index of the
-	 * specific primitive component of the other actor that
-	 * the current actor is overlapping with.
-	 * This is useful when the other actor has multiple
-	 * primitive components, and you want to know which one
-	 * is causing the overlap.
-	 * @param bFromSweep It returns True or False, depending
-	 * on whether something overlaps the collision.
-	 * @param SweepResult Hit result structure needed to
-	 * access some additional outputs.
+	 * Function for starting the shaking, the falling or for
+	 * returning the platform to its start position by the
+	 * phase of the state.
+	 * @param State New state of the platform.
 	 */
-	UFUNCTION()
-	void CollisionBoxOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-	                              UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
-	                              const FHitResult& SweepResult);
+	virtual void ApplyPlatformState(const FPlatformState& State) override;
+
+	/**
+	 * Function that is called when the character starts
+	 * standing on the platform.
+	 * @param Character Player character.
+	 */
+	virtual void CharacterEnteredPlatform(ACPP_Character* Character) override;
 
 	/**
-	 * Function for replying to the end of overlap with a
-	 * box component.
-	 * @param OverlappedComponent The component whose
-	 * intersection we are checking (CollisionBox).
-	 * @param OtherActor The actor who overlapped the
-	 * component being checked.
-	 * @param OtherComp The component that overlaps with the
-	 * component being checked.
-	 * @param OtherBodyIndex Refers to the index of the
-	 * specific primitive component of the other actor that
-	 * the current actor is overlapping with.
-	 * This is useful when the other actor has multiple
-	 * primitive components, and you want to know which one
-	 * is causing the overlap.
+	 * Function that is called when the character stops
+	 * standing on the platform.
+	 * @param Character Player character.
+	 */
+	virtual void CharacterLeftPlatform(ACPP_Character* Character) override;
+
+	/**
+	 * Function for switching the platform to the falling
+	 * phase after the shaking. Is called on the server.
 	 */
 	UFUNCTION()
-	void CollisionBoxOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-								UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
-	
-	/** Function for starting platform falling. */
+	void StartFalling();
+
+	/** Function for moving the falling platform down. */
 	UFUNCTION()
 	void Falling();
 
@@ -102,23 +89,23 @@ protected:
 	 * Function for the fallen platform's teleportation to
 	 * the start position.
 	 */
-	UFUNCTION(Server, Reliable)
 	void TeleportPlatformToStartPosition();
-	void TeleportPlatformToStartPosition_Implementation();
-
-	/**
-	 * Collision box to check if the player has stepped on
-	 * the surface of the platform.
-	 */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
-	UBoxComponent* CollisionBox;
 
 	/** The platform's transform right after its spawning. */
 	FTransform StartTransform;
 
+	/** Current phase of the platform (on this machine). */
+	EPlatformPhase CurrentPhase;
+
+	/** Timer for the platform's shaking before the falling. */
+	FTimerHandle TH_ShakingTimer;
+
 	/** Timer for the platform's falling process. */
 	FTimerHandle TH_FallingTimer;
 
+	/** Interval of the falling timer. */
+	static constexpr float FallingStepSeconds = 0.025f;
+
 	/**
 	 * The speed at which the platform will fall after the
 	 * player steps on it.
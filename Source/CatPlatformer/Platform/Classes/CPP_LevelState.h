@@ -0,0 +1,247 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Engine/NetSerialization.h"
+#include "Net/Serialization/FastArraySerializer.h"
+
+class USceneComponent;
+class ACPP_Platform;
+class ACPP_LevelState;
+
+#include "CPP_LevelState.generated.h"
+
+/** Enumeration for the phases of the falling platforms. */
+UENUM(Blueprintable)
+enum class EPlatformPhase : uint8
+{
+	/** The platform is on its start position. */
+	Idle,
+	/** A player stepped on the platform, it shakes. */
+	Shaking,
+	/** The platform falls down. */
+	Falling
+};
+
+/**
+ * Structure for storing the dynamic state of one platform
+ * (one cell of the platforms' grid).
+ */
+USTRUCT()
+struct FPlatformState : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Index of the grid's cell. */
+	UPROPERTY()
+	int32 CellIndex = INDEX_NONE;
+
+	/** Index of the platform's class in the level state. */
+	UPROPERTY()
+	uint8 ClassIndex = 0;
+
+	/** Start location of the platform. */
+	UPROPERTY()
+	FVector_NetQuantize Location = FVector::ZeroVector;
+
+	/** Start rotation of the platform around the Z axis. */
+	UPROPERTY()
+	float Yaw = 0.0f;
+
+	/**
+	 * Seed of the platform's random variables (speed,
+	 * appearance, axis, etc.), so every machine gets the
+	 * same platform without replicating the variables.
+	 */
+	UPROPERTY()
+	int32 RandomSeed = 0;
+
+	/** Current phase of the falling platform. */
+	UPROPERTY()
+	EPlatformPhase Phase = EPlatformPhase::Idle;
+
+	/**
+	 * Server time when the current phase started (the
+	 * shaking start for the Shaking phase).
+	 */
+	UPROPERTY()
+	float PhaseStartTime = 0.0f;
+
+	/** Server time when the platform was respawned last time. */
+	UPROPERTY()
+	float RespawnTime = 0.0f;
+
+	/** Function for spawning the local platform on the client. */
+	void PostReplicatedAdd(const struct FPlatformStateArray& InArraySerializer);
+
+	/** Function for applying the new state to the local platform. */
+	void PostReplicatedChange(const struct FPlatformStateArray& InArraySerializer);
+
+	/** Function for destroying the local platform on the client. */
+	void PreReplicatedRemove(const struct FPlatformStateArray& InArraySerializer);
+};
+
+/** Delta-replicated array of the platforms' states. */
+USTRUCT()
+struct FPlatformStateArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	/** States of the platforms. */
+	UPROPERTY()
+	TArray<FPlatformState> Items;
+
+	/** Actor that owns the array. */
+	UPROPERTY(NotReplicated)
+	ACPP_LevelState* Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FastArrayDeltaSerialize<FPlatformState, FPlatformStateArray>(Items, DeltaParms, *this);
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FPlatformStateArray> : public TStructOpsTypeTraitsBase2<FPlatformStateArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
+/**
+ * Actor for replicating the platforms of the level. The
+ * platforms with behavior are local (not replicated)
+ * actors: the server adds the state of every platform to
+ * the delta-replicated array, and every machine spawns its
+ * own platforms from it. Only the changes of the states
+ * (e.g. the phases of the falling platforms) are sent
+ * later, so the level needs one actor channel instead of
+ * one channel per platform.
+ */
+UCLASS()
+class CATPLATFORMER_API ACPP_LevelState : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	/** The constructor to set default variables. */
+	ACPP_LevelState();
+
+protected:
+	/**
+	 * Function for storing logic that should be applied in
+	 * the end of the actor's life (but before its destroying).
+	 * @param EndPlayReason Specifies why an actor is being
+	 * deleted/removed from a level.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * Returns the properties used for network replication.
+	 * @param OutLifetimeProps Lifetime properties.
+	 */
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+public:
+	/**
+	 * Function for adding the platform to the level. Is
+	 * called on the server (before SpawnPlatforms).
+	 * @param PlatformClass Class of the platform.
+	 * @param CellIndex Index of the grid's cell.
+	 * @param Transform Start transform of the platform.
+	 * @return Was the platform added?
+	 */
+	bool AddPlatform(UClass* PlatformClass, const int32 CellIndex, const FTransform& Transform);
+
+	/**
+	 * Function for spawning the local actors of the added
+	 * platforms. Is called on the server after all platforms
+	 * were added and on the clients after the replication.
+	 */
+	void SpawnPlatforms();
+
+	/**
+	 * Function for spawning the local actor of the platform
+	 * (if it wasn't spawned before).
+	 * @param State State of the platform.
+	 */
+	void SpawnPlatform(const FPlatformState& State);
+
+	/**
+	 * Function for changing the platform's phase. Is called
+	 * on the server, the clients get the change by the
+	 * replication.
+	 * @param CellIndex Index of the platform's cell.
+	 * @param NewPhase New phase of the platform.
+	 */
+	void SetPlatformPhase(const int32 CellIndex, const EPlatformPhase NewPhase);
+
+	/**
+	 * Function for applying the state to the local platform
+	 * of its cell.
+	 * @param State State of the platform.
+	 */
+	void ApplyPlatformState(const FPlatformState& State);
+
+	/**
+	 * Function for destroying the local platform of the
+	 * cell.
+	 * @param CellIndex Index of the platform's cell.
+	 */
+	void DestroyPlatform(const int32 CellIndex);
+
+	/** Getter for the current server time. */
+	float GetServerTime() const;
+
+	/**
+	 * Getter for the number of seconds since the platforms
+	 * were added (for synchronizing the animated platforms
+	 * that were spawned at different moments).
+	 */
+	float GetSecondsSinceLayoutStart() const;
+
+	/** Getter for the number of platforms' states. */
+	FORCEINLINE int32 GetPlatformsNumber() const { return Platforms.Items.Num(); }
+
+	/**
+	 * Getter for the number of platforms' states without
+	 * local actors (for example, whose classes weren't
+	 * replicated yet).
+	 */
+	FORCEINLINE int32 GetPendingPlatformsNumber() const
+	{
+		return FMath::Max(Platforms.Items.Num() - LocalPlatforms.Num(), 0);
+	}
+
+private:
+	/** Root for actor's components. */
+	UPROPERTY(VisibleAnywhere, Category = "Components")
+	USceneComponent* Root;
+
+	/** Classes of the platforms. */
+	UPROPERTY(ReplicatedUsing = OnRep_PlatformClasses)
+	TArray<TSubclassOf<ACPP_Platform>> PlatformClasses;
+
+	/** States of the platforms. */
+	UPROPERTY(Replicated)
+	FPlatformStateArray Platforms;
+
+	/** Server time when the first platform was added. */
+	UPROPERTY(Replicated)
+	float LayoutStartTime;
+
+	/**
+	 * Function for spawning the platforms whose states were
+	 * replicated before their classes.
+	 */
+	UFUNCTION()
+	void OnRep_PlatformClasses();
+
+	/** Local actors of the platforms (by the cell's index). */
+	UPROPERTY()
+	TMap<int32, ACPP_Platform*> LocalPlatforms;
+};
\ No newline at end of file
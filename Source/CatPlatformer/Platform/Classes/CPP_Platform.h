@@ -6,14 +6,32 @@
 #include "GameFramework/Actor.h"
 class USceneComponent;
 class UStaticMeshComponent;
+
+#ifndef CPP_PLATFORMINTERFACE_H
+#define CPP_PLATFORMINTERFACE_H
+#include "CatPlatformer/Platform/Classes/CPP_PlatformInterface.h"
+#endif
+class ACPP_Character;
+
+#ifndef CPP_LEVELSTATE_H
+#define CPP_LEVELSTATE_H
+#include "CatPlatformer/Platform/Classes/CPP_LevelState.h"
+#endif
+class ACPP_LevelState;
 #include "CPP_Platform.generated.h"
 
 /**
  * Parent class for platforms that should be spawn on the
- * map in the beginning of every level.
+ * map in the beginning of every level. Keeps the list of
+ * characters that are standing on the platform (see
+ * ICPP_PlatformInterface).
+ * Platforms aren't replicated: every machine spawns its
+ * own actors from the states of ACPP_LevelState (the
+ * owner of the platform), and the server changes the
+ * states.
  */
 UCLASS(Abstract)
-class CATPLATFORMER_API ACPP_Platform : public AActor
+class CATPLATFORMER_API ACPP_Platform : public AActor, public ICPP_PlatformInterface
 {
 	GENERATED_BODY()
 
@@ -27,18 +45,74 @@ protected:
 	 */
 	virtual void BeginPlay() override;
 
+	/**
+	 * Function for storing logic that should be applied in
+	 * the end of the actor's life (but before its destroying).
+	 * @param EndPlayReason Specifies why an actor is being
+	 * deleted/removed from a level.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
 	/**
 	 * Function for initializing variables before this
 	 * actor appears in the game world.
 	 * Should be called before BeginPlay() (between
 	 * SpawnActorDeferred() and FinishSpawningActor()).
+	 * @param NewCellIndex Index of the platform's cell.
+	 * @param StartLocation Start location of the platform.
+	 * @param RandomStream Stream for the random variables
+	 * (is seeded the same way on every machine).
+	 */
+	virtual void InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+	                                      FRandomStream& RandomStream);
+
+	/**
+	 * Function for applying the replicated state of the
+	 * platform. Is called on every machine.
+	 * @param State New state of the platform.
+	 */
+	virtual void ApplyPlatformState(const FPlatformState& State);
+
+	/**
+	 * Can the platform be rendered as an instance of the
+	 * platform spawner's instanced meshes (instead of
+	 * spawning the actor)? Is checked on the class default
+	 * object.
+	 */
+	bool CanBeInstanced() const;
+
+	/** Getter for the platform's static mesh component. */
+	FORCEINLINE UStaticMeshComponent* GetPlatformBase() const { return PlatformBase; }
+
+	/**
+	 * Function that is called when the character starts
+	 * standing on the platform.
+	 * @param Character Player character.
+	 */
+	virtual void CharacterEnteredPlatform(ACPP_Character* Character) override;
+
+	/**
+	 * Function that is called when the character stops
+	 * standing on the platform.
+	 * @param Character Player character.
 	 */
-	UFUNCTION(Server, Reliable)
-	virtual void InitializeBasicVariables(const FVector StartLocation);
-	virtual void InitializeBasicVariables_Implementation(const FVector StartLocation);
+	virtual void CharacterLeftPlatform(ACPP_Character* Character) override;
 
 protected:
+	/** Getter for the level state that spawned the platform. */
+	ACPP_LevelState* GetLevelState() const;
+
+	/**
+	 * Is the platform on the server? Local platforms have
+	 * authority on every machine, so the gameplay logic
+	 * should use this function instead of HasAuthority().
+	 */
+	FORCEINLINE bool IsOnServer() const { return GetNetMode() != NM_Client; }
+
+	/** Index of the platform's cell in the level state. */
+	int32 CellIndex;
+
 	/**
 	 * Function for to launch the main feature of the
 	 * current platform type.
@@ -53,4 +127,26 @@ protected:
 	/** Static mesh for the platform's representation. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
 	UStaticMeshComponent* PlatformBase;
+
+	/**
+	 * Flag indicating if the platform is animated (ticks or
+	 * plays a timeline) and should be registered in the
+	 * significance manager.
+	 */
+	bool bIsAnimated;
+
+	/**
+	 * Should the platform be rendered as an instance? Only
+	 * platforms without any behavior and without any
+	 * components except the base mesh can be instanced.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Rendering")
+	bool bRenderAsInstance;
+
+	/**
+	 * Characters that are standing on the platform now (on
+	 * this machine).
+	 */
+	UPROPERTY()
+	TArray<ACPP_Character*> CharactersOnPlatform;
 };
@@ -0,0 +1,61 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/PrimitiveComponent.h"
+
+class UBodySetup;
+
+#include "CPP_PlatformChunkCollision.generated.h"
+
+/**
+ * Component with the static collision of several platforms
+ * (one chunk of the platforms' grid). The simple collision
+ * shapes of all platforms are merged into one compound
+ * body, so the physics scene keeps one body per chunk
+ * instead of one body per platform. Is created by the
+ * instanced platforms actor and has no rendering.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_PlatformChunkCollision : public UPrimitiveComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** The constructor to set default variables. */
+	UCPP_PlatformChunkCollision(const FObjectInitializer& ObjectInitializer);
+
+	/**
+	 * Function for checking if the platform's mesh can be
+	 * merged into the chunk (has only boxes, spheres and
+	 * capsules as its simple collision).
+	 * @param Mesh Static mesh of the platform.
+	 */
+	static bool CanMergeMesh(const UStaticMesh* Mesh);
+
+	/**
+	 * Function for adding the simple collision shapes of the
+	 * platform's mesh to the chunk. Should be called before
+	 * the component is registered.
+	 * @param Mesh Static mesh of the platform.
+	 * @param Transform Transform of the mesh relative to the
+	 * component.
+	 */
+	void AddMesh(const UStaticMesh* Mesh, const FTransform& Transform);
+
+	/** Getter for the number of merged platforms. */
+	FORCEINLINE int32 GetMeshesNumber() const { return MeshesNumber; }
+
+	virtual UBodySetup* GetBodySetup() override;
+
+	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+
+private:
+	/** Body setup with the shapes of all merged platforms. */
+	UPROPERTY(Transient)
+	UBodySetup* ChunkBodySetup;
+
+	/** Number of merged platforms. */
+	int32 MeshesNumber;
+};
\ No newline at end of file
@@ -0,0 +1,166 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Engine/NetSerialization.h"
+
+class USceneComponent;
+class UStaticMesh;
+class UStaticMeshComponent;
+class UMaterialInterface;
+class UHierarchicalInstancedStaticMeshComponent;
+class UCPP_PlatformChunkCollision;
+
+#include "CPP_PlatformInstances.generated.h"
+
+/**
+ * Structure for storing one type (mesh with its materials
+ * and collision) of the instanced platforms.
+ */
+USTRUCT()
+struct FPlatformInstanceType
+{
+	GENERATED_BODY()
+
+	/** Static mesh of the platform. */
+	UPROPERTY()
+	UStaticMesh* Mesh = nullptr;
+
+	/** Override materials of the platform's mesh. */
+	UPROPERTY()
+	TArray<UMaterialInterface*> Materials;
+
+	/** Collision profile of the platform's mesh. */
+	UPROPERTY()
+	FName CollisionProfileName = NAME_None;
+
+	/** Transform of the mesh relative to the platform. */
+	UPROPERTY()
+	FTransform RelativeTransform = FTransform::Identity;
+};
+
+/** Structure for storing one instanced platform. */
+USTRUCT()
+struct FPlatformInstance
+{
+	GENERATED_BODY()
+
+	/** Index of the platform's type. */
+	UPROPERTY()
+	uint8 TypeIndex = 0;
+
+	/** Location of the platform. */
+	UPROPERTY()
+	FVector_NetQuantize Location = FVector::ZeroVector;
+
+	/** Rotation of the platform around the Z axis. */
+	UPROPERTY()
+	float Yaw = 0.0f;
+};
+
+/**
+ * Actor for rendering the platforms without any behavior.
+ * Is spawned by the platform spawner on the server and
+ * keeps one hierarchical instanced static mesh component
+ * for every platform type instead of one actor per
+ * platform. The collision of the platforms is merged into
+ * one compound body per chunk of the grid (the meshes with
+ * complex or convex collision keep the collision of their
+ * instanced components). The list of instances is
+ * replicated, and every machine builds its components
+ * from it.
+ */
+UCLASS()
+class CATPLATFORMER_API ACPP_PlatformInstances : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	/** The constructor to set default variables. */
+	ACPP_PlatformInstances();
+
+protected:
+	/**
+	 * Function for storing logic that should be applied in
+	 * the end of the actor's life (but before its destroying).
+	 * @param EndPlayReason Specifies why an actor is being
+	 * deleted/removed from a level.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * Returns the properties used for network replication.
+	 * @param OutLifetimeProps Lifetime properties.
+	 */
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+public:
+	/**
+	 * Function for adding the platform. Is called on the
+	 * server (before BuildInstances).
+	 * @param Template Static mesh component of the
+	 * platform's class default object.
+	 * @param Transform Transform of the platform.
+	 * @return Was the platform added?
+	 */
+	bool AddPlatform(const UStaticMeshComponent* Template, const FTransform& Transform);
+
+	/**
+	 * Function for creating the components after all
+	 * platforms were added. Is called on the server, the
+	 * clients call it after the replication.
+	 */
+	void BuildInstances();
+
+	/** Getter for the number of instanced platforms. */
+	FORCEINLINE int32 GetInstancesNumber() const { return Instances.Num(); }
+
+private:
+	/** Root for actor's components. */
+	UPROPERTY(VisibleAnywhere, Category = "Components")
+	USceneComponent* Root;
+
+	/** Types of the instanced platforms. */
+	UPROPERTY(ReplicatedUsing = OnRep_Instances)
+	TArray<FPlatformInstanceType> Types;
+
+	/** Instanced platforms. */
+	UPROPERTY(ReplicatedUsing = OnRep_Instances)
+	TArray<FPlatformInstance> Instances;
+
+	/**
+	 * Function for building the components on the clients
+	 * (after the types or the instances were replicated).
+	 */
+	UFUNCTION()
+	void OnRep_Instances();
+
+	/** Components of the types (one for every type). */
+	UPROPERTY()
+	TArray<UHierarchicalInstancedStaticMeshComponent*> Components;
+
+	/** Size of the collision chunk's side. */
+	UPROPERTY(EditDefaultsOnly, Category = "Collision", meta = (ClampMin = "100.0"))
+	float CollisionChunkSize;
+
+	/** Components with the merged collision of the chunks. */
+	UPROPERTY()
+	TArray<UCPP_PlatformChunkCollision*> CollisionChunks;
+
+	/**
+	 * Function for destroying the components that were
+	 * built before.
+	 */
+	void DestroyComponents();
+
+	/**
+	 * Function for finding (or adding) the type of the
+	 * platform.
+	 * @param Template Static mesh component of the
+	 * platform's class default object.
+	 * @return Index of the type or INDEX_NONE.
+	 */
+	int32 FindOrAddType(const UStaticMeshComponent* Template);
+};
\ No newline at end of file
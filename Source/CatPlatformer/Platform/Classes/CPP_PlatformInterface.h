@@ -0,0 +1,45 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+
+class ACPP_Character;
+
+#include "CPP_PlatformInterface.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UCPP_PlatformInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Interface of the platforms that react to the characters
+ * standing on them. The character finds the platform from
+ * the movement component's current floor and calls the
+ * functions when its floor changes (on every machine that
+ * moves the character), so no overlap components are
+ * needed.
+ */
+class CATPLATFORMER_API ICPP_PlatformInterface
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Function that is called when the character starts
+	 * standing on the platform.
+	 * @param Character Player character.
+	 */
+	virtual void CharacterEnteredPlatform(ACPP_Character* Character) = 0;
+
+	/**
+	 * Function that is called when the character stops
+	 * standing on the platform (jumps, falls, walks to
+	 * another floor or is destroyed).
+	 * @param Character Player character.
+	 */
+	virtual void CharacterLeftPlatform(ACPP_Character* Character) = 0;
+};
\ No newline at end of file
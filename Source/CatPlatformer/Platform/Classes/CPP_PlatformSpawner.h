@@ -36,6 +36,18 @@ class ACPP_GameMode;
 class UCPP_GameInstance;
 class UGameInstance;
 
+#ifndef CPP_PLATFORMINSTANCES_H
+#define CPP_PLATFORMINSTANCES_H
+#include "CatPlatformer/Platform/Classes/CPP_PlatformInstances.h"
+#endif
+class ACPP_PlatformInstances;
+
+#ifndef CPP_LEVELSTATE_H
+#define CPP_LEVELSTATE_H
+#include "CatPlatformer/Platform/Classes/CPP_LevelState.h"
+#endif
+class ACPP_LevelState;
+
 #include "CPP_PlatformSpawner.generated.h"
 
 /**
@@ -55,6 +67,20 @@ class CATPLATFORMER_API UCPP_PlatformSpawner : public UObject
 	/** Reference to the instance of ACPP_GameMode class. */
 	TWeakObjectPtr<ACPP_GameMode> GameModeRef;
 
+	/**
+	 * Actor with the instanced meshes of the platforms
+	 * without any behavior.
+	 */
+	UPROPERTY()
+	ACPP_PlatformInstances* PlatformInstances;
+
+	/**
+	 * Actor with the replicated states of the platforms with
+	 * behavior (the platforms themselves are local actors).
+	 */
+	UPROPERTY()
+	ACPP_LevelState* LevelState;
+
 public:
 	/**
 	 * Function for initializing GameInstanceRef variable.
@@ -19,12 +19,13 @@ class ACharacter;
 #endif
 class ACPP_EnemyCharacter;
 class USceneComponent;
-class UBoxComponent;
 
 #include "CPP_PlatformWithNPC.generated.h"
 
 /**
- * Platform with some NPC on it.
+ * Platform with some NPC on it. With the swarm mode the
+ * crow is spawned as a proxy of the crow simulation and
+ * gets its actor only when players are near.
  */
 UCLASS(Blueprintable)
 class CATPLATFORMER_API ACPP_PlatformWithNPC : public ACPP_Platform
@@ -50,49 +51,18 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/**
-	 * Function for replying to the start of overlap with a
-	 * static mesh component.
-	 * @param OverlappedComponent The component whose
-	 * intersection we are checking (CollisionBox).
-	 * @param OtherActor The actor who overlapped the
-	 * component being checked.
-	 * @param OtherComp The component that overlaps with the
-	 * component being checked.
-	 * @param OtherBodyIndex Refers to the index of the
-	 * specific primitive component of the other actor that
-	 * the current actor is overlapping with.
-	 * This is useful when the other actor has multiple
-	 * primitive components, and you want to know which one
-	 * is causing the overlap.
-	 * @param bFromSweep It returns True or False, depending
-	 * on whether something overlaps the collision.
-	 * @param SweepResult Hit result structure needed to
-	 * access some additional outputs.
+	 * Function that is called when the character starts
+	 * standing on the platform.
+	 * @param Character Player character.
 	 */
-	UFUNCTION()
-	void CollisionBoxOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-	                              UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
-	                              const FHitResult& SweepResult);
+	virtual void CharacterEnteredPlatform(ACPP_Character* Character) override;
 
 	/**
-	 * Function for replying to the end of overlap with a
-	 * box component.
-	 * @param OverlappedComponent The component whose
-	 * intersection we are checking (CollisionBox).
-	 * @param OtherActor The actor who overlapped the
-	 * component being checked.
-	 * @param OtherComp The component that overlaps with the
-	 * component being checked.
-	 * @param OtherBodyIndex Refers to the index of the
-	 * specific primitive component of the other actor that
-	 * the current actor is overlapping with.
-	 * This is useful when the other actor has multiple
-	 * primitive components, and you want to know which one
-	 * is causing the overlap.
+	 * Function that is called when the character stops
+	 * standing on the platform.
+	 * @param Character Player character.
 	 */
-	UFUNCTION()
-	void CollisionBoxOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-	                            UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+	virtual void CharacterLeftPlatform(ACPP_Character* Character) override;
 
 	/** Timer handle for calling enemy spawning. */
 	FTimerHandle TH_SpawnCrow;
@@ -107,14 +77,28 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
 	USceneComponent* Target_For_NPC_Spawning;
 
-	/** Collision box for detecting characters. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
-	UBoxComponent* CollisionBox;
-
 	/** Class of NPC that should be spawned on the platform. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NPC")
 	TSubclassOf<ACharacter> NPC_Class;
 
+	/**
+	 * Should the crow be spawned as a proxy of the crow
+	 * simulation (swarm mode for the levels with lots of
+	 * enemies)?
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NPC")
+	bool bSpawnCrowAsProxy;
+
 	UPROPERTY()
 	ACPP_EnemyCharacter* EnemyRef;
+
+public:
+	/**
+	 * Setter for the platform's enemy. Is called by the
+	 * crow simulation when the crow is promoted (or
+	 * demoted). Players that are already on the platform
+	 * are passed to the new enemy.
+	 * @param NewEnemy Spawned enemy character or nullptr.
+	 */
+	void SetEnemy(ACPP_EnemyCharacter* NewEnemy);
 };
@@ -26,16 +26,18 @@ protected:
 	ACPP_RotatingPlatform();
 
 	/**
-	 * Returns the properties used for network replication.
-	 * @param OutLifetimeProps Lifetime properties.
+	 * Function for storing logic that should be applied
+	 * when the actor appears in the game world.
 	 */
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void BeginPlay() override;
 
-	/** 
-	 * Function that is called every frame.
-	 * Is needed for updating platform's location.
+	/**
+	 * Function for storing logic that should be applied in
+	 * the end of the actor's life (but before its destroying).
+	 * @param EndPlayReason Specifies why an actor is being
+	 * deleted/removed from a level.
 	 */
-	virtual void Tick(float DeltaSeconds) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Flag indicating if basic variables were initialized. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -46,8 +48,12 @@ protected:
 	 * actor appears in the game world.
 	 * Should be called before BeginPlay() (between
 	 * SpawnActorDeferred() and FinishSpawningActor()).
+	 * @param NewCellIndex Index of the platform's cell.
+	 * @param StartLocation Start location of the platform.
+	 * @param RandomStream Stream for the random variables.
 	 */
-	virtual void InitializeBasicVariables_Implementation(const FVector StartLocation) override;
+	virtual void InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+	                                      FRandomStream& RandomStream) override;
 
 	/** Function for starting the platform's rotation. */
 	virtual void ApplyPlatformProperty() override;
@@ -60,13 +66,26 @@ private:
 	UFUNCTION()
 	void InitialPlatformRotation() const;
 
+	/**
+	 * Identifier of the rotation's update in the tick budget
+	 * manager.
+	 */
+	int32 BudgetedUpdateId;
+
+	/**
+	 * Function for updating the platform's rotation. Is
+	 * called by the tick budget manager.
+	 * @param DeltaSeconds Time since the previous update.
+	 */
+	void UpdatePlatformRotation(const float DeltaSeconds);
+
 	/**
 	 * Function for rotating the platform. Is called from the
-	 * tick event.
+	 * budgeted update (on every machine, the platform isn't
+	 * replicated).
+	 * @param DeltaSeconds Time of the rotation.
 	 */
-	UFUNCTION(Server, Reliable)
 	void RotatePlatform(const float DeltaSeconds);
-	void RotatePlatform_Implementation(const float DeltaSeconds);
 
 protected:
 	/**
@@ -83,7 +102,6 @@ protected:
 	 * Flag indicating if the platform should simulate Y-axis
 	 * rotating.
 	 */
-	UPROPERTY(Replicated)
 	bool bUseAxisY;
 
 	/** Rotation speed. */
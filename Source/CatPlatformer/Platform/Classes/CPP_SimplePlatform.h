@@ -13,7 +13,8 @@ class ACPP_Platform;
 #include "CPP_SimplePlatform.generated.h"
 
 /**
- * Platform with no effect on players.
+ * Platform with no effect on players. Is rendered as an
+ * instance by default (see ACPP_PlatformInstances).
  */
 UCLASS(Blueprintable)
 class CATPLATFORMER_API ACPP_SimplePlatform : public ACPP_Platform
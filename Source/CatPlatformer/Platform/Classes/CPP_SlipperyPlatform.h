@@ -10,10 +10,9 @@
 #endif
 class ACPP_Platform;
 
-#include "Components/AudioComponent.h"
 #include "Components/TimelineComponent.h"
 class UTimelineComponent;
-class UBoxComponent;
+class USoundBase;
 
 #include "CPP_SlipperyPlatform.generated.h"
 
@@ -44,82 +43,53 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/**
-	 * Returns the properties used for network replication.
-	 * @param OutLifetimeProps Lifetime properties.
+	 * Sound of the ice that is played while any player is
+	 * sliding on the platform.
 	 */
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Sound")
+	USoundBase* IceSound;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-	UAudioComponent* IceAudioComponent;
+	/**
+	 * Identifier of the ice sound in the UCPP_SFXPool
+	 * subsystem (0 if the sound isn't playing).
+	 */
+	int32 IceSoundId;
 
 	/**
 	 * Function for initializing variables before this
 	 * actor appears in the game world.
 	 * Should be called before BeginPlay() (between
 	 * SpawnActorDeferred() and FinishSpawningActor()).
+	 * @param NewCellIndex Index of the platform's cell.
+	 * @param StartLocation Start location of the platform.
+	 * @param RandomStream Stream for the random variables.
 	 */
-	virtual void InitializeBasicVariables_Implementation(const FVector StartLocation) override;
-
-	/**
-	 * Function for replying to the start of overlap with a
-	 * static mesh component.
-	 * @param OverlappedComponent The component whose
-	 * intersection we are checking (CollisionBox).
-	 * @param OtherActor The actor who overlapped the
-	 * component being checked.
-	 * @param OtherComp The component that overlaps with the
-	 * component being checked.
-	 * @param OtherBodyIndex Refers to the index of the
-	 * specific primitive component of the other actor that
-	 * the current actor is overlapping with.
-	 * This is useful when the other actor has multiple
-	 * primitive components, and you want to know which one
-	 * is causing the overlap.
-	 * @param bFromSweep It returns True or False, depending
-	 * on whether something overlaps the collision.
-	 * @param SweepResult Hit result structure needed to
-	 * access some additional outputs.
+	virtual void InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+	                                      FRandomStream& RandomStream) override;
+
+	/**
+	 * Function that is called when the character starts
+	 * standing on the platform.
+	 * @param Character Player character.
 	 */
-	UFUNCTION()
-	void CollisionBoxOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-	                              UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
-	                              const FHitResult& SweepResult);
-
-	/**
-	 * Function for replying to the end of overlap with a
-	 * box component.
-	 * @param OverlappedComponent The component whose
-	 * intersection we are checking (CollisionBox).
-	 * @param OtherActor The actor who overlapped the
-	 * component being checked.
-	 * @param OtherComp The component that overlaps with the
-	 * component being checked.
-	 * @param OtherBodyIndex Refers to the index of the
-	 * specific primitive component of the other actor that
-	 * the current actor is overlapping with.
-	 * This is useful when the other actor has multiple
-	 * primitive components, and you want to know which one
-	 * is causing the overlap.
+	virtual void CharacterEnteredPlatform(ACPP_Character* Character) override;
+
+	/**
+	 * Function that is called when the character stops
+	 * standing on the platform.
+	 * @param Character Player character.
 	 */
-	UFUNCTION()
-	void CollisionBoxOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-	                            UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+	virtual void CharacterLeftPlatform(ACPP_Character* Character) override;
 
 	/**
-	 * Function for turning on or off the ice sound. 
+	 * Function for turning on or off the ice sound. Is
+	 * called locally on every machine (the characters'
+	 * floors are checked on clients too), so no RPC is
+	 * needed.
 	 * @param bTurnOn If true, sound should start playing.
 	 * If false, sound should stop playing.
 	 */
-	UFUNCTION(Client, Unreliable)
 	void SwitchSoundState(const bool bTurnOn);
-	void SwitchSoundState_Implementation(const bool bTurnOn);
-
-	/**
-	 * Collision box to check if the player has stepped on
-	 * the surface of the platform.
-	 */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Components")
-	UBoxComponent* CollisionBox;
 
 	//======================Timeline===============================
 
@@ -170,8 +140,10 @@ protected:
 	/**
 	 * Type of the platform appearance. If true, basic
 	 * platform material should be changed to another one.
+	 * Is chosen by the platform's random seed, so it's the
+	 * same on every machine.
 	 */
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	bool bPlatformAppearanceType;
 
 private:
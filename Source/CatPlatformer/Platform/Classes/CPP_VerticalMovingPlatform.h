@@ -40,9 +40,13 @@ protected:
 	 * actor appears in the game world.
 	 * Should be called before BeginPlay() (between
 	 * SpawnActorDeferred() and FinishSpawningActor()).
+	 * @param NewCellIndex Index of the platform's cell.
+	 * @param StartLocation Start location of the platform.
+	 * @param RandomStream Stream for the random variables.
 	 */
-	virtual void InitializeBasicVariables_Implementation(const FVector StartLocation) override;
-	
+	virtual void InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+	                                      FRandomStream& RandomStream) override;
+
 	//=========Timeline for vertical actor's position==============
 public:
 	/**
@@ -95,6 +99,12 @@ private:
 	 */
 	bool bIsMovingUp;
 
+	/**
+	 * Random timeline's position at the moment the platforms
+	 * were spawned.
+	 */
+	float StartTime;
+
 protected:
 	/**
 	 * The offset for playing the animation of the actor's
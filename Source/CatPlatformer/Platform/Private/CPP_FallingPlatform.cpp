@@ -2,7 +2,6 @@
 
 #include "../Classes/CPP_FallingPlatform.h"
 #include "Net/UnrealNetwork.h"
-#include "Components/BoxComponent.h"
 
 #ifndef CPP_CHARACTER_H
 #define CPP_CHARACTER_H
@@ -16,12 +15,11 @@ ACPP_FallingPlatform::ACPP_FallingPlatform()
 	PlatformBase = CreateDefaultSubobject<UStaticMeshComponent>(FName(TEXT("SM Platform Base")));
 	PlatformBase->SetupAttachment(RootComponent);
 
-	CollisionBox = CreateDefaultSubobject<UBoxComponent>(FName(TEXT("Collision")));
-	CollisionBox->SetupAttachment(PlatformBase);
-
 	TimelineComp = CreateDefaultSubobject<UTimelineComponent>(FName(TEXT("Timeline Component")));
+	bIsAnimated = true;
 
 	StartTransform = FTransform();
+	CurrentPhase = EPlatformPhase::Idle;
 	StartRotation = FRotator(0.0f);
 	EndRotation = FRotator(0.0f);
 
@@ -36,121 +34,155 @@ void ACPP_FallingPlatform::BeginPlay()
 
 	StartTransform = GetActorTransform();
 
-	if (HasAuthority())
+	// The shaking is played locally on every machine.
+	if (CurveVector)
 	{
-		CollisionBox->OnComponentBeginOverlap.AddDynamic(this, &ACPP_FallingPlatform::CollisionBoxOverlapBegin);
-		CollisionBox->OnComponentEndOverlap.AddDynamic(this, &ACPP_FallingPlatform::CollisionBoxOverlapEnd);
-
-		TimelineComp->SetIsReplicated(true);
-		if (CurveVector)
-		{
-			StartRotation = GetActorRotation();
-			// X = Roll, Y = Pitch, Z = Yaw.
-			EndRotation = FRotator(StartRotation.Pitch + ShakingOffset,
-			                       StartRotation.Yaw,
-			                       StartRotation.Roll + ShakingOffset);
+		StartRotation = GetActorRotation();
+		// X = Roll, Y = Pitch, Z = Yaw.
+		EndRotation = FRotator(StartRotation.Pitch + ShakingOffset,
+		                       StartRotation.Yaw,
+		                       StartRotation.Roll + ShakingOffset);
 
-			TimelineProgressDelegate.BindUFunction(this, FName(TEXT("ShakingTimelineProgress")));
+		TimelineProgressDelegate.BindUFunction(this, FName(TEXT("ShakingTimelineProgress")));
 
-			TimelineComp->AddInterpVector(CurveVector, TimelineProgressDelegate);
-			TimelineComp->SetLooping(true);
-			TimelineComp->SetIgnoreTimeDilation(true);
-		}
+		TimelineComp->AddInterpVector(CurveVector, TimelineProgressDelegate);
+		TimelineComp->SetLooping(true);
+		TimelineComp->SetIgnoreTimeDilation(true);
 	}
 }
 
 void ACPP_FallingPlatform::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (HasAuthority())
+	GetWorld()->GetTimerManager().ClearTimer(TH_ShakingTimer);
+	GetWorld()->GetTimerManager().ClearTimer(TH_FallingTimer);
+	if (CurveVector)
 	{
-		CollisionBox->OnComponentEndOverlap.RemoveDynamic(this, &ACPP_FallingPlatform::CollisionBoxOverlapEnd);
-		CollisionBox->OnComponentBeginOverlap.RemoveDynamic(this, &ACPP_FallingPlatform::CollisionBoxOverlapBegin);
-
-		if (CurveVector)
-		{
-			TimelineProgressDelegate.Unbind();
-		}
+		TimelineProgressDelegate.Unbind();
 	}
 	Super::EndPlay(EndPlayReason);
 }
 
-void ACPP_FallingPlatform::InitializeBasicVariables_Implementation(const FVector StartLocation)
+void ACPP_FallingPlatform::InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+                                                    FRandomStream& RandomStream)
 {
-	if (!HasAuthority())
-		return;
+	Super::InitializeBasicVariables(NewCellIndex, StartLocation, RandomStream);
 
-	FallingSpeed = FMath::FRandRange(9.0f, 12.0f);
-	SecondsBeforeFall = FMath::FRandRange(2.5f, 5.0f);
+	FallingSpeed = RandomStream.FRandRange(9.0f, 12.0f);
+	SecondsBeforeFall = RandomStream.FRandRange(2.5f, 5.0f);
 }
 
-void ACPP_FallingPlatform::CollisionBoxOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-                                                    UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
-                                                    bool bFromSweep, const FHitResult& SweepResult)
+void ACPP_FallingPlatform::CharacterEnteredPlatform(ACPP_Character* Character)
 {
-	if (!HasAuthority())
+	Super::CharacterEnteredPlatform(Character);
+
+	if (!IsOnServer() || !IsValid(Character))
 		return;
 
-	if (ACPP_Character* Character = Cast<ACPP_Character>(OtherActor))
+	Character->SetIsOnGrass(true);
+	if (ACPP_LevelState* LevelState = GetLevelState(); IsValid(LevelState) && CurrentPhase == EPlatformPhase::Idle)
 	{
-		Character->SetIsOnGrass(true);
-		if (!GetWorld()->GetTimerManager().TimerExists(TH_FallingTimer))
-		{
-			GetWorld()->GetTimerManager().SetTimer(
-				TH_FallingTimer,
-				this,
-				&ACPP_FallingPlatform::Falling,
-				0.025f,
-				true,
-				SecondsBeforeFall);
-
-			if (!TimelineComp->IsPlaying())
-			{
-				TimelineComp->PlayFromStart();
-			}
-		}
+		LevelState->SetPlatformPhase(CellIndex, EPlatformPhase::Shaking);
 	}
 }
 
-void ACPP_FallingPlatform::CollisionBoxOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-                                                  UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void ACPP_FallingPlatform::CharacterLeftPlatform(ACPP_Character* Character)
 {
-	if (!HasAuthority())
+	Super::CharacterLeftPlatform(Character);
+
+	if (!IsOnServer() || !IsValid(Character))
 		return;
 
-	if (ACPP_Character* Character = Cast<ACPP_Character>(OtherActor))
-	{
-		Character->SetIsOnGrass(false);
-	}
+	Character->SetIsOnGrass(false);
 }
 
-void ACPP_FallingPlatform::Falling()
+void ACPP_FallingPlatform::ApplyPlatformState(const FPlatformState& State)
 {
-	if (!HasAuthority())
+	Super::ApplyPlatformState(State);
+
+	if (State.Phase == CurrentPhase)
 		return;
 
-	if (TimelineComp->IsPlaying())
+	CurrentPhase = State.Phase;
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	const ACPP_LevelState* LevelState = GetLevelState();
+	// The state can come late (or be applied while joining
+	// the game), so the time since the phase's start is
+	// taken into account.
+	const float PhaseSeconds = IsValid(LevelState)
+		                           ? FMath::Max(LevelState->GetServerTime() - State.PhaseStartTime, 0.0f)
+		                           : 0.0f;
+
+	switch (State.Phase)
 	{
-		TimelineComp->Stop();
-	}
+	case EPlatformPhase::Shaking:
+		{
+			if (CurveVector)
+			{
+				TimelineComp->PlayFromStart();
+				TimelineComp->SetPlaybackPosition(
+					FMath::Fmod(PhaseSeconds, FMath::Max(TimelineComp->GetTimelineLength(), KINDA_SMALL_NUMBER)),
+					false);
+			}
+			if (IsOnServer())
+			{
+				TimerManager.SetTimer(TH_ShakingTimer, this, &ACPP_FallingPlatform::StartFalling,
+				                      FMath::Max(SecondsBeforeFall - PhaseSeconds, KINDA_SMALL_NUMBER), false);
+			}
+			break;
+		}
+	case EPlatformPhase::Falling:
+		{
+			TimelineComp->Stop();
+			TimerManager.ClearTimer(TH_ShakingTimer);
 
-	AddActorWorldOffset(FVector(0.0f, 0.0f, -FallingSpeed));
+			const int32 MissedSteps = FMath::FloorToInt32(PhaseSeconds / FallingStepSeconds);
+			if (MissedSteps > 0)
+			{
+				AddActorWorldOffset(FVector(0.0f, 0.0f, -FallingSpeed * MissedSteps));
+			}
+			TimerManager.SetTimer(TH_FallingTimer, this, &ACPP_FallingPlatform::Falling,
+			                      FallingStepSeconds, true);
+			break;
+		}
+	case EPlatformPhase::Idle:
+	default:
+		{
+			TimelineComp->Stop();
+			TimerManager.ClearTimer(TH_ShakingTimer);
+			TimerManager.ClearTimer(TH_FallingTimer);
+			TeleportPlatformToStartPosition();
+			break;
+		}
+	}
+}
 
-	if (GetActorLocation().Z <= -1200.0f)
+void ACPP_FallingPlatform::StartFalling()
+{
+	if (ACPP_LevelState* LevelState = GetLevelState(); IsValid(LevelState) && IsOnServer())
 	{
-		TeleportPlatformToStartPosition();
+		LevelState->SetPlatformPhase(CellIndex, EPlatformPhase::Falling);
 	}
 }
 
-void ACPP_FallingPlatform::TeleportPlatformToStartPosition_Implementation()
+void ACPP_FallingPlatform::Falling()
 {
-	if (!HasAuthority())
-		return;
-
-	if (GetWorld()->GetTimerManager().TimerExists(TH_FallingTimer))
+	if (GetActorLocation().Z <= -1200.0f)
 	{
+		// The server returns the platform, the clients wait
+		// for the new phase below the level.
 		GetWorld()->GetTimerManager().ClearTimer(TH_FallingTimer);
+		if (ACPP_LevelState* LevelState = GetLevelState(); IsValid(LevelState) && IsOnServer())
+		{
+			LevelState->SetPlatformPhase(CellIndex, EPlatformPhase::Idle);
+		}
+		return;
 	}
 
+	AddActorWorldOffset(FVector(0.0f, 0.0f, -FallingSpeed));
+}
+
+void ACPP_FallingPlatform::TeleportPlatformToStartPosition()
+{
 	TeleportTo(StartTransform.GetLocation(), StartTransform.Rotator());
 }
 
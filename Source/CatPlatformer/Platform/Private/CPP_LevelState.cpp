@@ -0,0 +1,219 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_LevelState.h"
+#include "GameFramework/GameStateBase.h"
+#include "Kismet/GameplayStatics.h"
+#include "Net/UnrealNetwork.h"
+
+#ifndef CPP_PLATFORM_H
+#define CPP_PLATFORM_H
+#include "CatPlatformer/Platform/Classes/CPP_Platform.h"
+#endif
+
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+void FPlatformState::PostReplicatedAdd(const FPlatformStateArray& InArraySerializer)
+{
+	if (IsValid(InArraySerializer.Owner))
+	{
+		InArraySerializer.Owner->SpawnPlatform(*this);
+	}
+}
+
+void FPlatformState::PostReplicatedChange(const FPlatformStateArray& InArraySerializer)
+{
+	if (IsValid(InArraySerializer.Owner))
+	{
+		InArraySerializer.Owner->ApplyPlatformState(*this);
+	}
+}
+
+void FPlatformState::PreReplicatedRemove(const FPlatformStateArray& InArraySerializer)
+{
+	if (IsValid(InArraySerializer.Owner))
+	{
+		InArraySerializer.Owner->DestroyPlatform(CellIndex);
+	}
+}
+
+ACPP_LevelState::ACPP_LevelState() : LayoutStartTime(0.0f)
+{
+	Root = CreateDefaultSubobject<USceneComponent>(FName(TEXT("Root")));
+	Root->SetMobility(EComponentMobility::Static);
+	SetRootComponent(Root);
+
+	Platforms.Owner = this;
+
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	NetUpdateFrequency = 10.0f;
+	PrimaryActorTick.bCanEverTick = false;
+}
+
+void ACPP_LevelState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (const TPair<int32, ACPP_Platform*>& Pair : LocalPlatforms)
+	{
+		if (IsValid(Pair.Value))
+		{
+			Pair.Value->Destroy();
+		}
+	}
+	LocalPlatforms.Empty();
+	SET_DWORD_STAT(STAT_Cat_LocalPlatforms, 0);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ACPP_LevelState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ACPP_LevelState, PlatformClasses);
+	DOREPLIFETIME(ACPP_LevelState, Platforms);
+	DOREPLIFETIME(ACPP_LevelState, LayoutStartTime);
+}
+
+bool ACPP_LevelState::AddPlatform(UClass* PlatformClass, const int32 CellIndex, const FTransform& Transform)
+{
+	if (!HasAuthority() || !IsValid(PlatformClass) || !PlatformClass->IsChildOf<ACPP_Platform>())
+		return false;
+
+	int32 ClassIndex = PlatformClasses.IndexOfByKey(PlatformClass);
+	if (ClassIndex == INDEX_NONE)
+	{
+		// The class's index is replicated as a byte.
+		if (PlatformClasses.Num() > MAX_uint8)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Too many platform classes, %s isn't added."), *PlatformClass->GetName());
+			return false;
+		}
+		ClassIndex = PlatformClasses.Add(PlatformClass);
+	}
+
+	if (Platforms.Items.Num() == 0)
+	{
+		LayoutStartTime = GetServerTime();
+	}
+
+	FPlatformState& State = Platforms.Items.AddDefaulted_GetRef();
+	State.CellIndex = CellIndex;
+	State.ClassIndex = static_cast<uint8>(ClassIndex);
+	State.Location = Transform.GetLocation();
+	State.Yaw = Transform.Rotator().Yaw;
+	State.RandomSeed = FMath::Rand();
+	Platforms.MarkItemDirty(State);
+	return true;
+}
+
+void ACPP_LevelState::SpawnPlatforms()
+{
+	for (const FPlatformState& State : Platforms.Items)
+	{
+		SpawnPlatform(State);
+	}
+}
+
+void ACPP_LevelState::SpawnPlatform(const FPlatformState& State)
+{
+	if (LocalPlatforms.Contains(State.CellIndex))
+		return;
+
+	// The class can be replicated later than the state.
+	if (!PlatformClasses.IsValidIndex(State.ClassIndex) || !IsValid(PlatformClasses[State.ClassIndex]))
+		return;
+
+	// The name is the same on every machine, so the
+	// characters' movement bases can be replicated.
+	FActorSpawnParameters Params;
+	Params.Name = FName(*FString::Printf(TEXT("LevelPlatform_%d"), State.CellIndex));
+	Params.Owner = this;
+	Params.bDeferConstruction = true;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	const FTransform Transform(FRotator(0.0f, State.Yaw, 0.0f), State.Location);
+	ACPP_Platform* Platform = GetWorld()->SpawnActor<ACPP_Platform>(
+		PlatformClasses[State.ClassIndex], FTransform::Identity, Params);
+	if (!IsValid(Platform))
+		return;
+
+	// Every machine gets the same random variables.
+	FRandomStream RandomStream(State.RandomSeed);
+	Platform->InitializeBasicVariables(State.CellIndex, State.Location, RandomStream);
+	Platform->SetNetAddressable();
+
+	UGameplayStatics::FinishSpawningActor(Platform, Transform);
+	LocalPlatforms.Add(State.CellIndex, Platform);
+	SET_DWORD_STAT(STAT_Cat_LocalPlatforms, LocalPlatforms.Num());
+
+	// Join in progress: the platform can be in the middle of
+	// its phase.
+	if (State.Phase != EPlatformPhase::Idle)
+	{
+		Platform->ApplyPlatformState(State);
+	}
+}
+
+void ACPP_LevelState::SetPlatformPhase(const int32 CellIndex, const EPlatformPhase NewPhase)
+{
+	if (!HasAuthority())
+		return;
+
+	FPlatformState* State = Platforms.Items.FindByPredicate([CellIndex](const FPlatformState& Other)
+	{
+		return Other.CellIndex == CellIndex;
+	});
+	if (!State || State->Phase == NewPhase)
+		return;
+
+	State->Phase = NewPhase;
+	State->PhaseStartTime = GetServerTime();
+	if (NewPhase == EPlatformPhase::Idle)
+	{
+		State->RespawnTime = State->PhaseStartTime;
+	}
+	Platforms.MarkItemDirty(*State);
+
+	// The replication callbacks aren't called on the server.
+	ApplyPlatformState(*State);
+}
+
+void ACPP_LevelState::ApplyPlatformState(const FPlatformState& State)
+{
+	if (ACPP_Platform** Platform = LocalPlatforms.Find(State.CellIndex); Platform && IsValid(*Platform))
+	{
+		(*Platform)->ApplyPlatformState(State);
+	}
+}
+
+void ACPP_LevelState::DestroyPlatform(const int32 CellIndex)
+{
+	ACPP_Platform* Platform = nullptr;
+	if (LocalPlatforms.RemoveAndCopyValue(CellIndex, Platform) && IsValid(Platform))
+	{
+		Platform->Destroy();
+	}
+	SET_DWORD_STAT(STAT_Cat_LocalPlatforms, LocalPlatforms.Num());
+}
+
+float ACPP_LevelState::GetServerTime() const
+{
+	if (const AGameStateBase* GameState = GetWorld()->GetGameState(); IsValid(GameState))
+	{
+		return static_cast<float>(GameState->GetServerWorldTimeSeconds());
+	}
+	return GetWorld()->GetTimeSeconds();
+}
+
+float ACPP_LevelState::GetSecondsSinceLayoutStart() const
+{
+	return FMath::Max(GetServerTime() - LayoutStartTime, 0.0f);
+}
+
+void ACPP_LevelState::OnRep_PlatformClasses()
+{
+	SpawnPlatforms();
+}
\ No newline at end of file
@@ -2,15 +2,22 @@
 
 #include "../Classes/CPP_Platform.h"
 
+#ifndef CPP_SIGNIFICANCEMANAGER_H
+#define CPP_SIGNIFICANCEMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_SignificanceManager.h"
+#endif
+
 ACPP_Platform::ACPP_Platform()
 {
 	Root = CreateDefaultSubobject<USceneComponent>(FName(TEXT("Root")));
 	SetRootComponent(Root);
 
 	PlatformBase = nullptr;
-	
-	bReplicates = true;
-	bAlwaysRelevant = true;
+	bIsAnimated = false;
+	bRenderAsInstance = false;
+	CellIndex = INDEX_NONE;
+
+	bReplicates = false;
 	PrimaryActorTick.bCanEverTick = false;
 }
 
@@ -19,12 +26,61 @@ void ACPP_Platform::BeginPlay()
 	Super::BeginPlay();
 
 	ApplyPlatformProperty();
+
+	if (bIsAnimated)
+	{
+		if (UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+			IsValid(SignificanceManager))
+		{
+			SignificanceManager->RegisterActor(this);
+		}
+	}
+}
+
+void ACPP_Platform::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bIsAnimated)
+	{
+		if (UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+			IsValid(SignificanceManager))
+		{
+			SignificanceManager->UnregisterActor(this);
+		}
+	}
+	CharactersOnPlatform.Empty();
+	Super::EndPlay(EndPlayReason);
 }
 
-void ACPP_Platform::InitializeBasicVariables_Implementation(const FVector StartLocation)
+void ACPP_Platform::InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+                                             FRandomStream& RandomStream)
 {
+	CellIndex = NewCellIndex;
+}
+
+void ACPP_Platform::ApplyPlatformState(const FPlatformState& State)
+{
+}
+
+ACPP_LevelState* ACPP_Platform::GetLevelState() const
+{
+	return Cast<ACPP_LevelState>(GetOwner());
 }
 
 void ACPP_Platform::ApplyPlatformProperty()
 {
 }
+
+void ACPP_Platform::CharacterEnteredPlatform(ACPP_Character* Character)
+{
+	CharactersOnPlatform.AddUnique(Character);
+}
+
+void ACPP_Platform::CharacterLeftPlatform(ACPP_Character* Character)
+{
+	CharactersOnPlatform.Remove(Character);
+}
+
+bool ACPP_Platform::CanBeInstanced() const
+{
+	return bRenderAsInstance && IsValid(PlatformBase) && IsValid(PlatformBase->GetStaticMesh());
+}
@@ -0,0 +1,88 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_PlatformChunkCollision.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+
+UCPP_PlatformChunkCollision::UCPP_PlatformChunkCollision(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer),
+	  ChunkBodySetup(nullptr),
+	  MeshesNumber(0)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	Mobility = EComponentMobility::Static;
+	bHiddenInGame = true;
+	SetGenerateOverlapEvents(false);
+	CanCharacterStepUpOn = ECB_Yes;
+}
+
+bool UCPP_PlatformChunkCollision::CanMergeMesh(const UStaticMesh* Mesh)
+{
+	const UBodySetup* BodySetup = IsValid(Mesh) ? Mesh->GetBodySetup() : nullptr;
+	if (!IsValid(BodySetup) || BodySetup->CollisionTraceFlag == CTF_UseComplexAsSimple)
+		return false;
+
+	// Convex shapes would have to be cooked again at runtime.
+	const FKAggregateGeom& Geometry = BodySetup->AggGeom;
+	return Geometry.ConvexElems.Num() == 0 && Geometry.TaperedCapsuleElems.Num() == 0 &&
+		Geometry.LevelSetElems.Num() == 0 && Geometry.SkinnedLevelSetElems.Num() == 0 &&
+		Geometry.BoxElems.Num() + Geometry.SphereElems.Num() + Geometry.SphylElems.Num() > 0;
+}
+
+void UCPP_PlatformChunkCollision::AddMesh(const UStaticMesh* Mesh, const FTransform& Transform)
+{
+	if (!CanMergeMesh(Mesh))
+		return;
+
+	if (!IsValid(ChunkBodySetup))
+	{
+		ChunkBodySetup = NewObject<UBodySetup>(this, NAME_None, RF_Transient);
+		ChunkBodySetup->BodySetupGuid = FGuid::NewGuid();
+		ChunkBodySetup->CollisionTraceFlag = CTF_UseSimpleAsComplex;
+		ChunkBodySetup->bGenerateMirroredCollision = false;
+		ChunkBodySetup->bDoubleSidedGeometry = false;
+		// The collision is built at runtime only.
+		ChunkBodySetup->bNeverNeedsCookedCollisionData = true;
+	}
+
+	const UBodySetup* MeshBodySetup = Mesh->GetBodySetup();
+	if (!IsValid(ChunkBodySetup->PhysMaterial))
+	{
+		ChunkBodySetup->PhysMaterial = MeshBodySetup->PhysMaterial;
+	}
+
+	// The scale is applied to the shapes' sizes, the rest of
+	// the transform to their centers and rotations.
+	const FVector Scale = Transform.GetScale3D();
+	const FTransform NoScaleTransform(Transform.GetRotation(), Transform.GetLocation());
+	FKAggregateGeom& Geometry = ChunkBodySetup->AggGeom;
+	for (const FKBoxElem& Box : MeshBodySetup->AggGeom.BoxElems)
+	{
+		FKBoxElem& NewBox = Geometry.BoxElems.Add_GetRef(Box.GetFinalScaled(Scale, FTransform::Identity));
+		NewBox.SetTransform(NewBox.GetTransform() * NoScaleTransform);
+	}
+	for (const FKSphereElem& Sphere : MeshBodySetup->AggGeom.SphereElems)
+	{
+		FKSphereElem& NewSphere = Geometry.SphereElems.Add_GetRef(Sphere.GetFinalScaled(Scale, FTransform::Identity));
+		NewSphere.SetTransform(NewSphere.GetTransform() * NoScaleTransform);
+	}
+	for (const FKSphylElem& Sphyl : MeshBodySetup->AggGeom.SphylElems)
+	{
+		FKSphylElem& NewSphyl = Geometry.SphylElems.Add_GetRef(Sphyl.GetFinalScaled(Scale, FTransform::Identity));
+		NewSphyl.SetTransform(NewSphyl.GetTransform() * NoScaleTransform);
+	}
+	MeshesNumber++;
+}
+
+UBodySetup* UCPP_PlatformChunkCollision::GetBodySetup()
+{
+	return ChunkBodySetup;
+}
+
+FBoxSphereBounds UCPP_PlatformChunkCollision::CalcBounds(const FTransform& LocalToWorld) const
+{
+	if (!IsValid(ChunkBodySetup))
+		return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector::ZeroVector, 0.0f);
+
+	return FBoxSphereBounds(ChunkBodySetup->AggGeom.CalcAABB(LocalToWorld));
+}
\ No newline at end of file
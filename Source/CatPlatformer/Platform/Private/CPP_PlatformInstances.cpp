@@ -0,0 +1,206 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_PlatformInstances.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Net/UnrealNetwork.h"
+#include "../Classes/CPP_PlatformChunkCollision.h"
+
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+ACPP_PlatformInstances::ACPP_PlatformInstances()
+{
+	Root = CreateDefaultSubobject<USceneComponent>(FName(TEXT("Root")));
+	Root->SetMobility(EComponentMobility::Static);
+	SetRootComponent(Root);
+
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	NetUpdateFrequency = 1.0f;
+	PrimaryActorTick.bCanEverTick = false;
+
+	CollisionChunkSize = 4000.0f;
+}
+
+void ACPP_PlatformInstances::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Components.Empty();
+	CollisionChunks.Empty();
+	SET_DWORD_STAT(STAT_Cat_InstancedPlatforms, 0);
+	SET_DWORD_STAT(STAT_Cat_PlatformCollisionChunks, 0);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ACPP_PlatformInstances::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ACPP_PlatformInstances, Types);
+	DOREPLIFETIME(ACPP_PlatformInstances, Instances);
+}
+
+bool ACPP_PlatformInstances::AddPlatform(const UStaticMeshComponent* Template, const FTransform& Transform)
+{
+	if (!HasAuthority())
+		return false;
+
+	const int32 TypeIndex = FindOrAddType(Template);
+	if (TypeIndex == INDEX_NONE)
+		return false;
+
+	FPlatformInstance& Instance = Instances.AddDefaulted_GetRef();
+	Instance.TypeIndex = static_cast<uint8>(TypeIndex);
+	Instance.Location = Transform.GetLocation();
+	Instance.Yaw = Transform.Rotator().Yaw;
+	return true;
+}
+
+int32 ACPP_PlatformInstances::FindOrAddType(const UStaticMeshComponent* Template)
+{
+	if (!IsValid(Template) || !IsValid(Template->GetStaticMesh()))
+		return INDEX_NONE;
+
+	UStaticMesh* Mesh = Template->GetStaticMesh();
+	const TArray<UMaterialInterface*>& Materials = Template->OverrideMaterials;
+	if (const int32 Index = Types.IndexOfByPredicate([Mesh, &Materials](const FPlatformInstanceType& Type)
+	{
+		return Type.Mesh == Mesh && Type.Materials == Materials;
+	}); Index != INDEX_NONE)
+	{
+		return Index;
+	}
+
+	// The type's index is replicated as a byte.
+	if (Types.Num() > MAX_uint8)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Too many instanced platform types, %s is spawned as an actor."),
+		       *Mesh->GetName());
+		return INDEX_NONE;
+	}
+
+	FPlatformInstanceType& Type = Types.AddDefaulted_GetRef();
+	Type.Mesh = Mesh;
+	Type.Materials = Materials;
+	Type.CollisionProfileName = Template->GetCollisionProfileName();
+	Type.RelativeTransform = Template->GetRelativeTransform();
+	return Types.Num() - 1;
+}
+
+void ACPP_PlatformInstances::DestroyComponents()
+{
+	for (UHierarchicalInstancedStaticMeshComponent* Component : Components)
+	{
+		if (IsValid(Component))
+		{
+			Component->DestroyComponent();
+		}
+	}
+	Components.Reset();
+
+	for (UCPP_PlatformChunkCollision* Chunk : CollisionChunks)
+	{
+		if (IsValid(Chunk))
+		{
+			Chunk->DestroyComponent();
+		}
+	}
+	CollisionChunks.Reset();
+}
+
+void ACPP_PlatformInstances::BuildInstances()
+{
+	DestroyComponents();
+
+	TArray<bool> TypesMergedCollision{};
+	TypesMergedCollision.SetNum(Types.Num());
+	for (int32 i = 0; i < Types.Num(); i++)
+	{
+		TypesMergedCollision[i] = UCPP_PlatformChunkCollision::CanMergeMesh(Types[i].Mesh);
+	}
+
+	// Chunks are keyed by the grid cell and the collision
+	// profile (the profile belongs to the whole body).
+	TMap<TPair<FIntPoint, FName>, UCPP_PlatformChunkCollision*> ChunksMap{};
+	const FVector ChunkOrigin = GetActorLocation();
+
+	TArray<TArray<FTransform>> TypesTransforms{};
+	TypesTransforms.SetNum(Types.Num());
+	for (const FPlatformInstance& Instance : Instances)
+	{
+		if (!TypesTransforms.IsValidIndex(Instance.TypeIndex))
+			continue;
+
+		const FPlatformInstanceType& Type = Types[Instance.TypeIndex];
+		const FTransform PlatformTransform(FRotator(0.0f, Instance.Yaw, 0.0f), Instance.Location);
+		const FTransform MeshTransform = Type.RelativeTransform * PlatformTransform;
+		TypesTransforms[Instance.TypeIndex].Add(MeshTransform);
+
+		if (!TypesMergedCollision[Instance.TypeIndex])
+			continue;
+
+		const FVector Offset = FVector(Instance.Location) - ChunkOrigin;
+		const TPair<FIntPoint, FName> ChunkKey(
+			FIntPoint(FMath::FloorToInt32(Offset.X / CollisionChunkSize),
+			          FMath::FloorToInt32(Offset.Y / CollisionChunkSize)),
+			Type.CollisionProfileName);
+		UCPP_PlatformChunkCollision*& Chunk = ChunksMap.FindOrAdd(ChunkKey);
+		if (!Chunk)
+		{
+			Chunk = NewObject<UCPP_PlatformChunkCollision>(this);
+			Chunk->SetCollisionProfileName(Type.CollisionProfileName);
+			Chunk->SetupAttachment(Root);
+			CollisionChunks.Add(Chunk);
+		}
+		Chunk->AddMesh(Type.Mesh, MeshTransform.GetRelativeTransform(GetActorTransform()));
+	}
+
+	// The chunks are registered after all shapes were added,
+	// so every chunk creates its body only once.
+	for (UCPP_PlatformChunkCollision* Chunk : CollisionChunks)
+	{
+		Chunk->RegisterComponent();
+	}
+
+	for (int32 i = 0; i < Types.Num(); i++)
+	{
+		const FPlatformInstanceType& Type = Types[i];
+		if (!IsValid(Type.Mesh) || TypesTransforms[i].Num() == 0)
+		{
+			Components.Add(nullptr);
+			continue;
+		}
+
+		UHierarchicalInstancedStaticMeshComponent* Component =
+			NewObject<UHierarchicalInstancedStaticMeshComponent>(this);
+		Component->SetMobility(EComponentMobility::Static);
+		Component->SetStaticMesh(Type.Mesh);
+		for (int32 j = 0; j < Type.Materials.Num(); j++)
+		{
+			Component->SetMaterial(j, Type.Materials[j]);
+		}
+		if (TypesMergedCollision[i])
+		{
+			Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			Component->SetCanEverAffectNavigation(false);
+		}
+		else
+		{
+			Component->SetCollisionProfileName(Type.CollisionProfileName);
+		}
+		Component->SetupAttachment(Root);
+		Component->RegisterComponent();
+		Component->AddInstances(TypesTransforms[i], false, true);
+		Components.Add(Component);
+	}
+
+	SET_DWORD_STAT(STAT_Cat_InstancedPlatforms, Instances.Num());
+	SET_DWORD_STAT(STAT_Cat_PlatformCollisionChunks, CollisionChunks.Num());
+}
+
+void ACPP_PlatformInstances::OnRep_Instances()
+{
+	BuildInstances();
+}
\ No newline at end of file
@@ -4,9 +4,16 @@
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
 UCPP_PlatformSpawner::UCPP_PlatformSpawner()
 {
 	GameInstanceRef = nullptr;
+	PlatformInstances = nullptr;
+	LevelState = nullptr;
 }
 
 void UCPP_PlatformSpawner::InitGameInstanceRef(UGameInstance* GI)
@@ -49,6 +56,8 @@ void UCPP_PlatformSpawner::SpawnPlatforms_Implementation(UWorld* WorldContext,
                                                          const float PlatformsZCoordinateOffset,
                                                          const float SpawnDistance)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SpawnPlatforms);
+
 	const int32 MaximumPlatformIndex = PlatformClasses.Num() - 1;
 
 	float StartCoordinateY;
@@ -61,6 +70,17 @@ void UCPP_PlatformSpawner::SpawnPlatforms_Implementation(UWorld* WorldContext,
 		StartCoordinateY = -(Width / 2) * SpawnDistance + (SpawnDistance / 2);
 	}
 
+	if (!IsValid(PlatformInstances))
+	{
+		PlatformInstances = WorldContext->SpawnActor<ACPP_PlatformInstances>(
+			ACPP_PlatformInstances::StaticClass(), FTransform::Identity);
+	}
+	if (!IsValid(LevelState))
+	{
+		LevelState = WorldContext->SpawnActor<ACPP_LevelState>(
+			ACPP_LevelState::StaticClass(), FTransform::Identity);
+	}
+
 	float CoordinateX = 0.0f;
 	for (int32 i = 0; i < Length; i++)
 	{
@@ -78,30 +98,48 @@ void UCPP_PlatformSpawner::SpawnPlatforms_Implementation(UWorld* WorldContext,
 				                                                   PlatformsZCoordinateOffset)),
 			                                  FVector(1.0f));
 
-			ACPP_Platform* Platform = WorldContext->SpawnActorDeferred<ACPP_Platform>(
-				GameInstanceRef->GetActorClassBySoftReference
-				(PlatformClasses[FMath::RandRange(0, MaximumPlatformIndex)]),
-				FTransform::Identity,
-				GameModeRef.IsValid() ? GameModeRef.Get() : nullptr,
-				nullptr,
-				ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+			UClass* PlatformClass = GameInstanceRef->GetActorClassBySoftReference(
+				PlatformClasses[FMath::RandRange(0, MaximumPlatformIndex)]);
 
-			Platform->InitializeBasicVariables(Transform.GetLocation());
+			// Platforms without behavior are only rendered (and
+			// collided) as instances.
+			if (const ACPP_Platform* DefaultPlatform = IsValid(PlatformClass)
+				                                           ? PlatformClass->GetDefaultObject<ACPP_Platform>()
+				                                           : nullptr;
+				IsValid(PlatformInstances) && IsValid(DefaultPlatform) && DefaultPlatform->CanBeInstanced() &&
+				PlatformInstances->AddPlatform(DefaultPlatform->GetPlatformBase(), Transform))
+			{
+				CoordinateY += SpawnDistance;
+				continue;
+			}
 
-			UGameplayStatics::FinishSpawningActor(Platform, Transform);
+			// The rest of the platforms are spawned by the level
+			// state on every machine.
+			if (IsValid(LevelState))
+			{
+				LevelState->AddPlatform(PlatformClass, i * Width + j, Transform);
+			}
 
 			CoordinateY += SpawnDistance;
 		}
 		CoordinateX += SpawnDistance;
 	}
 
+	if (IsValid(PlatformInstances))
+	{
+		PlatformInstances->BuildInstances();
+	}
+
 	FVector FinalPlatformLocation = FVector(CoordinateX, 0.0f, 0.0f);
 
-	FActorSpawnParameters Params;
-	WorldContext->SpawnActor<ACPP_Platform>(GameInstanceRef->GetActorClassBySoftReference(FinalPlatformClass),
-	                                        FinalPlatformLocation,
-	                                        FRotator(0.0f),
-	                                        Params);
+	// The final platform takes the cell after the grid.
+	if (IsValid(LevelState))
+	{
+		LevelState->AddPlatform(GameInstanceRef->GetActorClassBySoftReference(FinalPlatformClass),
+		                        Length * Width,
+		                        FTransform(FRotator(0.0f), FinalPlatformLocation));
+		LevelState->SpawnPlatforms();
+	}
 
 	ACPP_VictoryActor* VictoryActor = WorldContext->SpawnActorDeferred<ACPP_VictoryActor>(
 		GameInstanceRef->GetActorClassBySoftReference(VictoryActorClass),
@@ -147,6 +185,8 @@ void UCPP_PlatformSpawner::SpawnBuffs_Implementation(UWorld* WorldContext,
                                                      const int32 Width,
                                                      const float PlatformsSpawnDistance)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SpawnBuffs);
+
 	float OriginX;
 	if (Length % 2 == 1)
 	{
@@ -2,7 +2,6 @@
 
 #include "../Classes/CPP_PlatformWithNPC.h"
 #include "Kismet/GameplayStatics.h"
-#include "Components/BoxComponent.h"
 
 #ifndef CPP_ENEMYAICONTROLLER_H
 #define CPP_ENEMYAICONTROLLER_H
@@ -11,18 +10,19 @@
 class ACPP_EnemyAIController;
 class ACPP_Character;
 
-ACPP_PlatformWithNPC::ACPP_PlatformWithNPC()
+#ifndef CPP_CROWSIMULATION_H
+#define CPP_CROWSIMULATION_H
+#include "CatPlatformer/AI/Enemy/Classes/CPP_CrowSimulation.h"
+#endif
+
+ACPP_PlatformWithNPC::ACPP_PlatformWithNPC(): bSpawnCrowAsProxy(false),
+                                              EnemyRef(nullptr)
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	Target_For_NPC_Spawning = CreateDefaultSubobject<USceneComponent>(FName(TEXT("Target Point To Spawn NPC")));
 	Target_For_NPC_Spawning->SetupAttachment(RootComponent);
 
-	CollisionBox = CreateDefaultSubobject<UBoxComponent>(FName(TEXT("Collision Box")));
-	CollisionBox->SetupAttachment(RootComponent);
-	CollisionBox->InitBoxExtent(FVector(150.0f, 150.0f, 3.0f));
-	CollisionBox->SetRelativeLocation(FVector(0.0f, 0.0f, 12.0f));
-
 	PlatformBase = CreateDefaultSubobject<UStaticMeshComponent>(FName(TEXT("SM Platform Base")));
 	PlatformBase->SetRelativeLocation(FVector(0.0f, 0.0f, -12.0f));
 	PlatformBase->SetupAttachment(RootComponent);
@@ -32,11 +32,8 @@ void ACPP_PlatformWithNPC::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (HasAuthority())
+	if (IsOnServer())
 	{
-		CollisionBox->OnComponentBeginOverlap.AddDynamic(this, &ACPP_PlatformWithNPC::CollisionBoxOverlapBegin);
-		CollisionBox->OnComponentEndOverlap.AddDynamic(this, &ACPP_PlatformWithNPC::CollisionBoxOverlapEnd);
-
 		GetWorld()->GetTimerManager().SetTimer(
 			TH_SpawnCrow,
 			this,
@@ -48,11 +45,8 @@ void ACPP_PlatformWithNPC::BeginPlay()
 
 void ACPP_PlatformWithNPC::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (HasAuthority())
+	if (IsOnServer())
 	{
-		CollisionBox->OnComponentBeginOverlap.RemoveDynamic(this, &ACPP_PlatformWithNPC::CollisionBoxOverlapBegin);
-		CollisionBox->OnComponentEndOverlap.RemoveDynamic(this, &ACPP_PlatformWithNPC::CollisionBoxOverlapEnd);
-
 		if (GetWorld()->GetTimerManager().TimerExists(TH_SpawnCrow))
 		{
 			GetWorld()->GetTimerManager().ClearTimer(TH_SpawnCrow);
@@ -61,34 +55,29 @@ void ACPP_PlatformWithNPC::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
-void ACPP_PlatformWithNPC::CollisionBoxOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-                                                    UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
-                                                    bool bFromSweep, const FHitResult& SweepResult)
+void ACPP_PlatformWithNPC::CharacterEnteredPlatform(ACPP_Character* Character)
 {
-	if (ACPP_Character* CharacterRef = Cast<ACPP_Character>(OtherActor))
+	Super::CharacterEnteredPlatform(Character);
+
+	if (!IsOnServer() || !IsValid(EnemyRef))
+		return;
+
+	if (ACPP_EnemyAIController* Controller = Cast<ACPP_EnemyAIController>(EnemyRef->GetController()))
 	{
-		if (IsValid(EnemyRef))
-		{
-			if (ACPP_EnemyAIController* Controller = Cast<ACPP_EnemyAIController>(EnemyRef->GetController()))
-			{
-				Controller->PlayerSteppedOnThePlatform(CharacterRef);
-			}
-		}
+		Controller->PlayerSteppedOnThePlatform(Character);
 	}
 }
 
-void ACPP_PlatformWithNPC::CollisionBoxOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-                                                  UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void ACPP_PlatformWithNPC::CharacterLeftPlatform(ACPP_Character* Character)
 {
-	if (ACPP_Character* CharacterRef = Cast<ACPP_Character>(OtherActor))
+	Super::CharacterLeftPlatform(Character);
+
+	if (!IsOnServer() || !IsValid(EnemyRef))
+		return;
+
+	if (ACPP_EnemyAIController* Controller = Cast<ACPP_EnemyAIController>(EnemyRef->GetController()))
 	{
-		if (IsValid(EnemyRef))
-		{
-			if (ACPP_EnemyAIController* Controller = Cast<ACPP_EnemyAIController>(EnemyRef->GetController()))
-			{
-				Controller->PlayerLeftThePlatform(CharacterRef);
-			}
-		}
+		Controller->PlayerLeftThePlatform(Character);
 	}
 }
 
@@ -102,6 +91,17 @@ void ACPP_PlatformWithNPC::SpawnCrow()
 	{
 		const FTransform Transform = Target_For_NPC_Spawning->GetComponentTransform();
 
+		if (const TSubclassOf<ACPP_EnemyCharacter> CrowClass(NPC_Class.Get());
+			bSpawnCrowAsProxy && CrowClass.Get() != nullptr)
+		{
+			if (UCPP_CrowSimulation* CrowSimulation = GetWorld()->GetSubsystem<UCPP_CrowSimulation>();
+				IsValid(CrowSimulation))
+			{
+				CrowSimulation->SpawnProxyCrow(this, CrowClass, Transform);
+				return;
+			}
+		}
+
 		EnemyRef = GetWorld()->SpawnActorDeferred<ACPP_EnemyCharacter>(
 			NPC_Class,
 			FTransform::Identity,
@@ -114,3 +114,18 @@ void ACPP_PlatformWithNPC::SpawnCrow()
 		UGameplayStatics::FinishSpawningActor(EnemyRef, Transform);
 	}
 }
+
+void ACPP_PlatformWithNPC::SetEnemy(ACPP_EnemyCharacter* NewEnemy)
+{
+	EnemyRef = NewEnemy;
+	if (!IsValid(EnemyRef))
+		return;
+
+	if (ACPP_EnemyAIController* Controller = Cast<ACPP_EnemyAIController>(EnemyRef->GetController()))
+	{
+		for (ACPP_Character* Character : CharactersOnPlatform)
+		{
+			Controller->PlayerSteppedOnThePlatform(Character);
+		}
+	}
+}
@@ -2,9 +2,13 @@
 
 #include "../Classes/CPP_RotatingPlatform.h"
 
-#include "Net/UnrealNetwork.h"
+#ifndef CPP_TICKBUDGETMANAGER_H
+#define CPP_TICKBUDGETMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_TickBudgetManager.h"
+#endif
 
 ACPP_RotatingPlatform::ACPP_RotatingPlatform() : bBasicVariablesWereInitialized(false),
+                                                 BudgetedUpdateId(0),
                                                  bAxis(false),
                                                  bUseAxisY(false),
                                                  Speed(25.0f),
@@ -13,34 +17,61 @@ ACPP_RotatingPlatform::ACPP_RotatingPlatform() : bBasicVariablesWereInitialized(
 	PlatformBase = CreateDefaultSubobject<UStaticMeshComponent>(FName(TEXT("SM Platform Base")));
 	PlatformBase->SetupAttachment(RootComponent);
 
-	PrimaryActorTick.bCanEverTick = true;
-	bAllowReceiveTickEventOnDedicatedServer = true;
+	PrimaryActorTick.bCanEverTick = false;
+	bIsAnimated = true;
 }
 
-void ACPP_RotatingPlatform::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void ACPP_RotatingPlatform::BeginPlay()
 {
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	Super::BeginPlay();
 
-	DOREPLIFETIME(ACPP_RotatingPlatform, bUseAxisY);
+	// The rotation is applied locally on every machine, so
+	// the platform catches up with the server's time first.
+	if (const ACPP_LevelState* LevelState = GetLevelState();
+		IsValid(LevelState) && bBasicVariablesWereInitialized)
+	{
+		RotatePlatform(LevelState->GetSecondsSinceLayoutStart());
+	}
+
+	if (UCPP_TickBudgetManager* TickBudgetManager = GetWorld()->GetSubsystem<UCPP_TickBudgetManager>();
+		IsValid(TickBudgetManager))
+	{
+		BudgetedUpdateId = TickBudgetManager->RegisterUpdate(
+			this, FBudgetedUpdate::CreateUObject(this, &ACPP_RotatingPlatform::UpdatePlatformRotation),
+			ETickBudgetPriority::Normal);
+	}
+}
+
+void ACPP_RotatingPlatform::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCPP_TickBudgetManager* TickBudgetManager = GetWorld()->GetSubsystem<UCPP_TickBudgetManager>();
+		IsValid(TickBudgetManager))
+	{
+		TickBudgetManager->UnregisterUpdate(BudgetedUpdateId);
+		BudgetedUpdateId = 0;
+	}
+	Super::EndPlay(EndPlayReason);
 }
 
-void ACPP_RotatingPlatform::Tick(float DeltaSeconds)
+void ACPP_RotatingPlatform::UpdatePlatformRotation(const float DeltaSeconds)
 {
-	Super::Tick(DeltaSeconds);
 	if (bBasicVariablesWereInitialized)
 	{
 		RotatePlatform(DeltaSeconds);
 	}
 }
 
-void ACPP_RotatingPlatform::InitializeBasicVariables_Implementation(const FVector StartLocation)
+void ACPP_RotatingPlatform::InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+                                                     FRandomStream& RandomStream)
 {
-	if (bBasicVariablesWereInitialized || !HasAuthority())
+	Super::InitializeBasicVariables(NewCellIndex, StartLocation, RandomStream);
+
+	if (bBasicVariablesWereInitialized)
 		return;
 
-	Direction = FMath::RandBool() ? 1 : -1;
+	Direction = RandomStream.RandRange(0, 1) == 1 ? 1 : -1;
 
-	switch (FMath::RandRange(1, 3))
+	switch (RandomStream.RandRange(1, 3))
 	{
 	case 1:
 		{
@@ -71,12 +102,12 @@ void ACPP_RotatingPlatform::InitializeBasicVariables_Implementation(const FVecto
 	if (bAxis)
 	{
 		// Z-axis rotation.
-		Speed = FMath::FRandRange(14.0f, 16.0f);
+		Speed = RandomStream.FRandRange(14.0f, 16.0f);
 	}
 	else
 	{
 		// X-axis or Y-axis rotation.
-		Speed = FMath::FRandRange(24.0f, 26.0f);
+		Speed = RandomStream.FRandRange(24.0f, 26.0f);
 	}
 
 	bBasicVariablesWereInitialized = true;
@@ -97,7 +128,7 @@ void ACPP_RotatingPlatform::InitialPlatformRotation() const
 	PlatformBase->AddLocalRotation(FRotator(0.0f, 90.0f, 0.0f));
 }
 
-void ACPP_RotatingPlatform::RotatePlatform_Implementation(const float DeltaSeconds)
+void ACPP_RotatingPlatform::RotatePlatform(const float DeltaSeconds)
 {
 	if (bAxis)
 	{
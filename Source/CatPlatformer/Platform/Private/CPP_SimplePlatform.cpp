@@ -6,4 +6,6 @@ ACPP_SimplePlatform::ACPP_SimplePlatform()
 {
 	PlatformBase = CreateDefaultSubobject<UStaticMeshComponent>(FName(TEXT("SM Platform Base")));
 	PlatformBase->SetupAttachment(RootComponent);
+
+	bRenderAsInstance = true;
 }
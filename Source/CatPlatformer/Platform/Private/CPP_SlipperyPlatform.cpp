@@ -1,8 +1,8 @@
 ﻿// (c) M. A. Shalaeva, 2024
 
 #include "../Classes/CPP_SlipperyPlatform.h"
-#include "Components/BoxComponent.h"
-#include "Net/UnrealNetwork.h"
+#include "Sound/SoundBase.h"
+#include "UObject/ConstructorHelpers.h"
 
 #ifndef CPP_CHARACTER_H
 #define CPP_CHARACTER_H
@@ -10,146 +10,131 @@
 #endif
 class ACPP_Character;
 
-ACPP_SlipperyPlatform::ACPP_SlipperyPlatform()
+#ifndef CPP_SFXPOOL_H
+#define CPP_SFXPOOL_H
+#include "CatPlatformer/Sound/Classes/CPP_SFXPool.h"
+#endif
+
+ACPP_SlipperyPlatform::ACPP_SlipperyPlatform() : IceSound(nullptr),
+                                                 IceSoundId(0)
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	PlatformBase = CreateDefaultSubobject<UStaticMeshComponent>(FName(TEXT("SM Platform Base")));
 	PlatformBase->SetupAttachment(RootComponent);
 
-	CollisionBox = CreateDefaultSubobject<UBoxComponent>(FName(TEXT("Collision")));
-	CollisionBox->SetupAttachment(PlatformBase);
-
-	IceAudioComponent = CreateDefaultSubobject<UAudioComponent>(FName(TEXT("Ice Sound")));
-	IceAudioComponent->SetupAttachment(PlatformBase);
-
 	TimelineComp = CreateDefaultSubobject<UTimelineComponent>(FName(TEXT("Timeline Component")));
+	bIsAnimated = true;
 
 	StartRotation = FRotator(0.0f);
 	EndRotation = FRotator(0.0f);
 
 	CircularRotationOffset = 8.0f;
+
+	// The cue that BP_SlipperyPlatform had on the removed
+	// ice audio component.
+	static ConstructorHelpers::FObjectFinder<USoundBase> IceSoundCue
+		(TEXT("/Game/CatPlatformer/Sounds/SFX/Ice_Sound_Cue"));
+	if (IceSoundCue.Succeeded())
+	{
+		IceSound = IceSoundCue.Object;
+	}
 }
 
 void ACPP_SlipperyPlatform::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (HasAuthority())
+	// The rotation is played locally on every machine.
+	if (CurveVector)
 	{
-		CollisionBox->OnComponentBeginOverlap.AddDynamic(this, &ACPP_SlipperyPlatform::CollisionBoxOverlapBegin);
-		CollisionBox->OnComponentEndOverlap.AddDynamic(this, &ACPP_SlipperyPlatform::CollisionBoxOverlapEnd);
-
-		TimelineComp->SetIsReplicated(true);
-		if (CurveVector)
-		{
-			StartRotation = GetActorRotation();
-			EndRotation = FRotator(StartRotation.Pitch + CircularRotationOffset,
-			                       StartRotation.Yaw,
-			                       StartRotation.Roll + CircularRotationOffset);
+		StartRotation = GetActorRotation();
+		EndRotation = FRotator(StartRotation.Pitch + CircularRotationOffset,
+		                       StartRotation.Yaw,
+		                       StartRotation.Roll + CircularRotationOffset);
 
-			TimelineProgressDelegate.BindUFunction(this, FName(TEXT("CircularRotationTimelineProgress")));
+		TimelineProgressDelegate.BindUFunction(this, FName(TEXT("CircularRotationTimelineProgress")));
 
-			TimelineComp->AddInterpVector(CurveVector, TimelineProgressDelegate);
-			TimelineComp->SetLooping(true);
-			TimelineComp->SetIgnoreTimeDilation(true);
-		}
+		TimelineComp->AddInterpVector(CurveVector, TimelineProgressDelegate);
+		TimelineComp->SetLooping(true);
+		TimelineComp->SetIgnoreTimeDilation(true);
 	}
 }
 
 void ACPP_SlipperyPlatform::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (HasAuthority())
+	if (CurveVector)
 	{
-		CollisionBox->OnComponentBeginOverlap.RemoveDynamic(this, &ACPP_SlipperyPlatform::CollisionBoxOverlapBegin);
-		CollisionBox->OnComponentEndOverlap.RemoveDynamic(this, &ACPP_SlipperyPlatform::CollisionBoxOverlapEnd);
-
-		if (CurveVector)
-		{
-			TimelineProgressDelegate.Unbind();
-		}
+		TimelineProgressDelegate.Unbind();
 	}
+	SwitchSoundState(false);
 	Super::EndPlay(EndPlayReason);
 }
 
-void ACPP_SlipperyPlatform::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void ACPP_SlipperyPlatform::InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+                                                     FRandomStream& RandomStream)
 {
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	Super::InitializeBasicVariables(NewCellIndex, StartLocation, RandomStream);
 
-	DOREPLIFETIME(ACPP_SlipperyPlatform, bPlatformAppearanceType);
+	bPlatformAppearanceType = RandomStream.RandRange(0, 1) == 1;
 }
 
-void ACPP_SlipperyPlatform::InitializeBasicVariables_Implementation(const FVector StartLocation)
+void ACPP_SlipperyPlatform::CharacterEnteredPlatform(ACPP_Character* Character)
 {
-	if (!HasAuthority())
-		return;
-
-	bPlatformAppearanceType = FMath::RandBool();
-}
+	Super::CharacterEnteredPlatform(Character);
 
-void ACPP_SlipperyPlatform::CollisionBoxOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-                                                     UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
-                                                     bool bFromSweep, const FHitResult& SweepResult)
-{
-	if (!HasAuthority())
+	if (!IsValid(Character))
 		return;
 
-	if (ACPP_Character* Character = Cast<ACPP_Character>(OtherActor))
+	SwitchSoundState(true);
+	if (!TimelineComp->IsPlaying())
 	{
-		Character->ChangeCharactersSliding(true);
-
-		SwitchSoundState(true);
+		TimelineComp->PlayFromStart();
+	}
 
-		if (!TimelineComp->IsPlaying())
-		{
-			TimelineComp->PlayFromStart();
-		}
+	if (IsOnServer())
+	{
+		Character->ChangeCharactersSliding(true);
 	}
 }
 
-void ACPP_SlipperyPlatform::CollisionBoxOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-                                                   UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void ACPP_SlipperyPlatform::CharacterLeftPlatform(ACPP_Character* Character)
 {
-	if (!HasAuthority())
-		return;
+	Super::CharacterLeftPlatform(Character);
 
-	if (ACPP_Character* Character = Cast<ACPP_Character>(OtherActor))
+	if (IsValid(Character) && IsOnServer())
 	{
 		Character->ChangeCharactersSliding(false);
+	}
 
-		TArray<AActor*> OverlappedActors;
-		CollisionBox->GetOverlappingActors(OverlappedActors, ACPP_Character::StaticClass());
-
-		if (OverlappedActors.Num() == 0)
+	if (CharactersOnPlatform.Num() == 0)
+	{
+		SwitchSoundState(false);
+		if (TimelineComp->IsPlaying())
 		{
-			SwitchSoundState(false);
-			if (TimelineComp->IsPlaying())
-			{
-				TimelineComp->Stop();
-			}
+			TimelineComp->Stop();
 		}
 	}
 }
 
-void ACPP_SlipperyPlatform::SwitchSoundState_Implementation(const bool bTurnOn)
+void ACPP_SlipperyPlatform::SwitchSoundState(const bool bTurnOn)
 {
-	if (IsValid(IceAudioComponent) && IsValid(IceAudioComponent->GetSound()))
+	UCPP_SFXPool* SFXPool = GetWorld()->GetSubsystem<UCPP_SFXPool>();
+	if (!IsValid(SFXPool))
+		return;
+
+	if (bTurnOn)
 	{
-		if (bTurnOn)
+		if (!SFXPool->IsSoundPlaying(IceSoundId))
 		{
-			if (!IceAudioComponent->IsPlaying())
-			{
-				IceAudioComponent->Play(0.0f);
-			}
-		}
-		else
-		{
-			if (IceAudioComponent->IsPlaying())
-			{
-				IceAudioComponent->Stop();
-			}
+			IceSoundId = SFXPool->PlaySound(IceSound, ESFXCategory::IceSlide, GetActorLocation(), PlatformBase);
 		}
 	}
+	else
+	{
+		SFXPool->StopSound(IceSoundId);
+		IceSoundId = 0;
+	}
 }
 
 void ACPP_SlipperyPlatform::CircularRotationTimelineProgress(FVector Value)
@@ -1,72 +1,82 @@
 ﻿// (c) M. A. Shalaeva, 2024
 
 #include "../Classes/CPP_VerticalMovingPlatform.h"
-#include "Net/UnrealNetwork.h"
 
 ACPP_VerticalMovingPlatform::ACPP_VerticalMovingPlatform() : SmoothZMovementCurveFloat(nullptr),
                                                              StartPosition(FVector(0.0f)),
                                                              EndPosition(FVector(0.0f)),
                                                              bIsMovingUp(true),
+                                                             StartTime(0.0f),
                                                              ZPositionOffset(45.0f)
 {
 	PlatformBase = CreateDefaultSubobject<UStaticMeshComponent>(FName(TEXT("SM Platform Base")));
 	PlatformBase->SetupAttachment(RootComponent);
 
 	TimelineComp = CreateDefaultSubobject<UTimelineComponent>(FName(TEXT("TimelineComponent")));
+	bIsAnimated = true;
 }
 
 void ACPP_VerticalMovingPlatform::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (HasAuthority())
+	if (!SmoothZMovementCurveFloat)
+		return;
+
+	// The movement is played locally on every machine, so
+	// the timeline catches up with the server's time first.
+	// The up and down movement is one cycle of the doubled
+	// timeline's length.
+	if (const ACPP_LevelState* LevelState = GetLevelState(); IsValid(LevelState))
+	{
+		const float Length = FMath::Max(TimelineComp->GetTimelineLength(), KINDA_SMALL_NUMBER);
+		const float StartCycleTime = bIsMovingUp ? StartTime : 2.0f * Length - StartTime;
+		const float CycleTime = FMath::Fmod(StartCycleTime + LevelState->GetSecondsSinceLayoutStart(),
+		                                    2.0f * Length);
+		bIsMovingUp = CycleTime < Length;
+		TimelineComp->SetNewTime(bIsMovingUp ? CycleTime : 2.0f * Length - CycleTime);
+	}
+
+	if (bIsMovingUp)
 	{
-		TimelineComp->SetIsReplicated(true);
-		if (bIsMovingUp)
-		{
-			TimelineComp->Play();
-		}
-		else
-		{
-			TimelineComp->Reverse();
-		}
+		TimelineComp->Play();
+	}
+	else
+	{
+		TimelineComp->Reverse();
 	}
 }
 
 void ACPP_VerticalMovingPlatform::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (HasAuthority())
-	{
-		SmoothZMovementProgressDelegate.Unbind();
-		SmoothZMovementTimelineEndedDelegate.Unbind();
-	}
+	SmoothZMovementProgressDelegate.Unbind();
+	SmoothZMovementTimelineEndedDelegate.Unbind();
 	Super::EndPlay(EndPlayReason);
 }
 
-void ACPP_VerticalMovingPlatform::InitializeBasicVariables_Implementation(const FVector StartLocation)
+void ACPP_VerticalMovingPlatform::InitializeBasicVariables(const int32 NewCellIndex, const FVector StartLocation,
+                                                           FRandomStream& RandomStream)
 {
-	Super::InitializeBasicVariables_Implementation(StartLocation);
+	Super::InitializeBasicVariables(NewCellIndex, StartLocation, RandomStream);
 
-	if (HasAuthority())
+	if (SmoothZMovementCurveFloat)
 	{
-		if (SmoothZMovementCurveFloat)
-		{
-			StartPosition = FVector(StartLocation.X, StartLocation.Y, StartLocation.Z - ZPositionOffset);
-			EndPosition = FVector(StartPosition.X, StartPosition.Y, StartPosition.Z + ZPositionOffset);
+		StartPosition = FVector(StartLocation.X, StartLocation.Y, StartLocation.Z - ZPositionOffset);
+		EndPosition = FVector(StartPosition.X, StartPosition.Y, StartPosition.Z + ZPositionOffset);
 
-			SmoothZMovementProgressDelegate.BindUFunction(this, FName(TEXT("SmoothZMovementTimelineProgress")));
+		SmoothZMovementProgressDelegate.BindUFunction(this, FName(TEXT("SmoothZMovementTimelineProgress")));
 
-			TimelineComp->AddInterpFloat(SmoothZMovementCurveFloat, SmoothZMovementProgressDelegate);
-			TimelineComp->SetLooping(false);
-			TimelineComp->SetIgnoreTimeDilation(true);
+		TimelineComp->AddInterpFloat(SmoothZMovementCurveFloat, SmoothZMovementProgressDelegate);
+		TimelineComp->SetLooping(false);
+		TimelineComp->SetIgnoreTimeDilation(true);
 
-			SmoothZMovementTimelineEndedDelegate.BindUFunction(this, FName(TEXT("SmoothZMovementTimelineEnded")));
-			TimelineComp->SetTimelineFinishedFunc(SmoothZMovementTimelineEndedDelegate);
+		SmoothZMovementTimelineEndedDelegate.BindUFunction(this, FName(TEXT("SmoothZMovementTimelineEnded")));
+		TimelineComp->SetTimelineFinishedFunc(SmoothZMovementTimelineEndedDelegate);
 
-			TimelineComp->SetNewTime(FMath::RandRange(0.0f, TimelineComp->GetTimelineLength() - 0.01f));
+		StartTime = RandomStream.FRandRange(0.0f, TimelineComp->GetTimelineLength() - 0.01f);
+		TimelineComp->SetNewTime(StartTime);
 
-			bIsMovingUp = FMath::RandBool();
-		}
+		bIsMovingUp = RandomStream.RandRange(0, 1) == 1;
 	}
 }
 
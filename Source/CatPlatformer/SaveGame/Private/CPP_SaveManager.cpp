@@ -3,6 +3,11 @@
 #include "../Classes/CPP_SaveManager.h"
 #include "Kismet/GameplayStatics.h"
 
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
 UCPP_SaveManager::UCPP_SaveManager()
 {
 	SaveGameRef = nullptr;
@@ -47,6 +52,8 @@ bool UCPP_SaveManager::GetUserNameAndDateCreationFromSaveSlot(const uint8 SaveSl
                                                               FString& OutUserName,
                                                               FDateTime& OutDateCreation)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SaveIO);
+
 	const FString FileName = FString::Printf(TEXT("SaveFile_Slot%d"), SaveSlotNumber);
 	bool bSuccess = UGameplayStatics::DoesSaveGameExist(FileName, 0);
 	if (bSuccess)
@@ -81,6 +88,8 @@ bool UCPP_SaveManager::DoesSaveSlotExist() const
 
 UCPP_SaveGame* UCPP_SaveManager::LoadOrCreateSaveGameObject()
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SaveIO);
+
 	if (UGameplayStatics::DoesSaveGameExist(SaveFileName, 0))
 	{
 		USaveGame* Save = UGameplayStatics::LoadGameFromSlot(SaveFileName, 0);
@@ -139,6 +148,8 @@ bool UCPP_SaveManager::SetNewAudioDataToSaveGameObject(const float SFX_Volume, c
 
 bool UCPP_SaveManager::SaveGameInfoToFile() const
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SaveIO);
+
 	if (bSaveGameObjectIsDeclared)
 	{
 		SaveGameRef->UpdateCreationData();
@@ -153,6 +164,8 @@ bool UCPP_SaveManager::SaveGameInfoToFile() const
 
 bool UCPP_SaveManager::DeleteSave()
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SaveIO);
+
 	if (UGameplayStatics::DoesSaveGameExist(SaveFileName, 0))
 	{
 		const bool bSuccess = UGameplayStatics::DeleteGameInSlot(SaveFileName, 0);
@@ -169,6 +182,8 @@ bool UCPP_SaveManager::DeleteSave()
 
 bool UCPP_SaveManager::DeleteSaveBySlotNumber(const uint8 SaveSlotNumber)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_SaveIO);
+
 	if (const FString FileName = FString::Printf(TEXT("SaveFile_Slot%d"), SaveSlotNumber);
 		UGameplayStatics::DoesSaveGameExist(FileName, 0))
 	{
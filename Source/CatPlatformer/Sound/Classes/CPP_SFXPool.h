@@ -0,0 +1,172 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+class UAudioComponent;
+class USoundBase;
+class USceneComponent;
+class APlayerController;
+
+#include "CPP_SFXPool.generated.h"
+
+/** Enumeration for the sound effects' categories. */
+UENUM(Blueprintable)
+enum class ESFXCategory : uint8
+{
+	Footsteps,
+	IceSlide,
+	Attack,
+	Firework,
+	UI,
+	Max UMETA(Hidden)
+};
+
+/** Structure for storing information about the playing sound effect. */
+USTRUCT()
+struct FActiveSFX
+{
+	GENERATED_BODY()
+
+	/** Audio component that plays the sound. */
+	UPROPERTY()
+	UAudioComponent* Component = nullptr;
+
+	/** Identifier that was returned to the caller. */
+	int32 SoundId = 0;
+
+	/** Category of the sound. */
+	ESFXCategory Category = ESFXCategory::Footsteps;
+
+	/** Index of the local player whose budget is used. */
+	int32 ViewportIndex = 0;
+};
+
+/**
+ * Subsystem for playing sound effects with pooled audio
+ * components. Every category has its own budget of voices
+ * that can be played at the same time, and the budget is
+ * counted separately for every local player (viewport).
+ * A sound uses the budget of its owning player or of the
+ * player whose listener is the closest one. When the
+ * budget is used up, the new sound replaces the farthest
+ * one from the listener (or isn't played if it is the
+ * farthest itself). Nothing is played on the dedicated
+ * server.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_SFXPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Function for initializing the subsystem.
+	 * @param Collection Collection of subsystems.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Function for cleaning up the subsystem. */
+	virtual void Deinitialize() override;
+
+protected:
+	/**
+	 * Function for limiting the subsystem to the game
+	 * worlds only.
+	 * @param WorldType Type of the world.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	/**
+	 * Function for playing the sound effect.
+	 * @param Sound Sound to play.
+	 * @param Category Category whose budget should be used.
+	 * @param Location World location of the sound (is
+	 * ignored if AttachTo is set or for the UI category).
+	 * @param AttachTo Component that the sound should follow.
+	 * @param OwningPlayer Local player whose budget should
+	 * be used (the closest one is used if nullptr).
+	 * @param PitchMultiplier Pitch multiplier of the sound.
+	 * @return Identifier of the sound or 0 if the sound
+	 * wasn't played.
+	 */
+	int32 PlaySound(USoundBase* Sound, const ESFXCategory Category, const FVector& Location,
+	                USceneComponent* AttachTo = nullptr, const APlayerController* OwningPlayer = nullptr,
+	                const float PitchMultiplier = 1.0f);
+
+	/**
+	 * Function for stopping the sound and for returning its
+	 * component to the pool.
+	 * @param SoundId Identifier returned by PlaySound.
+	 */
+	void StopSound(const int32 SoundId);
+
+	/**
+	 * Function for checking if the sound is still playing
+	 * (it could finish or be replaced by another one).
+	 * @param SoundId Identifier returned by PlaySound.
+	 */
+	bool IsSoundPlaying(const int32 SoundId) const;
+
+	/**
+	 * Setter for the category's budget.
+	 * @param Category Category to change.
+	 * @param NewBudget Number of voices that can be played
+	 * at the same time for every local player.
+	 */
+	void SetCategoryBudget(const ESFXCategory Category, const int32 NewBudget);
+
+	/** Getter for the category's budget. */
+	int32 GetCategoryBudget(const ESFXCategory Category) const;
+
+private:
+	/** Components that are ready to be used. */
+	UPROPERTY()
+	TArray<UAudioComponent*> FreeComponents;
+
+	/** Sounds that are playing now (from the oldest one). */
+	UPROPERTY()
+	TArray<FActiveSFX> ActiveSounds;
+
+	/** Budget of every category for one local player. */
+	TStaticArray<int32, static_cast<int32>(ESFXCategory::Max)> CategoryBudgets;
+
+	/**
+	 * Maximum number of free components that are kept in
+	 * the pool.
+	 */
+	int32 MaxFreeComponents;
+
+	/** Identifier of the last played sound. */
+	int32 LastSoundId;
+
+	/**
+	 * Function for finding the local player whose budget
+	 * should be used.
+	 * @param SoundLocation Location of the sound.
+	 * @param OwningPlayer Local player that owns the sound.
+	 * @param OutListenerLocation Location of the player's
+	 * listener.
+	 * @return Index of the local player or INDEX_NONE.
+	 */
+	int32 GetViewportIndex(const FVector& SoundLocation, const APlayerController* OwningPlayer,
+	                       FVector& OutListenerLocation) const;
+
+	/** Function for getting a free (or new) component. */
+	UAudioComponent* GetFreeComponent();
+
+	/**
+	 * Function for returning the component to the pool.
+	 * @param Component Stopped component.
+	 */
+	void ReleaseComponent(UAudioComponent* Component);
+
+	/**
+	 * Function that is called when any pooled component
+	 * finishes playing.
+	 * @param Component Component that finished playing.
+	 */
+	void AudioFinished(UAudioComponent* Component);
+};
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Engine/StreamableManager.h"
 
 #ifndef CPP_STATICLIBRARY_H
 #define CPP_STATICLIBRARY_H
@@ -25,6 +26,7 @@ class ACPP_PlayerState;
 
 class USceneComponent;
 class UAudioComponent;
+class USoundBase;
 
 #include "CPP_SoundManager.generated.h"
 
@@ -82,6 +84,21 @@ protected:
 	UPROPERTY(VisibleAnywhere, Category = "Components | Root", meta = (AllowPrivateAccess = true))
 	USceneComponent* Root;
 
+	/**
+	 * Audio Component for playing the current music track
+	 * (the same one for all tracks).
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "Components | Audio", meta = (AllowPrivateAccess = true))
+	UAudioComponent* MusicAudioComponent;
+
+	/**
+	 * Soft references to all available music tracks (the
+	 * track's ordinal number is its index + 1). Only the
+	 * current track and the next one are kept loaded.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Music")
+	TArray<TSoftObjectPtr<USoundBase>> Tracks;
+
 	/**
 	 * Current repeating mode (looping playlist; looping one
 	 * track; no looping at all).
@@ -89,28 +106,29 @@ protected:
 	EPlaylistRepeatingMode PlaylistRepeatingMode;
 
 	/**
-	 * An array for storing chosen by the user tracks that
-	 * can be played.
+	 * An array of the tracks' numbers added to the playlist
+	 * by the user (sorted in ascending order).
 	 */
-	UPROPERTY()
-	TArray<UAudioComponent*> ActivePlaylistTracks;
+	TArray<uint8> ActiveTracksNumbers;
 
 	/**
-	 * An array for storing all available audio components
-	 * of the actor.
+	 * Lookup table with the index in the ActiveTracksNumbers
+	 * array for every track (track's number - 1 is used as
+	 * index; -1 if the track isn't in the playlist).
 	 */
-	UPROPERTY()
-	TArray<UAudioComponent*> AllAudioComponents;
+	TArray<int8> PlaylistIndexesOfTracks;
 
 	/**
-	 * An array of the tracks' numbers added to the playlist
-	 * by the user.
+	 * Lookup table with the index in the ActiveTracksNumbers
+	 * array of the track that should be played after the
+	 * track with the same index ends (-1 if nothing should
+	 * be played). Depends on the current repeating mode.
 	 */
-	TArray<uint8> ActiveTracksNumbers;
+	TArray<int8> IndexesAfterTrackEnding;
 
 	/**
 	 * The current playing (or last played) audio track
-	 * index in the ActivePlaylistTracks array.
+	 * index in the ActiveTracksNumbers array.
 	 */
 	int8 CurrentTrackIndex;
 
@@ -153,12 +171,56 @@ protected:
 	 */
 	FTimerHandle TH_TurnOnShouldReactOnTrackEnding;
 
+	/** Streamable handle of the current track. */
+	TSharedPtr<FStreamableHandle> CurrentTrackHandle;
+
+	/** Number of the track loaded by CurrentTrackHandle. */
+	uint8 LoadedTrackNumber;
+
+	/** Streamable handle of the next track in the playlist. */
+	TSharedPtr<FStreamableHandle> NextTrackHandle;
+
+	/** Number of the track loaded by NextTrackHandle. */
+	uint8 PreloadedTrackNumber;
+
 	/**
-	 * Function for adding all audio components to the
-	 * array.
+	 * A flag indicating whether the current track should
+	 * start playing as soon as it is loaded.
 	 */
-	UFUNCTION()
-	virtual void FillAllAudioComponentsArray();
+	bool bShouldPlayWhenLoaded;
+
+	/**
+	 * Function for rebuilding PlaylistIndexesOfTracks and
+	 * IndexesAfterTrackEnding arrays. Should be called
+	 * after changing the playlist or the repeating mode.
+	 */
+	void RebuildPlaylistLookupTables();
+
+	/**
+	 * Function for starting playing the current track right
+	 * after it will be loaded (or immediately if it is
+	 * loaded already).
+	 */
+	void PlayCurrentTrackWhenLoaded();
+
+	/**
+	 * Function that is called when the track was loaded.
+	 * @param TrackNumber Number of the loaded track.
+	 */
+	void TrackWasLoaded(const uint8 TrackNumber);
+
+	/**
+	 * Function for loading the next track in the playlist
+	 * order and for releasing the previously preloaded one.
+	 */
+	void PreloadNextTrack();
+
+	/**
+	 * Function for releasing (or canceling loading of) the
+	 * track.
+	 * @param Handle Streamable handle of the track.
+	 */
+	static void ReleaseTrackHandle(TSharedPtr<FStreamableHandle>& Handle);
 
 public:
 	/** Function to apply saved data or to apply basic values. */
@@ -172,10 +234,8 @@ public:
 	void SetNewMusicVolume(const float Volume) const;
 
 	/**
-	 * Function for updating current track number by matching
-	 * audio components from the Active Playlist Tracks array
-	 * and audio components from All Audio Components array
-	 * (= audio components declared inside a class).
+	 * Function for updating current track number by the
+	 * current index in the ActiveTracksNumbers array.
 	 */
 	UFUNCTION()
 	void UpdateCurrentTrackNumber();
@@ -197,7 +257,7 @@ public:
 	/**
 	 * Function for switching current track to the next one
 	 * and for starting to play it. For choosing track the
-	 * ActivePlaylistTracks array is used.
+	 * ActiveTracksNumbers array is used.
 	 */
 	UFUNCTION()
 	void StartPlayingNextTrackFromActivePlaylist();
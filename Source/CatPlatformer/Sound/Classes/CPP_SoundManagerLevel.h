@@ -24,61 +24,6 @@ class CATPLATFORMER_API ACPP_SoundManagerLevel : public ACPP_SoundManager
 	/** The constructor to set default variables. */
 	ACPP_SoundManagerLevel();
 
-	/**
-	 * Function for storing logic that should be applied
-	 * when the actor appears in the game world.
-	 */
-	virtual void BeginPlay() override;
-
-	/**
-	 * Function for storing logic that should be applied in
-	 * the end of the actor's life (but before its destroying).
-	 * @param EndPlayReason Specifies why an actor is being
-	 * deleted/removed from a level.
-	 */
-	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-
-	/**
-	 * Audio Component for working with the 1st audio track
-	 * related to the level.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Components | Audio", meta = (AllowPrivateAccess = true))
-	UAudioComponent* L_TrackAudioComponent_1;
-
-	/**
-	 * Audio Component for working with the 2nd audio track
-	 * related to the level.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Components | Audio", meta = (AllowPrivateAccess = true))
-	UAudioComponent* L_TrackAudioComponent_2;
-
-	/**
-	 * Audio Component for working with the 3rd audio track
-	 * related to the level.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Components | Audio", meta = (AllowPrivateAccess = true))
-	UAudioComponent* L_TrackAudioComponent_3;
-
-	/**
-	 * Audio Component for working with the 4th audio track
-	 * related to the level.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Components | Audio", meta = (AllowPrivateAccess = true))
-	UAudioComponent* L_TrackAudioComponent_4;
-
-	/**
-	 * Audio Component for working with the 5th audio track
-	 * related to the level.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Components | Audio", meta = (AllowPrivateAccess = true))
-	UAudioComponent* L_TrackAudioComponent_5;
-
-	/**
-	 * Function for adding all audio components to the
-	 * array.
-	 */
-	virtual void FillAllAudioComponentsArray() override;
-
 public:
 	/** Function to apply saved data or to apply basic values. */
 	virtual void ApplySettingsFromTheSaveFile(const bool bSetDefaultValues,
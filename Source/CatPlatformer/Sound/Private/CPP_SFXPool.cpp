@@ -0,0 +1,295 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_SFXPool.h"
+#include "Components/AudioComponent.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "Sound/SoundBase.h"
+
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+#ifndef CPP_SIGNIFICANCEMANAGER_H
+#define CPP_SIGNIFICANCEMANAGER_H
+#include "CatPlatformer/Performance/Classes/CPP_SignificanceManager.h"
+#endif
+
+void UCPP_SFXPool::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CategoryBudgets[static_cast<int32>(ESFXCategory::Footsteps)] = 3;
+	CategoryBudgets[static_cast<int32>(ESFXCategory::IceSlide)] = 2;
+	CategoryBudgets[static_cast<int32>(ESFXCategory::Attack)] = 3;
+	CategoryBudgets[static_cast<int32>(ESFXCategory::Firework)] = 2;
+	CategoryBudgets[static_cast<int32>(ESFXCategory::UI)] = 2;
+
+	MaxFreeComponents = 24;
+	LastSoundId = 0;
+}
+
+void UCPP_SFXPool::Deinitialize()
+{
+	for (const FActiveSFX& ActiveSound : ActiveSounds)
+	{
+		if (IsValid(ActiveSound.Component))
+		{
+			ActiveSound.Component->OnAudioFinishedNative.RemoveAll(this);
+			ActiveSound.Component->Stop();
+		}
+	}
+	for (UAudioComponent* Component : FreeComponents)
+	{
+		if (IsValid(Component))
+		{
+			Component->OnAudioFinishedNative.RemoveAll(this);
+		}
+	}
+	ActiveSounds.Empty();
+	FreeComponents.Empty();
+	SET_DWORD_STAT(STAT_Cat_ActiveSFX, 0);
+
+	Super::Deinitialize();
+}
+
+bool UCPP_SFXPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+int32 UCPP_SFXPool::PlaySound(USoundBase* Sound, const ESFXCategory Category, const FVector& Location,
+                              USceneComponent* AttachTo, const APlayerController* OwningPlayer,
+                              const float PitchMultiplier)
+{
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_PlaySFX);
+
+	if (!IsValid(Sound) || Category == ESFXCategory::Max || GetWorld()->GetNetMode() == NM_DedicatedServer)
+		return 0;
+
+	// Sounds of the insignificant actors are too far away
+	// to be heard.
+	if (IsValid(AttachTo))
+	{
+		if (const UCPP_SignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UCPP_SignificanceManager>();
+			IsValid(SignificanceManager) &&
+			SignificanceManager->GetSignificanceLevel(AttachTo->GetOwner()) == ESignificanceLevel::Insignificant)
+		{
+			return 0;
+		}
+	}
+
+	const FVector SoundLocation = IsValid(AttachTo) ? AttachTo->GetComponentLocation() : Location;
+	FVector ListenerLocation;
+	const int32 ViewportIndex = GetViewportIndex(SoundLocation, OwningPlayer, ListenerLocation);
+	if (ViewportIndex == INDEX_NONE)
+		return 0;
+
+	// UI sounds aren't spatialized, so the oldest one is
+	// replaced first.
+	const bool bIs2D = Category == ESFXCategory::UI;
+	const float DistanceSquared = bIs2D ? 0.0f : FVector::DistSquared(SoundLocation, ListenerLocation);
+
+	int32 VoicesNumber = 0;
+	int32 FarthestIndex = INDEX_NONE;
+	float FarthestDistanceSquared = -1.0f;
+	for (int32 i = 0; i < ActiveSounds.Num(); i++)
+	{
+		const FActiveSFX& ActiveSound = ActiveSounds[i];
+		if (ActiveSound.Category != Category || ActiveSound.ViewportIndex != ViewportIndex)
+			continue;
+
+		VoicesNumber++;
+		const float ActiveDistanceSquared = bIs2D || !IsValid(ActiveSound.Component)
+			                                    ? 0.0f
+			                                    : FVector::DistSquared(ActiveSound.Component->GetComponentLocation(),
+			                                                           ListenerLocation);
+		if (ActiveDistanceSquared > FarthestDistanceSquared)
+		{
+			FarthestDistanceSquared = ActiveDistanceSquared;
+			FarthestIndex = i;
+		}
+	}
+
+	UAudioComponent* Component;
+	if (VoicesNumber < CategoryBudgets[static_cast<int32>(Category)])
+	{
+		Component = GetFreeComponent();
+	}
+	else
+	{
+		if (FarthestIndex == INDEX_NONE || DistanceSquared > FarthestDistanceSquared)
+			return 0;
+
+		// Voice stealing: the component is reused without
+		// returning to the pool.
+		Component = ActiveSounds[FarthestIndex].Component;
+		ActiveSounds.RemoveAt(FarthestIndex);
+		Component->Stop();
+	}
+	if (!IsValid(Component))
+		return 0;
+
+	if (bIs2D || !IsValid(AttachTo))
+	{
+		Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		Component->SetWorldLocation(SoundLocation);
+	}
+	else
+	{
+		Component->AttachToComponent(AttachTo, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	}
+	Component->bAllowSpatialization = !bIs2D;
+	Component->bIsUISound = bIs2D;
+	Component->SetSound(Sound);
+	Component->SetPitchMultiplier(PitchMultiplier);
+	Component->Play();
+
+	FActiveSFX& ActiveSound = ActiveSounds.AddDefaulted_GetRef();
+	ActiveSound.Component = Component;
+	ActiveSound.SoundId = ++LastSoundId;
+	ActiveSound.Category = Category;
+	ActiveSound.ViewportIndex = ViewportIndex;
+	SET_DWORD_STAT(STAT_Cat_ActiveSFX, ActiveSounds.Num());
+
+	return ActiveSound.SoundId;
+}
+
+void UCPP_SFXPool::StopSound(const int32 SoundId)
+{
+	if (SoundId == 0)
+		return;
+
+	const int32 Index = ActiveSounds.IndexOfByPredicate([SoundId](const FActiveSFX& ActiveSound)
+	{
+		return ActiveSound.SoundId == SoundId;
+	});
+	if (Index == INDEX_NONE)
+		return;
+
+	UAudioComponent* Component = ActiveSounds[Index].Component;
+	ActiveSounds.RemoveAt(Index);
+	SET_DWORD_STAT(STAT_Cat_ActiveSFX, ActiveSounds.Num());
+
+	if (IsValid(Component))
+	{
+		Component->Stop();
+		ReleaseComponent(Component);
+	}
+}
+
+bool UCPP_SFXPool::IsSoundPlaying(const int32 SoundId) const
+{
+	return SoundId != 0 && ActiveSounds.ContainsByPredicate([SoundId](const FActiveSFX& ActiveSound)
+	{
+		return ActiveSound.SoundId == SoundId;
+	});
+}
+
+void UCPP_SFXPool::SetCategoryBudget(const ESFXCategory Category, const int32 NewBudget)
+{
+	if (Category == ESFXCategory::Max)
+		return;
+
+	CategoryBudgets[static_cast<int32>(Category)] = FMath::Max(NewBudget, 0);
+}
+
+int32 UCPP_SFXPool::GetCategoryBudget(const ESFXCategory Category) const
+{
+	return Category == ESFXCategory::Max ? 0 : CategoryBudgets[static_cast<int32>(Category)];
+}
+
+int32 UCPP_SFXPool::GetViewportIndex(const FVector& SoundLocation, const APlayerController* OwningPlayer,
+                                     FVector& OutListenerLocation) const
+{
+	const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	if (!IsValid(GameInstance))
+		return INDEX_NONE;
+
+	int32 NearestIndex = INDEX_NONE;
+	float MinDistanceSquared = TNumericLimits<float>::Max();
+	const TArray<ULocalPlayer*>& LocalPlayers = GameInstance->GetLocalPlayers();
+	for (int32 i = 0; i < LocalPlayers.Num(); i++)
+	{
+		const APlayerController* PlayerController = IsValid(LocalPlayers[i])
+			                                            ? LocalPlayers[i]->GetPlayerController(GetWorld())
+			                                            : nullptr;
+		if (!IsValid(PlayerController))
+			continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		if (PlayerController == OwningPlayer)
+		{
+			OutListenerLocation = ViewLocation;
+			return i;
+		}
+		if (const float DistanceSquared = FVector::DistSquared(SoundLocation, ViewLocation);
+			DistanceSquared < MinDistanceSquared)
+		{
+			MinDistanceSquared = DistanceSquared;
+			NearestIndex = i;
+			OutListenerLocation = ViewLocation;
+		}
+	}
+	return NearestIndex;
+}
+
+UAudioComponent* UCPP_SFXPool::GetFreeComponent()
+{
+	while (FreeComponents.Num() > 0)
+	{
+		if (UAudioComponent* Component = FreeComponents.Pop(); IsValid(Component))
+			return Component;
+	}
+
+	AWorldSettings* WorldSettings = GetWorld()->GetWorldSettings();
+	if (!IsValid(WorldSettings))
+		return nullptr;
+
+	UAudioComponent* Component = NewObject<UAudioComponent>(WorldSettings);
+	Component->bAutoActivate = false;
+	Component->bAutoDestroy = false;
+	Component->RegisterComponentWithWorld(GetWorld());
+	Component->OnAudioFinishedNative.AddUObject(this, &UCPP_SFXPool::AudioFinished);
+	return Component;
+}
+
+void UCPP_SFXPool::ReleaseComponent(UAudioComponent* Component)
+{
+	Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	Component->SetSound(nullptr);
+
+	if (FreeComponents.Num() < MaxFreeComponents)
+	{
+		FreeComponents.Add(Component);
+	}
+	else
+	{
+		Component->OnAudioFinishedNative.RemoveAll(this);
+		Component->DestroyComponent();
+	}
+}
+
+void UCPP_SFXPool::AudioFinished(UAudioComponent* Component)
+{
+	// The component could be already reused by another
+	// sound (or stopped by StopSound).
+	if (!IsValid(Component) || Component->IsPlaying())
+		return;
+
+	const int32 Index = ActiveSounds.IndexOfByPredicate([Component](const FActiveSFX& ActiveSound)
+	{
+		return ActiveSound.Component == Component;
+	});
+	if (Index == INDEX_NONE)
+		return;
+
+	ActiveSounds.RemoveAt(Index);
+	SET_DWORD_STAT(STAT_Cat_ActiveSFX, ActiveSounds.Num());
+	ReleaseComponent(Component);
+}
\ No newline at end of file
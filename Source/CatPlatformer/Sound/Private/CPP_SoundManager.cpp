@@ -4,6 +4,8 @@
 #include "Components/AudioComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
+#include "Engine/AssetManager.h"
+#include "Sound/SoundBase.h"
 
 ACPP_SoundManager::ACPP_SoundManager() : PlayerControllerRef(nullptr),
                                          PlayerStateRef(nullptr),
@@ -15,19 +17,34 @@ ACPP_SoundManager::ACPP_SoundManager() : PlayerControllerRef(nullptr),
                                          CurrentTrackNumber(1),
                                          GeneralNumberOfTracks(-1),
                                          bTrackIsPaused(false),
-                                         bShouldReactOnTrackEnding(true)
+                                         bShouldReactOnTrackEnding(true),
+                                         LoadedTrackNumber(0),
+                                         PreloadedTrackNumber(0),
+                                         bShouldPlayWhenLoaded(false)
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
 	SetRootComponent(Root);
+
+	MusicAudioComponent = CreateDefaultSubobject<UAudioComponent>(TEXT("Music Audio Component"));
+	MusicAudioComponent->SetupAttachment(RootComponent);
+	MusicAudioComponent->bIsUISound = true;
+	MusicAudioComponent->bAutoActivate = false;
 }
 
 void ACPP_SoundManager::BeginPlay()
 {
 	Super::BeginPlay();
 
-	FillAllAudioComponentsArray();
+	if (Tracks.Num() != GeneralNumberOfTracks)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s has %d tracks instead of %d"),
+		       *GetName(), Tracks.Num(), GeneralNumberOfTracks);
+	}
+	RebuildPlaylistLookupTables();
+
+	MusicAudioComponent->OnAudioFinished.AddDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
 }
 
 void ACPP_SoundManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -37,17 +54,155 @@ void ACPP_SoundManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		GetWorld()->GetTimerManager().ClearTimer(TH_TurnOnShouldReactOnTrackEnding);
 	}
 
+	MusicAudioComponent->OnAudioFinished.RemoveDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
+
+	bShouldPlayWhenLoaded = false;
+	ReleaseTrackHandle(CurrentTrackHandle);
+	ReleaseTrackHandle(NextTrackHandle);
+	LoadedTrackNumber = 0;
+	PreloadedTrackNumber = 0;
+
 	Super::EndPlay(EndPlayReason);
 }
 
-void ACPP_SoundManager::FillAllAudioComponentsArray()
+void ACPP_SoundManager::RebuildPlaylistLookupTables()
 {
+	PlaylistIndexesOfTracks.Init(-1, GeneralNumberOfTracks);
+	for (int32 i = 0; i < ActiveTracksNumbers.Num(); i++)
+	{
+		if (PlaylistIndexesOfTracks.IsValidIndex(ActiveTracksNumbers[i] - 1))
+		{
+			PlaylistIndexesOfTracks[ActiveTracksNumbers[i] - 1] = i;
+		}
+	}
+
+	const int32 PlaylistLength = ActiveTracksNumbers.Num();
+	IndexesAfterTrackEnding.SetNumUninitialized(PlaylistLength);
+	for (int32 i = 0; i < PlaylistLength; i++)
+	{
+		switch (PlaylistRepeatingMode)
+		{
+		case EPlaylistRepeatingMode::RepeatPlaylist:
+			IndexesAfterTrackEnding[i] = i + 1 < PlaylistLength ? i + 1 : 0;
+			break;
+		case EPlaylistRepeatingMode::RepeatOneTrack:
+			IndexesAfterTrackEnding[i] = i;
+			break;
+		case EPlaylistRepeatingMode::NoRepeat:
+			IndexesAfterTrackEnding[i] = i + 1 < PlaylistLength ? i + 1 : -1;
+			break;
+		}
+	}
 }
 
-void ACPP_SoundManager::ApplySettingsFromTheSaveFile(const bool bSetDefaultValues, const bool bIsAdditionalSoundManager)
+void ACPP_SoundManager::PlayCurrentTrackWhenLoaded()
 {
-	FillAllAudioComponentsArray();
+	if (!Tracks.IsValidIndex(CurrentTrackNumber - 1))
+		return;
+
+	bShouldPlayWhenLoaded = true;
+
+	if (LoadedTrackNumber != CurrentTrackNumber || !CurrentTrackHandle.IsValid())
+	{
+		ReleaseTrackHandle(CurrentTrackHandle);
+		if (PreloadedTrackNumber == CurrentTrackNumber && NextTrackHandle.IsValid())
+		{
+			CurrentTrackHandle = MoveTemp(NextTrackHandle);
+			PreloadedTrackNumber = 0;
+		}
+		else
+		{
+			CurrentTrackHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+				Tracks[CurrentTrackNumber - 1].ToSoftObjectPath(),
+				FStreamableDelegate::CreateUObject(this, &ACPP_SoundManager::TrackWasLoaded, CurrentTrackNumber));
+		}
+		LoadedTrackNumber = CurrentTrackNumber;
+
+		if (!CurrentTrackHandle.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Track %d of %s can't be loaded"), CurrentTrackNumber, *GetName());
+			bShouldPlayWhenLoaded = false;
+			LoadedTrackNumber = 0;
+			return;
+		}
+	}
+
+	if (CurrentTrackHandle->HasLoadCompleted())
+	{
+		TrackWasLoaded(CurrentTrackNumber);
+	}
+}
+
+void ACPP_SoundManager::TrackWasLoaded(const uint8 TrackNumber)
+{
+	// Preloaded tracks are only waiting for their turn.
+	if (TrackNumber != CurrentTrackNumber || !bShouldPlayWhenLoaded)
+		return;
+
+	bShouldPlayWhenLoaded = false;
+
+	if (USoundBase* Sound = Tracks[TrackNumber - 1].Get())
+	{
+		if (MusicAudioComponent->Sound != Sound)
+		{
+			MusicAudioComponent->SetSound(Sound);
+		}
+		MusicAudioComponent->Play();
+	}
+
+	PreloadNextTrack();
+}
+
+void ACPP_SoundManager::PreloadNextTrack()
+{
+	// The next track is chosen relative to the loaded one.
+	if (LoadedTrackNumber == 0 || LoadedTrackNumber != CurrentTrackNumber)
+		return;
+
+	uint8 NextTrackNumber = 0;
+	if (IndexesAfterTrackEnding.IsValidIndex(CurrentTrackIndex))
+	{
+		if (const int8 NextIndex = IndexesAfterTrackEnding[CurrentTrackIndex]; NextIndex != -1)
+		{
+			NextTrackNumber = ActiveTracksNumbers[NextIndex];
+		}
+	}
+
+	if (NextTrackNumber == 0 || NextTrackNumber == CurrentTrackNumber)
+	{
+		ReleaseTrackHandle(NextTrackHandle);
+		PreloadedTrackNumber = 0;
+		return;
+	}
+	if (NextTrackNumber == PreloadedTrackNumber && NextTrackHandle.IsValid())
+		return;
+
+	ReleaseTrackHandle(NextTrackHandle);
+	PreloadedTrackNumber = NextTrackNumber;
+	NextTrackHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Tracks[NextTrackNumber - 1].ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &ACPP_SoundManager::TrackWasLoaded, NextTrackNumber),
+		FStreamableManager::AsyncLoadLowPriority);
+}
+
+void ACPP_SoundManager::ReleaseTrackHandle(TSharedPtr<FStreamableHandle>& Handle)
+{
+	if (!Handle.IsValid())
+		return;
+
+	if (Handle->IsLoadingInProgress())
+	{
+		Handle->CancelHandle();
+	}
+	else
+	{
+		Handle->ReleaseHandle();
+	}
+	Handle.Reset();
+}
 
+void ACPP_SoundManager::ApplySettingsFromTheSaveFile(const bool bSetDefaultValues, const bool bIsAdditionalSoundManager)
+{
 	if (bSetDefaultValues || !PlayerStateRef.IsValid())
 	{
 		PlaylistRepeatingMode = EPlaylistRepeatingMode::RepeatPlaylist;
@@ -56,7 +211,7 @@ void ACPP_SoundManager::ApplySettingsFromTheSaveFile(const bool bSetDefaultValue
 		{
 			ActiveTracksNumbers.Add(i);
 		}
-		ActivePlaylistTracks.Append(AllAudioComponents);
+		RebuildPlaylistLookupTables();
 
 		CurrentTrackNumber = 1;
 		CurrentTrackIndex = 0;
@@ -135,54 +290,39 @@ void ACPP_SoundManager::UpdateCurrentTrackNumber()
 		return;
 	}
 
-	for (int32 i = 0; i < GeneralNumberOfTracks; i++)
+	if (ActiveTracksNumbers.IsValidIndex(CurrentTrackIndex))
 	{
-		if (ActivePlaylistTracks[CurrentTrackIndex] == AllAudioComponents[i])
-		{
-			CurrentTrackNumber = i + 1;
-			break;
-		}
+		CurrentTrackNumber = ActiveTracksNumbers[CurrentTrackIndex];
 	}
 }
 
 void ACPP_SoundManager::AudioTrackWasEnded()
 {
-	if (!bShouldReactOnTrackEnding || ActivePlaylistTracks.Num() == 0)
+	if (!bShouldReactOnTrackEnding || ActiveTracksNumbers.Num() == 0)
 		return;
 
-	switch (PlaylistRepeatingMode)
+	if (PlaylistRepeatingMode == EPlaylistRepeatingMode::RepeatOneTrack)
 	{
-	case EPlaylistRepeatingMode::RepeatPlaylist:
-		if (ActivePlaylistTracks.Num() == 0)
-			return;
-		if (CurrentTrackIndex + 1 >= ActivePlaylistTracks.Num() ||
-			CurrentTrackIndex == -1)
-		{
-			CurrentTrackIndex = 0;
-		}
-		else
-		{
-			CurrentTrackIndex++;
-		}
-		UpdateCurrentTrackNumber();
-		ActivePlaylistTracks[CurrentTrackIndex]->Play();
-		TrackWasSwitchedDelegate.Broadcast();
-		break;
-	case EPlaylistRepeatingMode::RepeatOneTrack:
-		GetCurrentAudioComponent()->Play();
-		break;
-	case EPlaylistRepeatingMode::NoRepeat:
-		if (CurrentTrackIndex == -1)
-			return;
-		if (CurrentTrackIndex + 1 < ActivePlaylistTracks.Num())
-		{
-			CurrentTrackIndex++;
-			UpdateCurrentTrackNumber();
-			ActivePlaylistTracks[CurrentTrackIndex]->Play();
-			TrackWasSwitchedDelegate.Broadcast();
-		}
-		break;
+		PlayCurrentTrackWhenLoaded();
+		return;
 	}
+
+	int8 NextIndex;
+	if (IndexesAfterTrackEnding.IsValidIndex(CurrentTrackIndex))
+	{
+		NextIndex = IndexesAfterTrackEnding[CurrentTrackIndex];
+	}
+	else
+	{
+		NextIndex = PlaylistRepeatingMode == EPlaylistRepeatingMode::RepeatPlaylist ? 0 : -1;
+	}
+	if (NextIndex == -1)
+		return;
+
+	CurrentTrackIndex = NextIndex;
+	UpdateCurrentTrackNumber();
+	PlayCurrentTrackWhenLoaded();
+	TrackWasSwitchedDelegate.Broadcast();
 }
 
 void ACPP_SoundManager::StartPlayingNextTrack()
@@ -197,7 +337,7 @@ void ACPP_SoundManager::StartPlayingNextTrack()
 	{
 		CurrentTrackNumber++;
 	}
-	CurrentTrackIndex = ActivePlaylistTracks.Find(AllAudioComponents[CurrentTrackNumber - 1]);
+	CurrentTrackIndex = PlaylistIndexesOfTracks[CurrentTrackNumber - 1];
 
 	TrackWasSwitchedDelegate.Broadcast();
 
@@ -210,7 +350,7 @@ void ACPP_SoundManager::StartPlayingNextTrack()
 void ACPP_SoundManager::StartPlayingNextTrackFromActivePlaylist()
 {
 	StopPlayingCurrentTrack();
-	if (CurrentTrackIndex + 1 >= ActivePlaylistTracks.Num())
+	if (CurrentTrackIndex + 1 >= ActiveTracksNumbers.Num())
 	{
 		CurrentTrackIndex = 0;
 	}
@@ -240,7 +380,7 @@ void ACPP_SoundManager::StartPlayingPreviousTrack()
 	{
 		CurrentTrackNumber--;
 	}
-	CurrentTrackIndex = ActivePlaylistTracks.Find(AllAudioComponents[CurrentTrackNumber - 1]);
+	CurrentTrackIndex = PlaylistIndexesOfTracks[CurrentTrackNumber - 1];
 
 	if (PlayerStateRef.IsValid() && PlayerStateRef->Get_Music_Volume() <= 0.0f)
 		return;
@@ -271,19 +411,14 @@ void ACPP_SoundManager::StopPlayingCurrentTrack()
 	                                       1.5f,
 	                                       false);
 
-	if (CurrentTrackNumber < 1 || CurrentTrackNumber > GeneralNumberOfTracks)
+	bShouldPlayWhenLoaded = false;
+	if (MusicAudioComponent->bIsPaused)
 	{
-		for (int32 i = 0; GeneralNumberOfTracks; i++)
-		{
-			if (AllAudioComponents[i]->IsPlaying())
-			{
-				AllAudioComponents[i]->Stop();
-			}
-		}
+		MusicAudioComponent->SetPaused(false);
 	}
-	else if (AllAudioComponents[CurrentTrackNumber - 1]->IsPlaying())
+	if (MusicAudioComponent->IsPlaying())
 	{
-		AllAudioComponents[CurrentTrackNumber - 1]->Stop();
+		MusicAudioComponent->Stop();
 	}
 	SetTrackIsPaused(false);
 }
@@ -292,14 +427,14 @@ void ACPP_SoundManager::StartPlayingCurrentTrack()
 {
 	if (CurrentTrackNumber >= 1 && CurrentTrackNumber <= GeneralNumberOfTracks)
 	{
-		if (AllAudioComponents[CurrentTrackNumber - 1]->bIsPaused)
+		if (MusicAudioComponent->bIsPaused)
 		{
-			AllAudioComponents[CurrentTrackNumber - 1]->SetPaused(false);
+			MusicAudioComponent->SetPaused(false);
 			SetTrackIsPaused(false);
 		}
-		else if (!AllAudioComponents[CurrentTrackNumber - 1]->IsPlaying())
+		else if (!MusicAudioComponent->IsPlaying())
 		{
-			AllAudioComponents[CurrentTrackNumber - 1]->Play();
+			PlayCurrentTrackWhenLoaded();
 		}
 	}
 }
@@ -308,9 +443,14 @@ void ACPP_SoundManager::PauseCurrentTrack()
 {
 	if (CurrentTrackNumber >= 1 && CurrentTrackNumber <= GeneralNumberOfTracks)
 	{
-		if (AllAudioComponents[CurrentTrackNumber - 1]->IsPlaying())
+		if (MusicAudioComponent->IsPlaying())
 		{
-			AllAudioComponents[CurrentTrackNumber - 1]->SetPaused(true);
+			MusicAudioComponent->SetPaused(true);
+			SetTrackIsPaused(true);
+		}
+		else if (bShouldPlayWhenLoaded)
+		{
+			bShouldPlayWhenLoaded = false;
 			SetTrackIsPaused(true);
 		}
 	}
@@ -320,13 +460,13 @@ void ACPP_SoundManager::UnpauseCurrentTrack()
 {
 	if (CurrentTrackNumber >= 1 && CurrentTrackNumber <= GeneralNumberOfTracks)
 	{
-		if (AllAudioComponents[CurrentTrackNumber - 1]->bIsPaused)
+		if (MusicAudioComponent->bIsPaused)
 		{
-			AllAudioComponents[CurrentTrackNumber - 1]->SetPaused(false);
+			MusicAudioComponent->SetPaused(false);
 		}
 		else
 		{
-			AllAudioComponents[CurrentTrackNumber - 1]->Play();
+			PlayCurrentTrackWhenLoaded();
 		}
 		SetTrackIsPaused(false);
 	}
@@ -337,43 +477,31 @@ void ACPP_SoundManager::AddTrackToActivePlaylist(const uint8 TrackNumber)
 	if (TrackNumber < 1 || TrackNumber > GeneralNumberOfTracks)
 		return;
 
-	if (ActivePlaylistTracks.Find(AllAudioComponents[TrackNumber - 1]) != -1)
+	if (PlaylistIndexesOfTracks.IsValidIndex(TrackNumber - 1) && PlaylistIndexesOfTracks[TrackNumber - 1] != -1)
 		return;
 
-	int32 IndexToInsert = -1;
-	for (int32 i = TrackNumber; i < GeneralNumberOfTracks; i++)
+	int32 IndexToInsert = ActiveTracksNumbers.IndexOfByPredicate([TrackNumber](const uint8 Number)
 	{
-		IndexToInsert = ActivePlaylistTracks.Find(AllAudioComponents[i]);
-		if (IndexToInsert != -1)
-			break;
-	}
-	if (IndexToInsert != -1)
+		return Number > TrackNumber;
+	});
+	if (IndexToInsert != INDEX_NONE)
 	{
-		ActivePlaylistTracks.Insert(AllAudioComponents[TrackNumber - 1], IndexToInsert);
 		ActiveTracksNumbers.Insert(TrackNumber, IndexToInsert);
 	}
 	else
 	{
-		IndexToInsert = ActivePlaylistTracks.Num();
-		ActivePlaylistTracks.Emplace(AllAudioComponents[TrackNumber - 1]);
+		IndexToInsert = ActiveTracksNumbers.Num();
 		ActiveTracksNumbers.Add(TrackNumber);
 	}
+	RebuildPlaylistLookupTables();
 
-	if (ActivePlaylistTracks.Num() == 0)
-	{
-		CurrentTrackIndex = -1;
-		return;
-	}
 	if (TrackNumber == CurrentTrackNumber)
 	{
-		CurrentTrackIndex = ActiveTracksNumbers.Find(TrackNumber);
-		if (CurrentTrackIndex != -1)
-			return;
+		CurrentTrackIndex = IndexToInsert;
 	}
-
-	if (IndexToInsert != -1 && CurrentTrackIndex >= IndexToInsert)
+	else if (CurrentTrackIndex >= IndexToInsert)
 	{
-		if (CurrentTrackIndex + 1 >= ActivePlaylistTracks.Num())
+		if (CurrentTrackIndex + 1 >= ActiveTracksNumbers.Num())
 		{
 			CurrentTrackIndex = 0;
 		}
@@ -382,6 +510,7 @@ void ACPP_SoundManager::AddTrackToActivePlaylist(const uint8 TrackNumber)
 			CurrentTrackIndex++;
 		}
 	}
+	PreloadNextTrack();
 }
 
 void ACPP_SoundManager::RemoveTrackFromActivePlaylist(const uint8 TrackNumber)
@@ -389,28 +518,27 @@ void ACPP_SoundManager::RemoveTrackFromActivePlaylist(const uint8 TrackNumber)
 	if (TrackNumber < 1 || TrackNumber > GeneralNumberOfTracks)
 		return;
 
-	if (ActivePlaylistTracks.Contains(AllAudioComponents[TrackNumber - 1]))
-	{
-		const int32 IndexInAllAudioComponentsToRemove = TrackNumber - 1;
-		const int32 IndexToRemoveFromActivePlaylist = ActivePlaylistTracks.Find(
-			AllAudioComponents[IndexInAllAudioComponentsToRemove]);
-		ActivePlaylistTracks.Remove(AllAudioComponents[IndexInAllAudioComponentsToRemove]);
-		ActiveTracksNumbers.Remove(TrackNumber);
+	if (!PlaylistIndexesOfTracks.IsValidIndex(TrackNumber - 1) || PlaylistIndexesOfTracks[TrackNumber - 1] == -1)
+		return;
 
-		if (ActivePlaylistTracks.Num() == 0)
-		{
-			CurrentTrackIndex = -1;
-		}
-		else if (CurrentTrackIndex == IndexToRemoveFromActivePlaylist && IndexToRemoveFromActivePlaylist ==
-			ActiveTracksNumbers.Num())
-		{
-			CurrentTrackIndex = 0;
-		}
-		else if (CurrentTrackIndex > IndexToRemoveFromActivePlaylist)
-		{
-			CurrentTrackIndex--;
-		}
+	const int32 IndexToRemoveFromActivePlaylist = PlaylistIndexesOfTracks[TrackNumber - 1];
+	ActiveTracksNumbers.RemoveAt(IndexToRemoveFromActivePlaylist);
+	RebuildPlaylistLookupTables();
+
+	if (ActiveTracksNumbers.Num() == 0)
+	{
+		CurrentTrackIndex = -1;
 	}
+	else if (CurrentTrackIndex == IndexToRemoveFromActivePlaylist && IndexToRemoveFromActivePlaylist ==
+		ActiveTracksNumbers.Num())
+	{
+		CurrentTrackIndex = 0;
+	}
+	else if (CurrentTrackIndex > IndexToRemoveFromActivePlaylist)
+	{
+		CurrentTrackIndex--;
+	}
+	PreloadNextTrack();
 }
 
 void ACPP_SoundManager::StartPlayingUserPlaylist()
@@ -418,7 +546,7 @@ void ACPP_SoundManager::StartPlayingUserPlaylist()
 	if (PlayerStateRef.IsValid() && PlayerStateRef->Get_Music_Volume() <= 0.0f)
 		return;
 
-	if (ActivePlaylistTracks.Num() <= 0)
+	if (ActiveTracksNumbers.Num() <= 0)
 	{
 		StopPlayingCurrentTrack();
 		CurrentTrackIndex = -1;
@@ -430,7 +558,7 @@ void ACPP_SoundManager::StartPlayingUserPlaylist()
 	{
 		CurrentTrackIndex = 0;
 	}
-	if (GetCurrentAudioComponent() != ActivePlaylistTracks[CurrentTrackIndex])
+	if (CurrentTrackNumber != ActiveTracksNumbers[CurrentTrackIndex])
 	{
 		StopPlayingCurrentTrack();
 		UpdateCurrentTrackNumber();
@@ -441,33 +569,17 @@ void ACPP_SoundManager::StartPlayingUserPlaylist()
 
 bool ACPP_SoundManager::IsAnyTrackPlaying()
 {
-	bool bIsPlaying;
-
-	if (CurrentTrackNumber >= 1 && CurrentTrackNumber <= GeneralNumberOfTracks)
-	{
-		bIsPlaying = AllAudioComponents[CurrentTrackNumber - 1]->IsPlaying() &&
-			!AllAudioComponents[CurrentTrackNumber - 1]->bIsPaused;
-	}
-	else
-	{
-		bIsPlaying = false;
-		for (int32 i = 0; i < GeneralNumberOfTracks; i++)
-		{
-			if (AllAudioComponents[i]->IsPlaying() &&
-				!AllAudioComponents[i]->bIsPaused)
-			{
-				bIsPlaying = true;
-				break;
-			}
-		}
-	}
-
-	return bIsPlaying;
+	// The track that is being loaded for playing is counted
+	// as the playing one.
+	return bShouldPlayWhenLoaded ||
+		MusicAudioComponent->IsPlaying() && !MusicAudioComponent->bIsPaused;
 }
 
 void ACPP_SoundManager::SetPlaylistRepeatingMode(const EPlaylistRepeatingMode NewValue)
 {
 	PlaylistRepeatingMode = NewValue;
+	RebuildPlaylistLookupTables();
+	PreloadNextTrack();
 }
 
 EPlaylistRepeatingMode ACPP_SoundManager::GetPlaylistRepeatingMode() const
@@ -478,6 +590,8 @@ EPlaylistRepeatingMode ACPP_SoundManager::GetPlaylistRepeatingMode() const
 void ACPP_SoundManager::SetPlaylistRepeatingModeAsInt(const int32 NewValue)
 {
 	PlaylistRepeatingMode = static_cast<EPlaylistRepeatingMode>(NewValue);
+	RebuildPlaylistLookupTables();
+	PreloadNextTrack();
 }
 
 int32 ACPP_SoundManager::GetPlaylistRepeatingModeAsInt() const
@@ -489,7 +603,7 @@ UAudioComponent* ACPP_SoundManager::GetCurrentAudioComponent() const
 {
 	if (CurrentTrackNumber >= 1 && CurrentTrackNumber <= GeneralNumberOfTracks)
 	{
-		return AllAudioComponents[CurrentTrackNumber - 1];
+		return MusicAudioComponent;
 	}
 	return nullptr;
 }
@@ -1,72 +1,25 @@
 ﻿// (c) M. A. Shalaeva, 2024
 
 #include "../Classes/CPP_SoundManagerLevel.h"
-#include "Components/AudioComponent.h"
 
 ACPP_SoundManagerLevel::ACPP_SoundManagerLevel()
 {
-	L_TrackAudioComponent_1 = CreateDefaultSubobject<UAudioComponent>(TEXT("Level Audio Component 1"));
-	L_TrackAudioComponent_1->SetupAttachment(RootComponent);
-	L_TrackAudioComponent_1->bIsUISound = true;
-
-	L_TrackAudioComponent_2 = CreateDefaultSubobject<UAudioComponent>(TEXT("Level Audio Component 2"));
-	L_TrackAudioComponent_2->SetupAttachment(RootComponent);
-	L_TrackAudioComponent_2->bIsUISound = true;
-
-	L_TrackAudioComponent_3 = CreateDefaultSubobject<UAudioComponent>(TEXT("Level Audio Component 3"));
-	L_TrackAudioComponent_3->SetupAttachment(RootComponent);
-	L_TrackAudioComponent_3->bIsUISound = true;
-
-	L_TrackAudioComponent_4 = CreateDefaultSubobject<UAudioComponent>(TEXT("Level Audio Component 4"));
-	L_TrackAudioComponent_4->SetupAttachment(RootComponent);
-	L_TrackAudioComponent_4->bIsUISound = true;
-
-	L_TrackAudioComponent_5 = CreateDefaultSubobject<UAudioComponent>(TEXT("Level Audio Component 5"));
-	L_TrackAudioComponent_5->SetupAttachment(RootComponent);
-	L_TrackAudioComponent_5->bIsUISound = true;
-
 	GeneralNumberOfTracks = 5;
-}
-
-void ACPP_SoundManagerLevel::BeginPlay()
-{
-	Super::BeginPlay();
-
-	L_TrackAudioComponent_1->OnAudioFinished.AddDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	L_TrackAudioComponent_2->OnAudioFinished.AddDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	L_TrackAudioComponent_3->OnAudioFinished.AddDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	L_TrackAudioComponent_4->OnAudioFinished.AddDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	L_TrackAudioComponent_5->OnAudioFinished.AddDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-}
 
-void ACPP_SoundManagerLevel::EndPlay(const EEndPlayReason::Type EndPlayReason)
-{
-	L_TrackAudioComponent_1->OnAudioFinished.RemoveDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	L_TrackAudioComponent_2->OnAudioFinished.RemoveDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	L_TrackAudioComponent_3->OnAudioFinished.RemoveDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	L_TrackAudioComponent_4->OnAudioFinished.RemoveDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	L_TrackAudioComponent_5->OnAudioFinished.RemoveDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-
-	Super::EndPlay(EndPlayReason);
-}
-
-void ACPP_SoundManagerLevel::FillAllAudioComponentsArray()
-{
-	if (AllAudioComponents.Num() == 5)
-		return;
-	if (AllAudioComponents.Num() != 0)
-	{
-		AllAudioComponents.Reset(5);
-	}
-	else
-	{
-		AllAudioComponents.Reserve(5);
-	}
-	AllAudioComponents.Emplace(L_TrackAudioComponent_1);
-	AllAudioComponents.Emplace(L_TrackAudioComponent_2);
-	AllAudioComponents.Emplace(L_TrackAudioComponent_3);
-	AllAudioComponents.Emplace(L_TrackAudioComponent_4);
-	AllAudioComponents.Emplace(L_TrackAudioComponent_5);
+	// The order must match the track numbers of the settings
+	// widget («Creative Minds» is the 1st track).
+	Tracks = {
+		TSoftObjectPtr<USoundBase>(FSoftObjectPath(
+			TEXT("/Game/CatPlatformer/Sounds/Music/CreativeMinds_Cue.CreativeMinds_Cue"))),
+		TSoftObjectPtr<USoundBase>(FSoftObjectPath(
+			TEXT("/Game/CatPlatformer/Sounds/Music/Elevate_Cue.Elevate_Cue"))),
+		TSoftObjectPtr<USoundBase>(FSoftObjectPath(
+			TEXT("/Game/CatPlatformer/Sounds/Music/GroovyHipHop_Cue.GroovyHipHop_Cue"))),
+		TSoftObjectPtr<USoundBase>(FSoftObjectPath(
+			TEXT("/Game/CatPlatformer/Sounds/Music/Punky_Cue.Punky_Cue"))),
+		TSoftObjectPtr<USoundBase>(FSoftObjectPath(
+			TEXT("/Game/CatPlatformer/Sounds/Music/Rumble_Cue.Rumble_Cue")))
+	};
 }
 
 void ACPP_SoundManagerLevel::ApplySettingsFromTheSaveFile(const bool bSetDefaultValues,
@@ -76,7 +29,7 @@ void ACPP_SoundManagerLevel::ApplySettingsFromTheSaveFile(const bool bSetDefault
 
 	if (!bSetDefaultValues && PlayerStateRef.IsValid())
 	{
-		PlaylistRepeatingMode = PlayerStateRef->Get_L_PlaylistRepeatingMode();
+		SetPlaylistRepeatingMode(PlayerStateRef->Get_L_PlaylistRepeatingMode());
 
 		for (const auto& Number : PlayerStateRef->Get_L_ActiveTracksNumbers())
 		{
@@ -91,7 +44,7 @@ void ACPP_SoundManagerLevel::ApplySettingsFromTheSaveFile(const bool bSetDefault
 		}
 		else
 		{
-			CurrentTrackIndex = ActivePlaylistTracks.Find(AllAudioComponents[CurrentTrackNumber - 1]);
+			CurrentTrackIndex = PlaylistIndexesOfTracks[CurrentTrackNumber - 1];
 		}
 
 		if (CurrentTrackIndex < 0 || CurrentTrackIndex > 4 ||
@@ -1,58 +1,21 @@
 ﻿// (c) M. A. Shalaeva, 2024
 
 #include "../Classes/CPP_SoundManagerMainMenu.h"
-#include "Components/AudioComponent.h"
 
 ACPP_SoundManagerMainMenu::ACPP_SoundManagerMainMenu()
 {
-	MM_TrackAudioComponent_1 = CreateDefaultSubobject<UAudioComponent>(TEXT("Main Menu Audio Component 1"));
-	MM_TrackAudioComponent_1->SetupAttachment(RootComponent);
-	MM_TrackAudioComponent_1->bIsUISound = true;
-
-	MM_TrackAudioComponent_2 = CreateDefaultSubobject<UAudioComponent>(TEXT("Main Menu Audio Component 2"));
-	MM_TrackAudioComponent_2->SetupAttachment(RootComponent);
-	MM_TrackAudioComponent_2->bIsUISound = true;
-
-	MM_TrackAudioComponent_3 = CreateDefaultSubobject<UAudioComponent>(TEXT("Main Menu Audio Component 3"));
-	MM_TrackAudioComponent_3->SetupAttachment(RootComponent);
-	MM_TrackAudioComponent_3->bIsUISound = true;
-
 	GeneralNumberOfTracks = 3;
-}
 
-void ACPP_SoundManagerMainMenu::BeginPlay()
-{
-	Super::BeginPlay();
-
-	MM_TrackAudioComponent_1->OnAudioFinished.AddDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	MM_TrackAudioComponent_2->OnAudioFinished.AddDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	MM_TrackAudioComponent_3->OnAudioFinished.AddDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-}
-
-void ACPP_SoundManagerMainMenu::EndPlay(const EEndPlayReason::Type EndPlayReason)
-{
-	MM_TrackAudioComponent_1->OnAudioFinished.RemoveDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	MM_TrackAudioComponent_2->OnAudioFinished.RemoveDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-	MM_TrackAudioComponent_3->OnAudioFinished.RemoveDynamic(this, &ACPP_SoundManager::AudioTrackWasEnded);
-
-	Super::EndPlay(EndPlayReason);
-}
-
-void ACPP_SoundManagerMainMenu::FillAllAudioComponentsArray()
-{
-	if (AllAudioComponents.Num() == 3)
-		return;
-	if (AllAudioComponents.Num() != 0)
-	{
-		AllAudioComponents.Reset(3);
-	}
-	else
-	{
-		AllAudioComponents.Reserve(3);
-	}
-	AllAudioComponents.Emplace(MM_TrackAudioComponent_1);
-	AllAudioComponents.Emplace(MM_TrackAudioComponent_2);
-	AllAudioComponents.Emplace(MM_TrackAudioComponent_3);
+	// The order must match the track numbers of the settings
+	// widget («Echo Of Sadness» is the 1st track).
+	Tracks = {
+		TSoftObjectPtr<USoundBase>(FSoftObjectPath(
+			TEXT("/Game/CatPlatformer/Sounds/Music/EchoOfSadness_Cue.EchoOfSadness_Cue"))),
+		TSoftObjectPtr<USoundBase>(FSoftObjectPath(
+			TEXT("/Game/CatPlatformer/Sounds/Music/Memories_Cue.Memories_Cue"))),
+		TSoftObjectPtr<USoundBase>(FSoftObjectPath(
+			TEXT("/Game/CatPlatformer/Sounds/Music/Tenderness_Cue.Tenderness_Cue")))
+	};
 }
 
 void ACPP_SoundManagerMainMenu::ApplySettingsFromTheSaveFile(const bool bSetDefaultValues,
@@ -62,7 +25,7 @@ void ACPP_SoundManagerMainMenu::ApplySettingsFromTheSaveFile(const bool bSetDefa
 
 	if (!bSetDefaultValues && PlayerStateRef.IsValid())
 	{
-		PlaylistRepeatingMode = PlayerStateRef->Get_MM_PlaylistRepeatingMode();
+		SetPlaylistRepeatingMode(PlayerStateRef->Get_MM_PlaylistRepeatingMode());
 
 		for (const auto& Number : PlayerStateRef->Get_MM_ActiveTracksNumbers())
 		{
@@ -77,7 +40,7 @@ void ACPP_SoundManagerMainMenu::ApplySettingsFromTheSaveFile(const bool bSetDefa
 		}
 		else
 		{
-			CurrentTrackIndex = ActivePlaylistTracks.Find(AllAudioComponents[CurrentTrackNumber - 1]);
+			CurrentTrackIndex = PlaylistIndexesOfTracks[CurrentTrackNumber - 1];
 		}
 
 		if (CurrentTrackIndex < 0 || CurrentTrackIndex > 2 ||
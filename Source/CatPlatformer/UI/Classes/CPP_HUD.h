@@ -68,6 +68,8 @@ class UWCPP_Level;
 #endif
 class UWCPP_EndLevel;
 
+class UWCPP_Notification;
+
 #ifndef CPP_STATICLIBRARY_H
 #define CPP_STATICLIBRARY_H
 #include "CatPlatformer/StaticLibraries/Classes/CPP_StaticLibrary.h"
@@ -75,6 +77,19 @@ class UWCPP_EndLevel;
 
 #include "CPP_HUD.generated.h"
 
+/**
+ * Structure for storing the notification that is waiting
+ * for the free place on the screen.
+ */
+struct FQueuedNotification
+{
+	/** Text of the notification. */
+	FText Text;
+
+	/** Number of seconds to show the notification. */
+	float TimeToDisplay;
+};
+
 /**
  * Heads-up Display for working with widgets.
  */
@@ -200,6 +215,174 @@ public:
 	 */
 	TWeakObjectPtr<UWCPP_EndLevel> EndLevel_Widget;
 
+	//=====================Widgets cache===========================
+
+private:
+	/**
+	 * Constructed screens that aren't shown at the moment
+	 * (rows of the WidgetBlueprintsDataTable as keys). They
+	 * are removed from the screen, but not destroyed, so
+	 * opening them again doesn't require creating the whole
+	 * widget tree.
+	 */
+	UPROPERTY()
+	TMap<FName, UUserWidget*> CachedWidgets;
+
+	/** Rows whose widgets are shown at the moment. */
+	TSet<FName> RowsInUse;
+
+	/** Rows whose widgets should be constructed in advance. */
+	TArray<FName> WarmUpQueue;
+
+	/**
+	 * Handles of the asynchronous loading of the widgets'
+	 * classes from the WarmUpQueue.
+	 */
+	TMap<FName, TSharedPtr<FStreamableHandle>> WarmUpHandles;
+
+	/** Timer handle for calling the WarmUpNextWidget function. */
+	FTimerHandle TH_WarmUpNextWidget;
+
+	/** Is the HUD being removed from the world? */
+	bool bIsEndingPlay;
+
+protected:
+	/**
+	 * Number of seconds without screen changes after which
+	 * the widgets from the warm-up queue start being
+	 * constructed.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Widgets Cache")
+	float WidgetsWarmUpDelay;
+
+	/**
+	 * Number of seconds between constructing of two warmed
+	 * up widgets (one widget is constructed at a time).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Widgets Cache")
+	float WidgetsWarmUpInterval;
+
+public:
+	/**
+	 * Function for getting the widget of the given row:
+	 * the cached one is returned if it exists, otherwise
+	 * the new one is created. The widget is not added to
+	 * the screen.
+	 * @param Row Row of the WidgetBlueprintsDataTable.
+	 * @return The widget or nullptr if it can't be created.
+	 */
+	UUserWidget* AcquireWidget(const FName& Row);
+
+	/**
+	 * Function for removing the widget from the screen and
+	 * keeping it in the cache for the next use.
+	 * @param Row Row of the WidgetBlueprintsDataTable the
+	 * widget was acquired with.
+	 * @param Widget The widget to release.
+	 */
+	void ReleaseWidget(const FName& Row, UUserWidget* Widget);
+
+	/**
+	 * Function for loading classes of the widgets that are
+	 * likely to be opened next asynchronously and for
+	 * constructing them while the player stays on the
+	 * current screen.
+	 * @param Rows Rows of the WidgetBlueprintsDataTable.
+	 */
+	void WarmUpWidgets(const TArray<FName>& Rows);
+
+private:
+	/**
+	 * Function for constructing one widget from the
+	 * WarmUpQueue whose class is already loaded.
+	 */
+	void WarmUpNextWidget();
+
+	/**
+	 * Function for postponing the warm-up while screens are
+	 * being changed.
+	 */
+	void PostponeWidgetsWarmUp();
+
+	/**
+	 * Function for cancelling the warm-up and for clearing
+	 * the cache.
+	 */
+	void ClearWidgetsCache();
+
+	//=====================Notifications===========================
+
+protected:
+	/** Maximum number of notifications on the screen. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Notifications")
+	int32 MaxShownNotifications;
+
+	/**
+	 * Maximum number of notifications that wait for the
+	 * free place on the screen (the oldest are dropped).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Notifications")
+	int32 MaxQueuedNotifications;
+
+	/**
+	 * Number of seconds during which the notification with
+	 * the same text isn't shown again (the shown one is
+	 * prolonged instead).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Notifications")
+	float NotificationsCoalescingWindow;
+
+private:
+	/** Notifications' widgets that can be reused. */
+	UPROPERTY()
+	TArray<UWCPP_Notification*> FreeNotifications;
+
+	/** Notifications' widgets shown at the moment. */
+	UPROPERTY()
+	TArray<UWCPP_Notification*> ShownNotifications;
+
+	/** Notifications waiting for the free place. */
+	TArray<FQueuedNotification> NotificationsQueue;
+
+	/**
+	 * Real time (in seconds) when the notification with the
+	 * text (as key) was sent last time.
+	 */
+	TMap<FString, double> LastNotificationsTimes;
+
+	/**
+	 * Timer handle for calling the ShowQueuedNotifications
+	 * function.
+	 */
+	FTimerHandle TH_ShowQueuedNotifications;
+
+	/**
+	 * Function for showing the notification using a widget
+	 * from the pool (the new one is created only if the
+	 * pool is empty).
+	 * @param NewText Text of the notification.
+	 * @param TimeToDisplay How many seconds should this
+	 * notification be shown on the screen.
+	 */
+	void ShowNotification(const FText& NewText, const float TimeToDisplay);
+
+	/**
+	 * Function for showing the queued notifications while
+	 * there is a free place on the screen.
+	 */
+	void ShowQueuedNotifications();
+
+	/**
+	 * Function for returning the closed notification's
+	 * widget to the pool.
+	 * @param Notification The closed notification.
+	 */
+	void NotificationWasClosed(UWCPP_Notification* Notification);
+
+	/** Function for clearing the queue and the pool. */
+	void ClearNotifications();
+
+public:
 	/**
 	 * Inscription for notifying that all gamepads were
 	 * disconnected.
@@ -236,14 +419,16 @@ public:
 	                                   FInputDeviceId InputDeviceId);
 
 	/**
-	 * Function for creating and adding to the player's
-	 * screen new notification.
+	 * Function for adding to the player's screen new
+	 * notification. The same notification sent several
+	 * times in a short period is shown once; if the screen
+	 * is full, the notification waits in the queue.
 	 * @param NewText Text of the new notification.
 	 * @param TimeToDisplay How many seconds should this
 	 * notification be shown on the screen.
 	 */
 	UFUNCTION()
-	void CreateNewNotification(const FText& NewText, const float TimeToDisplay) const;
+	void CreateNewNotification(const FText& NewText, const float TimeToDisplay);
 
 	/**
 	 * Function fot creating or destroying the pause widget
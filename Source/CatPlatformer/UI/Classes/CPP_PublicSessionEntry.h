@@ -0,0 +1,48 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "CPP_PublicSessionEntry.generated.h"
+
+/**
+ * Lightweight data object representing one found public
+ * session in the sessions' list view. Doesn't copy the
+ * search result, but stores its index in the search that
+ * is kept by the owning widget.
+ */
+UCLASS()
+class CATPLATFORMER_API UCPP_PublicSessionEntry : public UObject
+{
+	GENERATED_BODY()
+
+	/** The constructor to set default variables. */
+	UCPP_PublicSessionEntry();
+
+public:
+	/** Serial number of the session in the search results. */
+	int32 SessionNumber;
+
+	/** Index of the session in the search results array. */
+	int32 SearchResultIndex;
+
+	/**
+	 * Unique ID of the session. Is needed for keeping the
+	 * same entry between several searches.
+	 */
+	FString SessionId;
+
+	/** The name of the session. */
+	FName SessionName;
+
+	/** Ping to the session's host (in milliseconds). */
+	int32 PingInMs;
+
+	/** Number of free places for players. */
+	int32 OpenConnectionsNumber;
+
+	/** Maximum number of players in the session. */
+	int32 MaxConnectionsNumber;
+};
\ No newline at end of file
@@ -10,6 +10,8 @@
 #endif
 class UWCPP_WidgetParent;
 class UCheckBox;
+class UImage;
+class ACPP_UI_ThreeDimensionalActor;
 
 #ifndef CPP_PLAYERSTATE_H
 #define CPP_PLAYERSTATE_H
@@ -46,6 +48,15 @@ class CATPLATFORMER_API UWCPP_CharacterAppearance : public UWCPP_WidgetParent
 	 */
 	virtual void NativeDestruct() override;
 
+	/**
+	 * Function that is called every frame while the widget
+	 * is shown. Resizes the preview's render target when
+	 * the size of the Preview_Image is changed.
+	 * @param MyGeometry Geometry of the widget.
+	 * @param InDeltaTime Frame time.
+	 */
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
 	/**
 	 * Weak pointer to the instance of ACPP_PlayerState
 	 * class associated with current widget.
@@ -90,6 +101,49 @@ protected:
 	UPROPERTY(BlueprintReadOnly)
 	uint8 CatColorIndex;
 
+	/**
+	 * Class of the actor that shows the character. The class
+	 * isn't loaded by the widget: only the actor that is
+	 * placed on the level is found.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Preview")
+	TSoftClassPtr<ACPP_UI_ThreeDimensionalActor> PreviewActorClass;
+
+	/** Image with the character's render target. */
+	UPROPERTY(EditAnywhere, meta = (BindWidgetOptional))
+	UImage* Preview_Image;
+
+	/**
+	 * Weak pointer to the actor that shows the character
+	 * (it captures the scene only while this widget is
+	 * opened).
+	 */
+	TWeakObjectPtr<ACPP_UI_ThreeDimensionalActor> PreviewActorRef;
+
+private:
+	/**
+	 * Size of the Preview_Image (in pixels) that was passed
+	 * to the preview actor.
+	 */
+	FVector2D PreviewImageSize;
+
+	/**
+	 * Function for finding the preview actor and for
+	 * turning its capturing on.
+	 */
+	void StartShowingPreview();
+
+	/** Function for turning the preview's capturing off. */
+	void StopShowingPreview();
+
+	/**
+	 * Function for changing the cat's color and for
+	 * capturing the preview with the new color (even if
+	 * the Blueprint overrides ChangeCatsColor).
+	 * @param ColorIndex Index of color to set.
+	 */
+	void ApplyCatsColor(const int32 ColorIndex);
+
 private:
 	/**
 	 * Function for replying on changing of the
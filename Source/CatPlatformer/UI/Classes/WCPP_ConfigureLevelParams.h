@@ -15,6 +15,7 @@ class UCheckBox;
 class UTextBlock;
 class UWidgetSwitcher;
 class UButton;
+class UListView;
 class UScrollBox;
 class UEditableText;
 class UHorizontalBox;
@@ -31,8 +32,24 @@ enum class EPlayingMode : uint8;
 #endif
 class UWCPP_VirtualKeyboard;
 
+#ifndef CPP_PUBLICSESSIONENTRY_H
+#define CPP_PUBLICSESSIONENTRY_H
+#include "CatPlatformer/UI/Classes/CPP_PublicSessionEntry.h"
+#endif
+class UCPP_PublicSessionEntry;
+
 #include "WCPP_ConfigureLevelParams.generated.h"
 
+/** Enumeration for the sorting of the found public sessions. */
+UENUM(BlueprintType)
+enum class EPublicSessionsSorting : uint8
+{
+	ByNumber,
+	ByName,
+	ByPing,
+	ByFreePlaces
+};
+
 /**
  * Widget class that contains UI elements for choosing
  * level settings before starting the new level.
@@ -51,6 +68,13 @@ class CATPLATFORMER_API UWCPP_ConfigureLevelParams : public UWCPP_WidgetParent
 	 */
 	UWCPP_ConfigureLevelParams(const FObjectInitializer& ObjectInitializer);
 
+	/**
+	 * Function that stores logic that should be applied
+	 * once after the widget tree is created (before the
+	 * Slate widgets are built).
+	 */
+	virtual void NativeOnInitialized() override;
+
 	/**
 	 * Function that stores logic that should be applied
 	 * when the widget is created.
@@ -128,6 +152,66 @@ private:
 	UFUNCTION()
 	void LeftArrowOnClick();
 
+	/**
+	 * Flag indicating if the panel for choosing local
+	 * players was already initialized (the first two panels
+	 * are always initialized in the NativeConstruct
+	 * function).
+	 */
+	bool bLocalPlayersPanelWasInitialized;
+
+	/**
+	 * Flag indicating if the panel for choosing the online
+	 * multiplayer page was already initialized.
+	 */
+	bool bOnlineMultiplayerPagePanelWasInitialized;
+
+	/**
+	 * Flag indicating if the panel with public sessions was
+	 * already initialized.
+	 */
+	bool bPublicSessionsPanelWasInitialized;
+
+	/**
+	 * Flag indicating if the panel for joining the private
+	 * session was already initialized.
+	 */
+	bool bPrivateSessionPanelWasInitialized;
+
+	/**
+	 * Flag indicating if the panel for creating the session
+	 * was already initialized.
+	 */
+	bool bCreateSessionPanelWasInitialized;
+
+	/**
+	 * Flag indicating if the panel for choosing the level
+	 * was already initialized.
+	 */
+	bool bChooseLevelPanelWasInitialized;
+
+	/**
+	 * Function for opening the panel in the general panels
+	 * switcher.
+	 * @param Panel Panel that should become visible.
+	 */
+	void SetActivePanel(UWidget* Panel);
+
+	/**
+	 * Function for binding and filling UI elements of the
+	 * currently visible panel if it is opened for the first
+	 * time.
+	 */
+	void InitializeActivePanel();
+
+	/** Functions for initializing panels from third to eighth. */
+	void InitializeLocalPlayersPanel();
+	void InitializeOnlineMultiplayerPagePanel();
+	void InitializePublicSessionsPanel();
+	void InitializePrivateSessionPanel();
+	void InitializeCreateSessionPanel();
+	void InitializeChooseLevelPanel();
+
 
 	//=========First panel (EnterPlayerName_CanvasPanel)=========
 protected:
@@ -566,10 +650,41 @@ protected:
 	UPROPERTY(EditAnywhere, meta = (BindWidget))
 	UButton* FindPublicSessionsButton;
 
-	/** Scroll box for containing available public sessions. */
-	UPROPERTY(EditAnywhere, meta = (BindWidget))
+	/**
+	 * List view for containing available public sessions.
+	 * Creates entry widgets only for the visible sessions
+	 * and reuses them while scrolling.
+	 */
+	UPROPERTY(EditAnywhere, meta = (BindWidgetOptional))
+	UListView* PublicSessionsListView;
+
+	/**
+	 * Placeholder for the PublicSessionsListView in widget
+	 * Blueprints that don't have the list view yet. It is
+	 * replaced with a list view created at runtime.
+	 */
+	UPROPERTY(EditAnywhere, meta = (BindWidgetOptional))
 	UScrollBox* PublicSessionsScrollBox;
 
+	/**
+	 * Editable text for filtering the found public sessions
+	 * by name.
+	 */
+	UPROPERTY(EditAnywhere, meta = (BindWidgetOptional))
+	UEditableText* PublicSessionsFilter_EditableText;
+
+	/**
+	 * Combo box for choosing the sorting of the found public
+	 * sessions (options' order is the same as in the
+	 * EPublicSessionsSorting enumeration).
+	 */
+	UPROPERTY(EditAnywhere, meta = (BindWidgetOptional))
+	UComboBoxString* PublicSessionsSorting_ComboBox;
+
+	/** Check box for hiding sessions without free places. */
+	UPROPERTY(EditAnywhere, meta = (BindWidgetOptional))
+	UCheckBox* HideFullPublicSessions_CheckBox;
+
 	/**
 	 * Check box for changing LAN connection property for
 	 * searching the public sessions.
@@ -632,6 +747,31 @@ protected:
 	 */
 	FDelegateHandle DH_FindingSessionsCompleted;
 
+	/**
+	 * Results of the last public sessions' search. Entries
+	 * of the list view refer to them by index.
+	 */
+	TSharedPtr<FOnlineSessionSearch> LastFoundPublicSessions;
+
+	/** Data objects for all found public sessions. */
+	UPROPERTY()
+	TArray<UCPP_PublicSessionEntry*> PublicSessionEntries;
+
+	/**
+	 * Serial number for the next new session in the list
+	 * (sessions that were found again keep their numbers).
+	 */
+	int32 NextPublicSessionNumber;
+
+	/** The current sorting of the found public sessions. */
+	EPublicSessionsSorting PublicSessionsSorting;
+
+	/** The current filter of the found public sessions. */
+	FString PublicSessionsFilter;
+
+	/** Should sessions without free places be hidden? */
+	bool bHideFullPublicSessions;
+
 	/**
 	 * The serial number of the found public online session
 	 * selected by the user to connect at the moment.
@@ -722,11 +862,26 @@ protected:
 
 	/**
 	 * Function that should be called after completing the
-	 * searching for the public online sessions.
+	 * searching for the public online sessions. The found
+	 * sessions are merged into the current list, so the
+	 * entries of the sessions that are still available
+	 * aren't recreated.
+	 * @param FoundSessions Information about valid found
+	 * sessions.
+	 * @param bIsCachedResult Are these the results of the
+	 * previous search (the new one is still in progress)?
+	 */
+	void FindingSessionsCompleted(const TSharedPtr<FOnlineSessionSearch>& FoundSessions, bool bIsCachedResult);
+
+	/**
+	 * Function for updating the list of public sessions:
+	 * entries of the sessions that were found again are
+	 * reused, new entries are added and entries of the
+	 * disappeared sessions are removed.
 	 * @param FoundSessions Information about valid found
 	 * sessions.
 	 */
-	void FindingSessionsCompleted(const TSharedPtr<FOnlineSessionSearch>& FoundSessions);
+	void MergePublicSessions(const TSharedPtr<FOnlineSessionSearch>& FoundSessions);
 
 	/**
 	 * Function is needed to clear created for finding public
@@ -739,10 +894,82 @@ protected:
 
 	/**
 	 * Function for getting information about one public
-	 * online session from the instance of WCPP_BuffSlot. 
+	 * online session from the instance of
+	 * WCPP_PublicSessionInfo.
+	 * @param SessionEntry Data of the chosen session.
+	 */
+	void GetOneSessionInfo(const UCPP_PublicSessionEntry* SessionEntry);
+
+	/**
+	 * Function that is called when the list view creates a
+	 * new entry widget (it happens only once per pooled
+	 * widget).
+	 * @param EntryWidget The created widget.
+	 */
+	void PublicSessionEntryWidgetGenerated(UUserWidget& EntryWidget);
+
+	/**
+	 * Function for creating the PublicSessionsListView in
+	 * place of the PublicSessionsScrollBox if the widget
+	 * Blueprint doesn't have the list view.
 	 */
-	void GetOneSessionInfo(const int32 SessionNumber, const FUniqueNetIdRepl& UserId,
-	                       const FName& SessionName, const FOnlineSessionSearchResult& SearchResult);
+	void CreatePublicSessionsListView();
+
+	/**
+	 * Function for removing all found public sessions from
+	 * the list view.
+	 */
+	void ClearPublicSessionsList();
+
+	/**
+	 * Function for passing the sorted and filtered sessions
+	 * to the list view (the entry widgets are reused).
+	 */
+	void RefreshPublicSessionsList();
+
+	/**
+	 * Function for changing the sorting of the found public
+	 * sessions.
+	 * @param NewSorting The new sorting.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Public Sessions")
+	void SetPublicSessionsSorting(const EPublicSessionsSorting NewSorting);
+
+	/**
+	 * Function for filtering the found public sessions by
+	 * name.
+	 * @param NewFilter Part of the session's name (empty
+	 * string shows all sessions).
+	 * @param bHideFullSessions Should sessions without free
+	 * places be hidden?
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Public Sessions")
+	void SetPublicSessionsFilter(const FString& NewFilter, const bool bHideFullSessions);
+
+	/**
+	 * Function that is called when the text in the
+	 * PublicSessionsFilter_EditableText is changed.
+	 * @param NewText The new filter.
+	 */
+	UFUNCTION()
+	void PublicSessionsFilterChanged(const FText& NewText);
+
+	/**
+	 * Function that is called when the option of the
+	 * PublicSessionsSorting_ComboBox is changed.
+	 * @param SelectedItem The chosen option.
+	 * @param SelectionType How the option was chosen.
+	 */
+	UFUNCTION()
+	void PublicSessionsSortingChanged(FString SelectedItem, ESelectInfo::Type SelectionType);
+
+	/**
+	 * Function that is called when the state of the
+	 * HideFullPublicSessions_CheckBox is changed.
+	 * @param bIsChecked The new state.
+	 */
+	UFUNCTION()
+	void HideFullPublicSessionsChanged(bool bIsChecked);
 
 	/**
 	 * Function for starting connection to some public
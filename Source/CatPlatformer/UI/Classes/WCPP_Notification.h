@@ -8,9 +8,14 @@
 
 class UButton;
 class UTextBlock;
+class UWCPP_Notification;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FNotificationWasClosed, UWCPP_Notification* /* Notification */);
 
 /**
- * Widget class needed for showing notifications.
+ * Widget class needed for showing notifications. Widgets
+ * are pooled by the HUD, so one widget can be shown many
+ * times with different texts.
  */
 UCLASS(Abstract)
 class CATPLATFORMER_API UWCPP_Notification : public UUserWidget
@@ -60,6 +65,12 @@ protected:
 	UButton* CloseNotificationButton;
 
 public:
+	/**
+	 * Delegate for notifying that the notification was
+	 * removed from the screen (so it can be reused).
+	 */
+	FNotificationWasClosed NotificationWasClosedDelegate;
+
 	/**
 	 * Function for updating the ClosingTime variable.
 	 * @param NewValue Value to set.
@@ -72,6 +83,19 @@ public:
 	 */
 	void SetNewNotificationText(const FText& NotificationText) const;
 
+	/** Function for getting the notification's text. */
+	FText GetNotificationText() const;
+
+	/**
+	 * Function for showing the notification longer (when
+	 * the same text was sent again).
+	 * @param TimeToDisplay Number of seconds from now after
+	 * which the notification will be closed.
+	 * @return True if the notification hasn't started
+	 * closing yet.
+	 */
+	bool ProlongDisplaying(const float TimeToDisplay);
+
 	/**
 	 * Function for calling the decreasing transparency
 	 * animation and destroying current notification.
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Blueprint/IUserObjectListEntry.h"
 
 #ifndef WCPP_WIDGETPARENT_H
 #define WCPP_WIDGETPARENT_H
@@ -11,21 +12,25 @@
 class UWCPP_WidgetParent;
 class UTextBlock;
 class UButton;
-class FOnlineSessionSearch;
+
+#ifndef CPP_PUBLICSESSIONENTRY_H
+#define CPP_PUBLICSESSIONENTRY_H
+#include "CatPlatformer/UI/Classes/CPP_PublicSessionEntry.h"
+#endif
+class UCPP_PublicSessionEntry;
 
 #include "WCPP_PublicSessionInfo.generated.h"
 
-DECLARE_DELEGATE_FourParams(FPassSessionInfo,
-                            const int32 /* SessionNumber */,
-                            const FUniqueNetIdRepl& /* UserId */,
-                            const FName& /* SessionName */,
-                            const FOnlineSessionSearchResult& /* SearchResult */);
+DECLARE_DELEGATE_OneParam(FPassSessionInfo, const UCPP_PublicSessionEntry* /* SessionEntry */);
 
 /**
  * Widget class for representing one public session.
+ * Is used as an entry of the sessions' list view, so the
+ * same widget is reused for different sessions while
+ * scrolling.
  */
 UCLASS()
-class CATPLATFORMER_API UWCPP_PublicSessionInfo : public UWCPP_WidgetParent
+class CATPLATFORMER_API UWCPP_PublicSessionInfo : public UWCPP_WidgetParent, public IUserObjectListEntry
 {
 	GENERATED_BODY()
 
@@ -50,6 +55,14 @@ class CATPLATFORMER_API UWCPP_PublicSessionInfo : public UWCPP_WidgetParent
 	 */
 	virtual void NativeDestruct() override;
 
+	/**
+	 * Function that is called by the list view when the
+	 * widget starts representing another session.
+	 * @param ListItemObject Instance of the
+	 * UCPP_PublicSessionEntry class.
+	 */
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
 public:
 	/**
 	 * Delegate for sending information about the associated
@@ -57,19 +70,18 @@ public:
 	 */
 	FPassSessionInfo PassSessionInfoDelegate;
 
-	/** Number of session. */
-	int32 SessionNumber;
-
-	/** ID of the online session's owner. */
-	FUniqueNetIdRepl UserId;
-
-	/** The name of the session. */
-	FName SessionName;
-
-	/** Struct with additional info about the session. */
-	FOnlineSessionSearchResult SearchResult;
+	/**
+	 * Function for showing the given session in the widget.
+	 * Is called by the list view and by the scroll box
+	 * fallback of the UWCPP_ConfigureLevelParams.
+	 * @param NewSessionEntry Data of the session.
+	 */
+	void SetSessionEntry(UCPP_PublicSessionEntry* NewSessionEntry);
 
 protected:
+	/** The session represented by the widget at the moment. */
+	TWeakObjectPtr<UCPP_PublicSessionEntry> SessionEntry;
+
 	/**
 	 * Button for passing information about the related
 	 * session.
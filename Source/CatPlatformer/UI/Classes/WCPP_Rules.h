@@ -13,6 +13,7 @@ class UScrollBox;
 class USlider;
 class UWidgetSwitcher;
 class UButton;
+class ACPP_UI_ThreeDimensionalActor;
 
 #include "WCPP_Rules.generated.h"
 
@@ -105,6 +106,31 @@ protected:
 	UPROPERTY(EditAnywhere, meta = (BindWidget))
 	UScrollBox* InfoScrollBox_7;
 
+	//=====================3D Previews=============================
+
+	/**
+	 * Classes of the actors that are shown in the rules
+	 * (they capture the scene only while this widget is
+	 * opened). The classes aren't loaded by the widget:
+	 * only the actors that are placed on the level are
+	 * found.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Preview")
+	TArray<TSoftClassPtr<ACPP_UI_ThreeDimensionalActor>> PreviewActorsClasses;
+
+private:
+	/** Actors that are shown in the rules right now. */
+	TArray<TWeakObjectPtr<ACPP_UI_ThreeDimensionalActor>> PreviewActors;
+
+	/**
+	 * Function for finding the preview actors and for
+	 * turning their capturing on.
+	 */
+	void StartShowingPreviews();
+
+	/** Function for turning the previews' capturing off. */
+	void StopShowingPreviews();
+
 	//===============Gamepad || Keyboard modes=====================
 private:
 	/**
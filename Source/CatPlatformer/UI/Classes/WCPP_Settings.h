@@ -23,6 +23,7 @@ class ACPP_SoundManagerMainMenu;
 class ACPP_SoundManagerLevel;
 
 class USlider;
+class UWidget;
 class UWidgetSwitcher;
 class UCheckBox;
 class UTextBlock;
@@ -146,6 +147,40 @@ private:
 	UFUNCTION()
 	void LeftArrowOnClick();
 
+	/**
+	 * Flag indicating if the volumes' sliders were already
+	 * initialized (every group of UI elements is initialized
+	 * only when its panel becomes visible for the first
+	 * time).
+	 */
+	bool bVolumesWereInitialized;
+
+	/**
+	 * Flag indicating if the track lists were already
+	 * initialized.
+	 */
+	bool bTracksWereInitialized;
+
+	/**
+	 * Flag indicating if the video quality panel was already
+	 * initialized.
+	 */
+	bool bVideoQualityWasInitialized;
+
+	/**
+	 * Function for checking if the widget is located on the
+	 * currently visible panel of the Panels Switcher.
+	 * @param Widget Widget to check.
+	 * @return True if the widget is visible.
+	 */
+	bool IsOnActivePanel(UWidget* Widget) const;
+
+	/**
+	 * Function for initializing all groups of UI elements
+	 * located on the currently visible panel.
+	 */
+	void InitializeActivePanel();
+
 	//====================Audio Panel==============================
 
 	/**
@@ -162,6 +197,13 @@ private:
 	UFUNCTION()
 	void InitializeLevelTracksPanel();
 
+	/**
+	 * Function for spawning the second sound manager (the
+	 * one that isn't playing now), updating both track
+	 * lists and binding their buttons.
+	 */
+	void InitializeTracks();
+
 	//==================Volumes=======================
 protected:
 	/** Slider for changing SFX volume. */
@@ -173,6 +215,12 @@ protected:
 	USlider* Music_Volume_Slider;
 
 private:
+	/**
+	 * Function for setting current volumes to the sliders
+	 * and binding them.
+	 */
+	void InitializeVolumes();
+
 	/**
 	 * Function for replying on SFX_Volume_Slider value
 	 * changing.
@@ -571,6 +619,12 @@ private:
 	 */
 	FIntPoint CurrentScreenResolution;
 
+	/**
+	 * Function for reading current game user settings and
+	 * binding the video quality panel's buttons.
+	 */
+	void InitializeVideoQuality();
+
 	/**
 	 * Function for filling the Current Screen Resolution
 	 * Text Block with related value.
@@ -0,0 +1,112 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+
+#ifndef TABLEROWS_H
+#define TABLEROWS_H
+#include "CatPlatformer/AssetPointer/Classes/TableRows.h"
+#endif
+enum class EVirtualKeyType : uint8;
+
+class UButton;
+class UTextBlock;
+#include "WCPP_VirtualKeyboardKey.generated.h"
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FVirtualKeyWasPressed, const int32 /* KeyIndex */);
+
+/**
+ * Widget for one key of the virtual keyboard. Keys are
+ * created by the keyboard from its keys table. If the
+ * widget Blueprint doesn't have the KeyButton or the
+ * KeyTextBlock (or the class is used directly), the
+ * missing widgets are created at runtime.
+ */
+UCLASS()
+class CATPLATFORMER_API UWCPP_VirtualKeyboardKey : public UUserWidget
+{
+	GENERATED_BODY()
+
+protected:
+	/**
+	 * The constructor to set default variables.
+	 * @param ObjectInitializer Internal class to finalize
+	 * UObject creation.
+	 */
+	UWCPP_VirtualKeyboardKey(const FObjectInitializer& ObjectInitializer);
+
+	/**
+	 * Function that is called once after the widget's tree
+	 * is created. Creates the button and the text block if
+	 * they aren't bound.
+	 */
+	virtual void NativeOnInitialized() override;
+
+	/**
+	 * Function that stores logic that should be applied
+	 * when the widget is created.
+	 */
+	virtual void NativeConstruct() override;
+
+	/**
+	 * Function that stores logic that should be applied
+	 * when the widget starts destroying.
+	 */
+	virtual void NativeDestruct() override;
+
+	/** Button of the key. */
+	UPROPERTY(EditAnywhere, meta = (BindWidgetOptional))
+	UButton* KeyButton;
+
+	/** Text block for the key's symbol. */
+	UPROPERTY(EditAnywhere, meta = (BindWidgetOptional))
+	UTextBlock* KeyTextBlock;
+
+	/**
+	 * Function for changing the key's look up to its type
+	 * (for example, showing the icon of the backspace).
+	 * @param NewKeyType New type of the key.
+	 */
+	UFUNCTION(BlueprintImplementableEvent)
+	void ChangeKeyImage(EVirtualKeyType NewKeyType);
+
+private:
+	/** Index of the key's row in the keyboard's table. */
+	int32 KeyIndex;
+
+	/** Type of the key. */
+	EVirtualKeyType KeyType;
+
+	/** Function for replying on the key's button click. */
+	UFUNCTION()
+	void KeyButtonOnClick();
+
+public:
+	/** Delegate for passing the key's index after click. */
+	FVirtualKeyWasPressed KeyWasPressedDelegate;
+
+	/**
+	 * Function for assigning the key to the row of the
+	 * keyboard's table.
+	 * @param InKeyIndex Index of the row.
+	 * @param InKeyType Type of the key.
+	 */
+	void SetKey(const int32 InKeyIndex, const EVirtualKeyType InKeyType);
+
+	/**
+	 * Getter for the KeyIndex variable.
+	 * @return Index of the key's row.
+	 */
+	FORCEINLINE int32 GetKeyIndex() const { return KeyIndex; }
+
+	/**
+	 * Function for changing the key's text.
+	 * @param NewText Text to show.
+	 */
+	void SetKeyText(const FText& NewText) const;
+
+	/** Function for setting focus on the key's button. */
+	void SetFocusOnKey() const;
+};
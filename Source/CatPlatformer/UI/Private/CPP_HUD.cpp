@@ -17,13 +17,26 @@ class UWCPP_Notification;
 #include "CatPlatformer/StaticLibraries/Classes/CPP_StaticWidgetLibrary.h"
 #endif
 
+#ifndef CPP_STATS_H
+#define CPP_STATS_H
+#include "CatPlatformer/Debug/Classes/CPP_Stats.h"
+#endif
+
+#ifndef CPP_SYNCLOADDETECTOR_H
+#define CPP_SYNCLOADDETECTOR_H
+#include "CatPlatformer/Debug/Classes/CPP_SyncLoadDetector.h"
+#endif
+
 ACPP_HUD::ACPP_HUD(): GameInstanceRef(nullptr), PlayerControllerRef(nullptr),
                       PlayerStateRef(nullptr), WidgetBlueprintsDataTable(nullptr),
                       SoundManagersDataTable(nullptr),
                       Container_Widget(nullptr), ChooseSaveSlot_Widget(nullptr),
                       MainMenu_Widget(nullptr), Pause_Widget(nullptr),
                       LoadingScreen_Widget(nullptr), Level_Widget(nullptr),
-                      EndLevel_Widget(nullptr)
+                      EndLevel_Widget(nullptr), bIsEndingPlay(false),
+                      WidgetsWarmUpDelay(1.0f), WidgetsWarmUpInterval(0.2f),
+                      MaxShownNotifications(3), MaxQueuedNotifications(8),
+                      NotificationsCoalescingWindow(2.0f)
 {
 }
 
@@ -111,13 +124,17 @@ void ACPP_HUD::BeginPlay()
 
 void ACPP_HUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	bIsEndingPlay = true;
+
 	DestroyLoadingScreenWidget(false);
 	DestroyEndLevelWidget();
 	DestroyMainMenuWidget();
 	DestroyPauseWidget();
 	DestroyLevelWidget();
 	DestroyChooseSaveSlotWidget();
+	ClearNotifications();
 	DestroyContainerWidget();
+	ClearWidgetsCache();
 
 	if (PlayerControllerRef.IsValid())
 	{
@@ -224,32 +241,156 @@ void ACPP_HUD::OnControllerConnectionChanged(EInputDeviceConnectionState NewConn
 	}
 }
 
-void ACPP_HUD::CreateNewNotification(const FText& NewText, const float TimeToDisplay) const
+void ACPP_HUD::CreateNewNotification(const FText& NewText, const float TimeToDisplay)
 {
-	if (GameInstanceRef.IsValid() &&
-		PlayerControllerRef.IsValid() &&
-		Container_Widget.IsValid())
+	if (bIsEndingPlay || NewText.IsEmpty())
+		return;
+
+	const double CurrentTime = GetWorld()->GetRealTimeSeconds();
+	const FString Key = NewText.ToString();
+
+	// The same notification sent again in a short period
+	// (e.g. by several players or errors at once) only
+	// prolongs the shown or the queued one. If it can't be
+	// prolonged (it is already hiding), it is shown again.
+	if (const double* LastTime = LastNotificationsTimes.Find(Key);
+		LastTime && CurrentTime - *LastTime < NotificationsCoalescingWindow)
+	{
+		for (UWCPP_Notification* Notification : ShownNotifications)
+		{
+			if (IsValid(Notification) && Notification->GetNotificationText().EqualTo(NewText) &&
+				Notification->ProlongDisplaying(TimeToDisplay))
+				return;
+		}
+		for (FQueuedNotification& QueuedNotification : NotificationsQueue)
+		{
+			if (QueuedNotification.Text.EqualTo(NewText))
+			{
+				QueuedNotification.TimeToDisplay = FMath::Max(QueuedNotification.TimeToDisplay, TimeToDisplay);
+				return;
+			}
+		}
+	}
+
+	for (auto It = LastNotificationsTimes.CreateIterator(); It; ++It)
+	{
+		if (CurrentTime - It->Value >= NotificationsCoalescingWindow)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	LastNotificationsTimes.Emplace(Key, CurrentTime);
+
+	if (ShownNotifications.Num() < MaxShownNotifications)
+	{
+		ShowNotification(NewText, TimeToDisplay);
+	}
+	else
 	{
-		const FName Row = FName(TEXT("Notification"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (NotificationsQueue.Num() >= MaxQueuedNotifications)
+		{
+			NotificationsQueue.RemoveAt(0);
+		}
+		NotificationsQueue.Emplace(FQueuedNotification{NewText, TimeToDisplay});
+	}
+}
+
+void ACPP_HUD::ShowNotification(const FText& NewText, const float TimeToDisplay)
+{
+	if (!Container_Widget.IsValid())
+		return;
+
+	UWCPP_Notification* NotificationWidget = nullptr;
+	while (!FreeNotifications.IsEmpty() && !IsValid(NotificationWidget))
+	{
+		NotificationWidget = FreeNotifications.Pop();
+	}
+
+	if (!IsValid(NotificationWidget))
+	{
+		CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
+		if (GameInstanceRef.IsValid() &&
+			PlayerControllerRef.IsValid() &&
+			IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
 		{
 			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
 				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
 					WidgetBlueprintsDataTable.Get(),
-					Row)))
+					FName(TEXT("Notification")))))
 			{
-				if (UWCPP_Notification* NotificationWidget = CreateWidget<UWCPP_Notification>(
-						PlayerControllerRef.Get(), Class);
-					IsValid(NotificationWidget))
+				NotificationWidget = CreateWidget<UWCPP_Notification>(PlayerControllerRef.Get(), Class);
+				if (IsValid(NotificationWidget))
 				{
-					NotificationWidget->SetFlags(RF_StrongRefOnFrame);
-					NotificationWidget->SetClosingTime(TimeToDisplay);
-					NotificationWidget->SetNewNotificationText(NewText);
-					Container_Widget->NotificationsScrollBox->AddChild(NotificationWidget);
+					NotificationWidget->NotificationWasClosedDelegate.AddUObject(
+						this, &ACPP_HUD::NotificationWasClosed);
 				}
 			}
 		}
 	}
+
+	if (IsValid(NotificationWidget))
+	{
+		NotificationWidget->SetClosingTime(TimeToDisplay);
+		NotificationWidget->SetNewNotificationText(NewText);
+		ShownNotifications.Emplace(NotificationWidget);
+		Container_Widget->NotificationsScrollBox->AddChild(NotificationWidget);
+	}
+}
+
+void ACPP_HUD::ShowQueuedNotifications()
+{
+	while (!NotificationsQueue.IsEmpty() &&
+		ShownNotifications.Num() < MaxShownNotifications)
+	{
+		const FQueuedNotification Notification = NotificationsQueue[0];
+		NotificationsQueue.RemoveAt(0);
+		ShowNotification(Notification.Text, Notification.TimeToDisplay);
+	}
+}
+
+void ACPP_HUD::NotificationWasClosed(UWCPP_Notification* Notification)
+{
+	ShownNotifications.Remove(Notification);
+	if (bIsEndingPlay)
+		return;
+
+	FreeNotifications.Emplace(Notification);
+
+	// The widget is still being removed from the scroll
+	// box, so the next one is added on the next tick.
+	if (!NotificationsQueue.IsEmpty())
+	{
+		TH_ShowQueuedNotifications = GetWorld()->GetTimerManager().SetTimerForNextTick(
+			this, &ACPP_HUD::ShowQueuedNotifications);
+	}
+}
+
+void ACPP_HUD::ClearNotifications()
+{
+	if (GetWorld()->GetTimerManager().TimerExists(TH_ShowQueuedNotifications))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_ShowQueuedNotifications);
+	}
+
+	NotificationsQueue.Empty();
+	LastNotificationsTimes.Empty();
+	for (UWCPP_Notification* Notification : ShownNotifications)
+	{
+		if (IsValid(Notification))
+		{
+			Notification->NotificationWasClosedDelegate.RemoveAll(this);
+		}
+	}
+	for (UWCPP_Notification* Notification : FreeNotifications)
+	{
+		if (IsValid(Notification))
+		{
+			Notification->NotificationWasClosedDelegate.RemoveAll(this);
+		}
+	}
+	ShownNotifications.Empty();
+	FreeNotifications.Empty();
 }
 
 void ACPP_HUD::PauseModeChanged(const bool bIsPaused)
@@ -296,12 +437,14 @@ void ACPP_HUD::ResetAllBuffsEffects() const
 
 void ACPP_HUD::InitializeContainerWidget()
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
 	if (GameInstanceRef.IsValid() &&
 		PlayerControllerRef.IsValid() &&
 		Container_Widget == nullptr)
 	{
 		const FName Row = FName(TEXT("Container"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
 		{
 			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
 				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
@@ -330,6 +473,8 @@ void ACPP_HUD::DestroyContainerWidget()
 
 void ACPP_HUD::InitializeMainMenuWidget()
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
 	if (Container_Widget.IsValid())
 	{
 		Container_Widget->BackgroundImage->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
@@ -341,61 +486,56 @@ void ACPP_HUD::InitializeMainMenuWidget()
 		PlayerControllerRef.IsValid() &&
 		MainMenu_Widget == nullptr)
 	{
-		const FName Row = FName(TEXT("MainMenu"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		MainMenu_Widget = Cast<UWCPP_MainMenu>(AcquireWidget(FName(TEXT("MainMenu"))));
+		if (MainMenu_Widget.IsValid() && Container_Widget.IsValid())
 		{
-			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-					WidgetBlueprintsDataTable.Get(),
-					Row)))
+			MainMenu_Widget->SetGameInstanceRef(GameInstanceRef.Get());
+			MainMenu_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
+			MainMenu_Widget->ShouldOpenSaveSlotsPanelDelegate.BindUObject(
+				this, &ACPP_HUD::InitializeChooseSaveSlotWidget);
+			if (PlayerControllerRef->GetSoundManagerRef() == nullptr)
 			{
-				MainMenu_Widget = CreateWidget<UWCPP_MainMenu>(PlayerControllerRef.Get(), Class);
-				if (MainMenu_Widget.IsValid() && Container_Widget.IsValid())
+				if (IsValid(CAT_LOAD_SYNCHRONOUS(SoundManagersDataTable)))
 				{
-					MainMenu_Widget->SetFlags(RF_StrongRefOnFrame);
-					MainMenu_Widget->SetGameInstanceRef(GameInstanceRef.Get());
-					MainMenu_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
-					MainMenu_Widget->ShouldOpenSaveSlotsPanelDelegate.BindUObject(
-						this, &ACPP_HUD::InitializeChooseSaveSlotWidget);
-					if (PlayerControllerRef->GetSoundManagerRef() == nullptr)
+					if (UClass* SoundManagerClass = GameInstanceRef->GetActorClassBySoftReference(
+						UCPP_StaticWidgetLibrary::GetSoftReferenceToSoundManagerByRowName(
+							SoundManagersDataTable.Get(),
+							FName(TEXT("MainMenuSoundManager")))))
 					{
-						if (IsValid(SoundManagersDataTable.LoadSynchronous()))
+						ACPP_SoundManager* TmpSoundManager = GetWorld()->SpawnActorDeferred<ACPP_SoundManager>(
+							SoundManagerClass,
+							FTransform::Identity,
+							nullptr,
+							nullptr,
+							ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+
+						if (IsValid(TmpSoundManager))
 						{
-							if (UClass* SoundManagerClass = GameInstanceRef->GetActorClassBySoftReference(
-								UCPP_StaticWidgetLibrary::GetSoftReferenceToSoundManagerByRowName(
-									SoundManagersDataTable.Get(),
-									FName(TEXT("MainMenuSoundManager")))))
+							TmpSoundManager->SetPlayerControllerRef(PlayerControllerRef.Get());
+							bool bSetDefaultValues = true;
+							if (IsValid(PlayerControllerRef->GetCharacter()) &&
+								IsValid(PlayerControllerRef->GetCharacter()->GetPlayerState<ACPP_PlayerState>()))
 							{
-								ACPP_SoundManager* TmpSoundManager = GetWorld()->SpawnActorDeferred<ACPP_SoundManager>(
-									SoundManagerClass,
-									FTransform::Identity,
-									nullptr,
-									nullptr,
-									ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
-
-								if (IsValid(TmpSoundManager))
-								{
-									TmpSoundManager->SetPlayerControllerRef(PlayerControllerRef.Get());
-									bool bSetDefaultValues = true;
-									if (IsValid(PlayerControllerRef->GetCharacter()) &&
-										IsValid(
-											PlayerControllerRef->GetCharacter()->GetPlayerState<ACPP_PlayerState>()))
-									{
-										bSetDefaultValues = !PlayerControllerRef->GetCharacter()->
-											GetPlayerState<ACPP_PlayerState>()->
-											GetSaveFileWasCreated();
-									}
-									TmpSoundManager->ApplySettingsFromTheSaveFile(bSetDefaultValues, false);
-									PlayerControllerRef->SetSoundManagerRef(TmpSoundManager);
-									UGameplayStatics::FinishSpawningActor(TmpSoundManager, FTransform());
-								}
+								bSetDefaultValues = !PlayerControllerRef->GetCharacter()->
+									GetPlayerState<ACPP_PlayerState>()->
+									GetSaveFileWasCreated();
 							}
+							TmpSoundManager->ApplySettingsFromTheSaveFile(bSetDefaultValues, false);
+							PlayerControllerRef->SetSoundManagerRef(TmpSoundManager);
+							UGameplayStatics::FinishSpawningActor(TmpSoundManager, FTransform());
 						}
 					}
-					DestroyPauseWidget();
-					Container_Widget->MainMenuAndPauseWidgetSizeBox->AddChild(MainMenu_Widget.Get());
 				}
 			}
+			DestroyPauseWidget();
+			Container_Widget->MainMenuAndPauseWidgetSizeBox->AddChild(MainMenu_Widget.Get());
+
+			WarmUpWidgets({
+				FName(TEXT("LevelParams")),
+				FName(TEXT("Settings")),
+				FName(TEXT("Statistics")),
+				FName(TEXT("ChooseSave"))
+			});
 		}
 	}
 }
@@ -405,7 +545,7 @@ void ACPP_HUD::DestroyMainMenuWidget()
 	if (MainMenu_Widget.IsValid())
 	{
 		MainMenu_Widget->ShouldOpenSaveSlotsPanelDelegate.Unbind();
-		MainMenu_Widget->RemoveFromParent();
+		ReleaseWidget(FName(TEXT("MainMenu")), MainMenu_Widget.Get());
 		MainMenu_Widget = nullptr;
 
 		if (PlayerControllerRef.IsValid())
@@ -422,6 +562,8 @@ void ACPP_HUD::DestroyMainMenuWidget()
 
 void ACPP_HUD::InitializeChooseSaveSlotWidget()
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
 	if (Container_Widget.IsValid())
 	{
 		Container_Widget->BackgroundImage->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
@@ -433,25 +575,16 @@ void ACPP_HUD::InitializeChooseSaveSlotWidget()
 		PlayerControllerRef.IsValid() &&
 		ChooseSaveSlot_Widget == nullptr)
 	{
-		const FName Row = FName(TEXT("ChooseSave"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		ChooseSaveSlot_Widget = Cast<UWCPP_ChooseSaveSlot>(AcquireWidget(FName(TEXT("ChooseSave"))));
+		if (ChooseSaveSlot_Widget.IsValid() && Container_Widget.IsValid())
 		{
-			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-					WidgetBlueprintsDataTable.Get(),
-					Row)))
-			{
-				ChooseSaveSlot_Widget = CreateWidget<UWCPP_ChooseSaveSlot>(PlayerControllerRef.Get(), Class);
-				if (ChooseSaveSlot_Widget.IsValid() && Container_Widget.IsValid())
-				{
-					ChooseSaveSlot_Widget->SetFlags(RF_StrongRefOnFrame);
-					ChooseSaveSlot_Widget->SetGameInstanceRef(GameInstanceRef.Get());
-					ChooseSaveSlot_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
-					ChooseSaveSlot_Widget->ShouldOpenMainMenuDelegate.
-					                       BindUObject(this, &ACPP_HUD::InitializeMainMenuWidget);
-					Container_Widget->MainMenuAndPauseWidgetSizeBox->AddChild(ChooseSaveSlot_Widget.Get());
-				}
-			}
+			ChooseSaveSlot_Widget->SetGameInstanceRef(GameInstanceRef.Get());
+			ChooseSaveSlot_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
+			ChooseSaveSlot_Widget->ShouldOpenMainMenuDelegate.
+			                       BindUObject(this, &ACPP_HUD::InitializeMainMenuWidget);
+			Container_Widget->MainMenuAndPauseWidgetSizeBox->AddChild(ChooseSaveSlot_Widget.Get());
+
+			WarmUpWidgets({FName(TEXT("MainMenu"))});
 		}
 	}
 }
@@ -461,13 +594,15 @@ void ACPP_HUD::DestroyChooseSaveSlotWidget()
 	if (ChooseSaveSlot_Widget.IsValid())
 	{
 		ChooseSaveSlot_Widget->ShouldOpenMainMenuDelegate.Unbind();
-		ChooseSaveSlot_Widget->RemoveFromParent();
+		ReleaseWidget(FName(TEXT("ChooseSave")), ChooseSaveSlot_Widget.Get());
 		ChooseSaveSlot_Widget = nullptr;
 	}
 }
 
 void ACPP_HUD::InitializePauseWidget()
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
 	if (MainMenu_Widget.IsValid())
 		return;
 
@@ -485,30 +620,19 @@ void ACPP_HUD::InitializePauseWidget()
 		PlayerControllerRef.IsValid() &&
 		Pause_Widget == nullptr)
 	{
-		const FName Row = FName(TEXT("Pause"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		Pause_Widget = Cast<UWCPP_WidgetParent>(AcquireWidget(FName(TEXT("Pause"))));
+		if (Pause_Widget.IsValid() && Container_Widget.IsValid())
 		{
-			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-					WidgetBlueprintsDataTable.Get(),
-					Row)))
+			Pause_Widget->SetGameInstanceRef(GameInstanceRef.Get());
+			Pause_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
+			if (GameInstanceRef->GetPlayingModeAsInt() == 1)
 			{
-				Pause_Widget = CreateWidget<UWCPP_WidgetParent>(PlayerControllerRef.Get(), Class);
-				if (Pause_Widget.IsValid() && Container_Widget.IsValid())
-				{
-					Pause_Widget->SetFlags(RF_StrongRefOnFrame);
-					Pause_Widget->SetGameInstanceRef(GameInstanceRef.Get());
-					Pause_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
-					if (GameInstanceRef->GetPlayingModeAsInt() == 1)
-					{
-						Pause_Widget->SetOwningPlayer(PlayerControllerRef.Get());
-						Pause_Widget->AddToViewport(0);
-					}
-					else
-					{
-						Container_Widget->MainMenuAndPauseWidgetSizeBox->AddChild(Pause_Widget.Get());
-					}
-				}
+				Pause_Widget->SetOwningPlayer(PlayerControllerRef.Get());
+				Pause_Widget->AddToViewport(0);
+			}
+			else
+			{
+				Container_Widget->MainMenuAndPauseWidgetSizeBox->AddChild(Pause_Widget.Get());
 			}
 		}
 	}
@@ -523,19 +647,21 @@ void ACPP_HUD::DestroyPauseWidget()
 
 	if (Pause_Widget.IsValid())
 	{
-		Pause_Widget->RemoveFromParent();
+		ReleaseWidget(FName(TEXT("Pause")), Pause_Widget.Get());
 		Pause_Widget = nullptr;
 	}
 }
 
 void ACPP_HUD::InitializeLoadingScreenWidget()
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
 	if (GameInstanceRef.IsValid() &&
 		PlayerControllerRef.IsValid() &&
 		LoadingScreen_Widget == nullptr)
 	{
 		const FName Row = FName(TEXT("Loading"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
 		{
 			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
 				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
@@ -584,12 +710,14 @@ void ACPP_HUD::DestroyLoadingScreenWidget(const bool bShouldHideBackgroundImage)
 
 void ACPP_HUD::InitializeLevelWidget()
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
 	if (GameInstanceRef.IsValid() &&
 		PlayerControllerRef.IsValid() &&
 		Level_Widget == nullptr)
 	{
 		const FName Row = FName(TEXT("Level"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
 		{
 			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
 				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
@@ -609,7 +737,7 @@ void ACPP_HUD::InitializeLevelWidget()
 					Level_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
 					if (PlayerControllerRef->GetSoundManagerRef() == nullptr)
 					{
-						if (IsValid(SoundManagersDataTable.LoadSynchronous()))
+						if (IsValid(CAT_LOAD_SYNCHRONOUS(SoundManagersDataTable)))
 						{
 							if (UClass* SoundManagerClass = GameInstanceRef->GetActorClassBySoftReference(
 								UCPP_StaticWidgetLibrary::GetSoftReferenceToSoundManagerByRowName(
@@ -643,6 +771,12 @@ void ACPP_HUD::InitializeLevelWidget()
 						}
 					}
 					Container_Widget->LevelWidgetSizeBox->AddChild(Level_Widget.Get());
+
+					WarmUpWidgets({
+						FName(TEXT("Pause")),
+						FName(TEXT("Settings")),
+						FName(TEXT("EndLevel"))
+					});
 				}
 			}
 		}
@@ -666,30 +800,21 @@ void ACPP_HUD::LevelWasEnded(const bool bIsWinner)
 
 void ACPP_HUD::InitializeEndLevelWidget(const bool bIsWinner)
 {
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
 	if (GameInstanceRef.IsValid() &&
 		PlayerControllerRef.IsValid() &&
 		EndLevel_Widget == nullptr)
 	{
-		const FName Row = FName(TEXT("EndLevel"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		EndLevel_Widget = Cast<UWCPP_EndLevel>(AcquireWidget(FName(TEXT("EndLevel"))));
+		if (EndLevel_Widget.IsValid() && Container_Widget.IsValid())
 		{
-			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-					WidgetBlueprintsDataTable.Get(),
-					Row)))
-			{
-				EndLevel_Widget = CreateWidget<UWCPP_EndLevel>(PlayerControllerRef.Get(), Class);
-				if (EndLevel_Widget.IsValid() && Container_Widget.IsValid())
-				{
-					EndLevel_Widget->SetFlags(RF_StrongRefOnFrame);
-					PlayerControllerRef->ChangeInputEnabling(false);
-					PlayerControllerRef->ChangeCursorVisibility(true);
-					EndLevel_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
-					EndLevel_Widget->SetGameInstanceRef(GameInstanceRef.Get());
-					EndLevel_Widget->SetIsWinner(bIsWinner);
-					Container_Widget->LevelWidgetSizeBox->AddChild(EndLevel_Widget.Get());
-				}
-			}
+			PlayerControllerRef->ChangeInputEnabling(false);
+			PlayerControllerRef->ChangeCursorVisibility(true);
+			EndLevel_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
+			EndLevel_Widget->SetGameInstanceRef(GameInstanceRef.Get());
+			EndLevel_Widget->SetIsWinner(bIsWinner);
+			Container_Widget->LevelWidgetSizeBox->AddChild(EndLevel_Widget.Get());
 		}
 	}
 }
@@ -698,7 +823,7 @@ void ACPP_HUD::DestroyEndLevelWidget()
 {
 	if (EndLevel_Widget.IsValid())
 	{
-		EndLevel_Widget->RemoveFromParent();
+		ReleaseWidget(FName(TEXT("EndLevel")), EndLevel_Widget.Get());
 		EndLevel_Widget = nullptr;
 	}
 }
@@ -717,3 +842,167 @@ void ACPP_HUD::EndPause()
 	DestroyPauseWidget();
 	PlayerControllerRef->EndPause();
 }
+
+
+UUserWidget* ACPP_HUD::AcquireWidget(const FName& Row)
+{
+	CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
+	PostponeWidgetsWarmUp();
+
+	UUserWidget* Widget = nullptr;
+	if (CachedWidgets.RemoveAndCopyValue(Row, Widget) && IsValid(Widget))
+	{
+		RowsInUse.Add(Row);
+		return Widget;
+	}
+	Widget = nullptr;
+
+	if (GameInstanceRef.IsValid() &&
+		PlayerControllerRef.IsValid() &&
+		IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
+	{
+		if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
+			UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
+				WidgetBlueprintsDataTable.Get(),
+				Row)))
+		{
+			Widget = CreateWidget<UUserWidget>(PlayerControllerRef.Get(), Class);
+			if (IsValid(Widget))
+			{
+				Widget->SetFlags(RF_StrongRefOnFrame);
+				RowsInUse.Add(Row);
+			}
+		}
+	}
+	return Widget;
+}
+
+void ACPP_HUD::ReleaseWidget(const FName& Row, UUserWidget* Widget)
+{
+	if (!IsValid(Widget))
+		return;
+
+	Widget->RemoveFromParent();
+	RowsInUse.Remove(Row);
+
+	if (!bIsEndingPlay && !CachedWidgets.Contains(Row))
+	{
+		CachedWidgets.Emplace(Row, Widget);
+	}
+}
+
+void ACPP_HUD::WarmUpWidgets(const TArray<FName>& Rows)
+{
+	if (bIsEndingPlay ||
+		!GameInstanceRef.IsValid() ||
+		!IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
+		return;
+
+	for (const FName& Row : Rows)
+	{
+		if (CachedWidgets.Contains(Row) || RowsInUse.Contains(Row) || WarmUpQueue.Contains(Row))
+			continue;
+
+		const TSoftClassPtr<UUserWidget> WidgetClass =
+			UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
+				WidgetBlueprintsDataTable.Get(),
+				Row);
+		if (WidgetClass.IsNull())
+			continue;
+
+		WarmUpQueue.Emplace(Row);
+		if (WidgetClass.IsPending())
+		{
+			WarmUpHandles.Emplace(Row, GameInstanceRef->RequestAsyncLoad(WidgetClass.ToSoftObjectPath()));
+		}
+	}
+
+	PostponeWidgetsWarmUp();
+}
+
+void ACPP_HUD::WarmUpNextWidget()
+{
+	// Only one widget is constructed per call, and only if
+	// its class is already loaded, so the frame isn't
+	// blocked by the loading.
+	for (int32 QueueIdx = 0; QueueIdx < WarmUpQueue.Num(); QueueIdx++)
+	{
+		const FName Row = WarmUpQueue[QueueIdx];
+		UClass* Class = UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
+			WidgetBlueprintsDataTable.Get(),
+			Row).Get();
+		if (!Class)
+		{
+			// Skipping the row if its loading has failed.
+			if (const TSharedPtr<FStreamableHandle>* Handle = WarmUpHandles.Find(Row);
+				!Handle || !Handle->IsValid() || (*Handle)->HasLoadCompleted() || (*Handle)->WasCanceled())
+			{
+				WarmUpQueue.RemoveAt(QueueIdx);
+				WarmUpHandles.Remove(Row);
+				QueueIdx--;
+			}
+			continue;
+		}
+
+		WarmUpQueue.RemoveAt(QueueIdx);
+		if (PlayerControllerRef.IsValid() && !CachedWidgets.Contains(Row) && !RowsInUse.Contains(Row))
+		{
+			CAT_SCOPE_CYCLE_COUNTER(STAT_Cat_CreateWidget);
+
+			if (UUserWidget* Widget = CreateWidget<UUserWidget>(PlayerControllerRef.Get(), Class);
+				IsValid(Widget))
+			{
+				Widget->SetFlags(RF_StrongRefOnFrame);
+				CachedWidgets.Emplace(Row, Widget);
+			}
+		}
+		break;
+	}
+
+	if (WarmUpQueue.IsEmpty())
+	{
+		if (GetWorld()->GetTimerManager().TimerExists(TH_WarmUpNextWidget))
+		{
+			GetWorld()->GetTimerManager().ClearTimer(TH_WarmUpNextWidget);
+		}
+		// The constructed widgets keep their classes loaded.
+		WarmUpHandles.Empty();
+	}
+}
+
+void ACPP_HUD::PostponeWidgetsWarmUp()
+{
+	if (WarmUpQueue.IsEmpty() || !IsValid(GetWorld()))
+		return;
+
+	// Split-screen HUDs shouldn't construct their widgets
+	// during the same frame.
+	GetWorld()->GetTimerManager().SetTimer(TH_WarmUpNextWidget,
+	                                       this,
+	                                       &ACPP_HUD::WarmUpNextWidget,
+	                                       WidgetsWarmUpInterval,
+	                                       true,
+	                                       WidgetsWarmUpDelay + FMath::FRandRange(0.0f, WidgetsWarmUpInterval));
+}
+
+void ACPP_HUD::ClearWidgetsCache()
+{
+	if (IsValid(GetWorld()) &&
+		GetWorld()->GetTimerManager().TimerExists(TH_WarmUpNextWidget))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(TH_WarmUpNextWidget);
+	}
+
+	for (const TPair<FName, TSharedPtr<FStreamableHandle>>& Handle : WarmUpHandles)
+	{
+		if (Handle.Value.IsValid())
+		{
+			Handle.Value->CancelHandle();
+		}
+	}
+	WarmUpHandles.Empty();
+	WarmUpQueue.Empty();
+	RowsInUse.Empty();
+	CachedWidgets.Empty();
+}
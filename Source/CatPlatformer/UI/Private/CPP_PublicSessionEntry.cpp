@@ -0,0 +1,11 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/CPP_PublicSessionEntry.h"
+
+UCPP_PublicSessionEntry::UCPP_PublicSessionEntry(): SessionNumber(0),
+                                                    SearchResultIndex(INDEX_NONE),
+                                                    PingInMs(0),
+                                                    OpenConnectionsNumber(0),
+                                                    MaxConnectionsNumber(0)
+{
+}
\ No newline at end of file
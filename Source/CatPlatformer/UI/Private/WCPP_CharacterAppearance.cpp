@@ -2,16 +2,28 @@
 
 #include "../Classes/WCPP_CharacterAppearance.h"
 #include "Components/CheckBox.h"
+#include "Components/Image.h"
+#include "Kismet/GameplayStatics.h"
 
 #ifndef CPP_CHARACTER_H
 #define CPP_CHARACTER_H
 #include "CatPlatformer/GameMode/Classes/CPP_Character.h"
 #endif
 
+#ifndef CPP_UI_THREEDIMENSIONALACTOR_H
+#define CPP_UI_THREEDIMENSIONALACTOR_H
+#include "CatPlatformer/GameWorldObjects/Classes/CPP_UI_ThreeDimensionalActor.h"
+#endif
+
 UWCPP_CharacterAppearance::UWCPP_CharacterAppearance(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer), PlayerStateRef(nullptr),
 	  GrayColor_CheckBox(nullptr), OrangeColor_CheckBox(nullptr),
-	  BlackColor_CheckBox(nullptr), CatColorIndex(0)
+	  BlackColor_CheckBox(nullptr), CatColorIndex(0),
+	  PreviewActorClass(FSoftObjectPath(TEXT("/Game/CatPlatformer/UMG/3D_Skins/CharacterAppearance/"
+		  "BP_UI_CharacterAppearance.BP_UI_CharacterAppearance_C"))),
+	  Preview_Image(nullptr),
+	  PreviewActorRef(nullptr),
+	  PreviewImageSize(FVector2D::ZeroVector)
 {
 }
 
@@ -69,10 +81,14 @@ void UWCPP_CharacterAppearance::NativeConstruct()
 	                    .AddDynamic(this, &UWCPP_CharacterAppearance::OrangeColorOnCheckStateChanged);
 	BlackColor_CheckBox->OnCheckStateChanged
 	                   .AddDynamic(this, &UWCPP_CharacterAppearance::BlackColorOnCheckStateChanged);
+
+	StartShowingPreview();
 }
 
 void UWCPP_CharacterAppearance::NativeDestruct()
 {
+	StopShowingPreview();
+
 	if (PlayerStateRef.IsValid())
 	{
 		PlayerStateRef->SaveDataToFile();
@@ -100,6 +116,51 @@ void UWCPP_CharacterAppearance::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+void UWCPP_CharacterAppearance::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (!PreviewActorRef.IsValid() || !IsValid(Preview_Image))
+		return;
+
+	// The absolute size is the size on the screen in pixels
+	// (it's zero until the image is painted for the first
+	// time).
+	if (const FVector2D NewSize = Preview_Image->GetCachedGeometry().GetAbsoluteSize();
+		!NewSize.IsNearlyZero() && !NewSize.Equals(PreviewImageSize, 1.0f))
+	{
+		PreviewImageSize = NewSize;
+		PreviewActorRef->SetDisplayedSize(PreviewImageSize);
+	}
+}
+
+void UWCPP_CharacterAppearance::StartShowingPreview()
+{
+	// The class of the placed actor is already loaded.
+	if (!PreviewActorRef.IsValid())
+	{
+		if (UClass* LoadedClass = PreviewActorClass.Get())
+		{
+			PreviewActorRef = Cast<ACPP_UI_ThreeDimensionalActor>(
+				UGameplayStatics::GetActorOfClass(this, LoadedClass));
+		}
+	}
+
+	if (PreviewActorRef.IsValid())
+	{
+		PreviewActorRef->AddPreviewViewer();
+		PreviewImageSize = FVector2D::ZeroVector;
+	}
+}
+
+void UWCPP_CharacterAppearance::StopShowingPreview()
+{
+	if (PreviewActorRef.IsValid())
+	{
+		PreviewActorRef->RemovePreviewViewer();
+	}
+}
+
 void UWCPP_CharacterAppearance::NewCharacterWasPossessed(ACPP_Character* NewCharacter)
 {
 	if (IsValid(NewCharacter))
@@ -148,7 +209,7 @@ void UWCPP_CharacterAppearance::GrayColorOnCheckStateChanged(const bool bNewStat
 {
 	if (bNewState)
 	{
-		ChangeCatsColor(1);
+		ApplyCatsColor(1);
 		OrangeColor_CheckBox->SetCheckedState(ECheckBoxState::Unchecked);
 		BlackColor_CheckBox->SetCheckedState(ECheckBoxState::Unchecked);
 	}
@@ -162,7 +223,7 @@ void UWCPP_CharacterAppearance::OrangeColorOnCheckStateChanged(const bool bNewSt
 {
 	if (bNewState)
 	{
-		ChangeCatsColor(2);
+		ApplyCatsColor(2);
 		GrayColor_CheckBox->SetCheckedState(ECheckBoxState::Unchecked);
 		BlackColor_CheckBox->SetCheckedState(ECheckBoxState::Unchecked);
 	}
@@ -176,7 +237,7 @@ void UWCPP_CharacterAppearance::BlackColorOnCheckStateChanged(const bool bNewSta
 {
 	if (bNewState)
 	{
-		ChangeCatsColor(0);
+		ApplyCatsColor(0);
 		GrayColor_CheckBox->SetCheckedState(ECheckBoxState::Unchecked);
 		OrangeColor_CheckBox->SetCheckedState(ECheckBoxState::Unchecked);
 	}
@@ -186,6 +247,16 @@ void UWCPP_CharacterAppearance::BlackColorOnCheckStateChanged(const bool bNewSta
 	}
 }
 
+void UWCPP_CharacterAppearance::ApplyCatsColor(const int32 ColorIndex)
+{
+	ChangeCatsColor(ColorIndex);
+
+	if (PreviewActorRef.IsValid())
+	{
+		PreviewActorRef->RequestCapture();
+	}
+}
+
 void UWCPP_CharacterAppearance::ChangeCatsColor_Implementation(const int32 ColorIndex)
 {
 	CatColorIndex = ColorIndex;
@@ -3,6 +3,7 @@
 #include "../Classes/WCPP_ConfigureLevelParams.h"
 #include "Components/CanvasPanel.h"
 #include "Components/CheckBox.h"
+#include "Components/ListView.h"
 #include "Components/ScrollBox.h"
 #include "Components/EditableText.h"
 #include "Components/HorizontalBox.h"
@@ -27,6 +28,17 @@ class UWCPP_PublicSessionInfo;
 #include "CatPlatformer/StaticLibraries/Classes/CPP_StaticWidgetLibrary.h"
 #endif
 
+#ifndef CPP_HUD_H
+#define CPP_HUD_H
+#include "CatPlatformer/UI/Classes/CPP_HUD.h"
+#endif
+class ACPP_HUD;
+
+#ifndef CPP_SYNCLOADDETECTOR_H
+#define CPP_SYNCLOADDETECTOR_H
+#include "CatPlatformer/Debug/Classes/CPP_SyncLoadDetector.h"
+#endif
+
 UWCPP_ConfigureLevelParams::UWCPP_ConfigureLevelParams(const FObjectInitializer& ObjectInitializer) :
 	Super(ObjectInitializer),
 	WidgetBlueprintsDataTable(nullptr),
@@ -34,6 +46,12 @@ UWCPP_ConfigureLevelParams::UWCPP_ConfigureLevelParams(const FObjectInitializer&
 	BottomPanel_WidgetSwitcher(nullptr),
 	OpenPreviousPanelButton(nullptr),
 	LB_Image(nullptr), OpenNextPanelButton(nullptr), RB_Image(nullptr),
+	bLocalPlayersPanelWasInitialized(false),
+	bOnlineMultiplayerPagePanelWasInitialized(false),
+	bPublicSessionsPanelWasInitialized(false),
+	bPrivateSessionPanelWasInitialized(false),
+	bCreateSessionPanelWasInitialized(false),
+	bChooseLevelPanelWasInitialized(false),
 	EnterPlayerName_CanvasPanel(nullptr),
 	InputName_EditableText(nullptr),
 	OnOffVirtualKeyboard_EnterName_HorizontalBox(nullptr),
@@ -63,7 +81,11 @@ UWCPP_ConfigureLevelParams::UWCPP_ConfigureLevelParams(const FObjectInitializer&
 	OpenCreateSessionPanelButton(nullptr),
 	PublicSessions_CanvasPanel(nullptr),
 	FindPublicSessionsButton(nullptr),
+	PublicSessionsListView(nullptr),
 	PublicSessionsScrollBox(nullptr),
+	PublicSessionsFilter_EditableText(nullptr),
+	PublicSessionsSorting_ComboBox(nullptr),
+	HideFullPublicSessions_CheckBox(nullptr),
 	FindSessionsOnLAN_CheckBox(nullptr),
 	FindingSessionsThrobberSizeBox(nullptr),
 	ConnectToPublicSessionButton(nullptr),
@@ -72,6 +94,9 @@ UWCPP_ConfigureLevelParams::UWCPP_ConfigureLevelParams(const FObjectInitializer&
 	CancelFindingPublicSessionsButton(nullptr),
 	X_Key_ConnectToPublicSession_Image(nullptr),
 	SessionNameToJoin_TB(nullptr),
+	NextPublicSessionNumber(1),
+	PublicSessionsSorting(EPublicSessionsSorting::ByNumber),
+	bHideFullPublicSessions(false),
 	ChosenPublicSessionNumber(-1),
 	bIsJoiningToPublicServer(false),
 	PrivateSession_CanvasPanel(nullptr),
@@ -96,6 +121,16 @@ UWCPP_ConfigureLevelParams::UWCPP_ConfigureLevelParams(const FObjectInitializer&
 {
 }
 
+void UWCPP_ConfigureLevelParams::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	if (!PublicSessionsListView)
+	{
+		CreatePublicSessionsListView();
+	}
+}
+
 void UWCPP_ConfigureLevelParams::NativeConstruct()
 {
 	Super::NativeConstruct();
@@ -125,14 +160,6 @@ void UWCPP_ConfigureLevelParams::NativeConstruct()
 		                                             AddUObject(this, &UWCPP_ConfigureLevelParams::AnyKeyPressed);
 		DH_GamepadScroll = PlayerControllerRef->GamepadScrollDelegate.
 		                                        AddUObject(this, &UWCPP_ConfigureLevelParams::GamepadScrollCalled);
-
-		if (PlayerControllerRef->GetMaxOpenedLevelNumber() > 1)
-		{
-			for (int32 i = 2; i <= PlayerControllerRef->GetMaxOpenedLevelNumber(); i++)
-			{
-				ChangeLevelImageToOpened(i);
-			}
-		}
 	}
 
 	DH_ControllerConnectionChanging = IPlatformInputDeviceMapper::Get().GetOnInputDeviceConnectionChange().AddUObject(
@@ -148,10 +175,11 @@ void UWCPP_ConfigureLevelParams::NativeConstruct()
 
 	if (PlayerControllerRef.IsValid() && !PlayerControllerRef->GetCustomUserName().IsEmpty())
 	{
-		PanelsSwitcher->SetActiveWidget(ChoosePlayingMode_CanvasPanel);
+		SetActivePanel(ChoosePlayingMode_CanvasPanel);
 	}
 	else
 	{
+		SetActivePanel(EnterPlayerName_CanvasPanel);
 		if (PlayerControllerRef.IsValid() && PlayerControllerRef->CreateNotificationDelegate.IsBound())
 		{
 			PlayerControllerRef->CreateNotificationDelegate.Execute(EnterNicknameRulesInscription, 5.5f);
@@ -161,6 +189,10 @@ void UWCPP_ConfigureLevelParams::NativeConstruct()
 		UCPP_StaticWidgetLibrary::ChangeImageVisibility(RB_Image, ESlateVisibility::Collapsed);
 	}
 
+	// Only the first two panels are initialized here, the
+	// rest of them are initialized when they are opened for
+	// the first time (see InitializeActivePanel function).
+
 	//=========First panel (EnterPlayerName_CanvasPanel)=========
 
 	InputName_EditableText->OnTextChanged.AddDynamic(
@@ -190,103 +222,6 @@ void UWCPP_ConfigureLevelParams::NativeConstruct()
 		ChangeLocalMultiplayerCheckBoxEnabling(false);
 	}
 
-	//=========Third panel (ChooseLocalPlayers_CanvasPanel)========
-
-	DecrementLocalPlayersNumberButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::DecrementLocalPlayersNumberButtonOnClick);
-	IncrementLocalPlayersNumberButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::IncrementLocalPlayersNumberButtonOnClick);
-	UseKeyboardForFirstPlayer_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::UseKeyboardForFirstPlayerOnCheckStateChanged);
-	SplitType1_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType1_CheckBox_OnStateChanged);
-	SplitType2_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType2_CheckBox_OnStateChanged);
-	SplitType3_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType3_CheckBox_OnStateChanged);
-	SplitType4_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType4_CheckBox_OnStateChanged);
-	SplitType5_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType5_CheckBox_OnStateChanged);
-	SplitType6_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType6_CheckBox_OnStateChanged);
-	SplitType7_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType7_CheckBox_OnStateChanged);
-	SplitType8_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType8_CheckBox_OnStateChanged);
-	SplitType9_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType9_CheckBox_OnStateChanged);
-
-	//===Fourth panel (ChooseOnlineMultiplayerPage_CanvasPanel)====
-
-	OpenPublicSessionsPanelButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::OpenPublicSessionsPanelButtonOnClick);
-	OpenPrivateSessionPanelButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::OpenPrivateSessionPanelButtonOnClick);
-	OpenCreateSessionPanelButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::OpenCreateSessionPanelButtonOnClick);
-
-	//==========Fifth panel (PublicSessions_CanvasPanel)===========
-
-	if (GameInstanceRef.IsValid())
-	{
-		DH_FindingSessionsCompleted = GameInstanceRef->FindingSessionsCompletedDelegate.AddUObject(
-			this, &UWCPP_ConfigureLevelParams::FindingSessionsCompleted);
-
-		GameInstanceRef->JoiningSessionFailedDelegate.BindUObject(
-			this, &UWCPP_ConfigureLevelParams::JoiningToSessionFailed);
-	}
-	FindPublicSessionsButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::FindPublicSessionsButtonOnClick);
-	ConnectToPublicSessionButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::ConnectToPublicSessionButtonOnClick);
-	CancelFindingPublicSessionsButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::CancelFindingPublicSessionsButtonOnClick);
-
-	JoinToPublicSessionHorizontalBox->SetVisibility(ESlateVisibility::Collapsed);
-	UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(CancelFindingPublicSessionsButton, false);
-	UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(CancelFindingPublicSessionsButton,
-	                                                  ESlateVisibility::Collapsed);
-
-	//==========Sixth panel (PrivateSession_CanvasPanel)===========
-
-	if (GameInstanceRef.IsValid())
-	{
-		GameInstanceRef->FindingPrivateSessionFailedDelegate.BindUObject(
-			this, &UWCPP_ConfigureLevelParams::OnFindingPrivateSessionFailed);
-	}
-	ConnectToPrivateSessionButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::ConnectToPrivateSessionButtonOnClick);
-	CancelFindingPrivateSessionButton->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::CancelFindingPrivateSessionButtonOnClick);
-	JoinToPrivateSessionHorizontalBox->SetVisibility(ESlateVisibility::Collapsed);
-	InputCode_EditableText->OnTextCommitted.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::InputCodeCommitted);
-	OnOffVirtualKeyboard_PrivateSession_TB->SetText(OnVirtualKeyboardInscription);
-
-	//=========Seventh panel (CreateSession_CanvasPanel)===========
-
-	if (GameInstanceRef.IsValid())
-	{
-		GameInstanceRef->SessionCreationFailedDelegate.BindUObject(
-			this, &UWCPP_ConfigureLevelParams::SessionCreationFailed);
-	}
-
-	//============Eighth panel (ChooseLevel_CanvasPanel)===========
-
-	StartLevel1_Button->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel1_ButtonOnClick);
-	StartLevel2_Button->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel2_ButtonOnClick);
-	StartLevel3_Button->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel3_ButtonOnClick);
-	StartLevel4_Button->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel4_ButtonOnClick);
-	StartLevel5_Button->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel5_ButtonOnClick);
-	StartRandomLevel_Button->OnClicked.AddDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartRandomLevel_ButtonOnClick);
-
 	//====================Gamepad Mode=============================
 
 	if (bIsGamepadMode)
@@ -333,48 +268,81 @@ void UWCPP_ConfigureLevelParams::NativeDestruct()
 
 	//=========Third panel (ChooseLocalPlayers_CanvasPanel)========
 
-	DecrementLocalPlayersNumberButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::DecrementLocalPlayersNumberButtonOnClick);
-	IncrementLocalPlayersNumberButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::IncrementLocalPlayersNumberButtonOnClick);
-	UseKeyboardForFirstPlayer_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::UseKeyboardForFirstPlayerOnCheckStateChanged);
-	SplitType1_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType1_CheckBox_OnStateChanged);
-	SplitType2_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType2_CheckBox_OnStateChanged);
-	SplitType3_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType3_CheckBox_OnStateChanged);
-	SplitType4_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType4_CheckBox_OnStateChanged);
-	SplitType5_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType5_CheckBox_OnStateChanged);
-	SplitType6_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType6_CheckBox_OnStateChanged);
-	SplitType7_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType7_CheckBox_OnStateChanged);
-	SplitType8_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType8_CheckBox_OnStateChanged);
-	SplitType9_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::SplitType9_CheckBox_OnStateChanged);
+	if (bLocalPlayersPanelWasInitialized)
+	{
+		DecrementLocalPlayersNumberButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::DecrementLocalPlayersNumberButtonOnClick);
+		IncrementLocalPlayersNumberButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::IncrementLocalPlayersNumberButtonOnClick);
+		UseKeyboardForFirstPlayer_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::UseKeyboardForFirstPlayerOnCheckStateChanged);
+		SplitType1_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::SplitType1_CheckBox_OnStateChanged);
+		SplitType2_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::SplitType2_CheckBox_OnStateChanged);
+		SplitType3_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::SplitType3_CheckBox_OnStateChanged);
+		SplitType4_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::SplitType4_CheckBox_OnStateChanged);
+		SplitType5_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::SplitType5_CheckBox_OnStateChanged);
+		SplitType6_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::SplitType6_CheckBox_OnStateChanged);
+		SplitType7_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::SplitType7_CheckBox_OnStateChanged);
+		SplitType8_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::SplitType8_CheckBox_OnStateChanged);
+		SplitType9_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::SplitType9_CheckBox_OnStateChanged);
+		bLocalPlayersPanelWasInitialized = false;
+	}
 
 	//===Fourth panel (ChooseOnlineMultiplayerPage_CanvasPanel)====
 
-	OpenPublicSessionsPanelButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::OpenPublicSessionsPanelButtonOnClick);
-	OpenPrivateSessionPanelButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::OpenPrivateSessionPanelButtonOnClick);
-	OpenCreateSessionPanelButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::OpenCreateSessionPanelButtonOnClick);
+	if (bOnlineMultiplayerPagePanelWasInitialized)
+	{
+		OpenPublicSessionsPanelButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::OpenPublicSessionsPanelButtonOnClick);
+		OpenPrivateSessionPanelButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::OpenPrivateSessionPanelButtonOnClick);
+		OpenCreateSessionPanelButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::OpenCreateSessionPanelButtonOnClick);
+		bOnlineMultiplayerPagePanelWasInitialized = false;
+	}
 
 	//==========Fifth panel (PublicSessions_CanvasPanel)===========
 
-	FindPublicSessionsButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::FindPublicSessionsButtonOnClick);
-	ConnectToPublicSessionButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::ConnectToPublicSessionButtonOnClick);
-	CancelFindingPublicSessionsButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::CancelFindingPublicSessionsButtonOnClick);
+	if (bPublicSessionsPanelWasInitialized)
+	{
+		FindPublicSessionsButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::FindPublicSessionsButtonOnClick);
+		ConnectToPublicSessionButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::ConnectToPublicSessionButtonOnClick);
+		CancelFindingPublicSessionsButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::CancelFindingPublicSessionsButtonOnClick);
+
+		if (PublicSessionsListView)
+		{
+			PublicSessionsListView->OnEntryWidgetGenerated().RemoveAll(this);
+		}
+		if (PublicSessionsFilter_EditableText)
+		{
+			PublicSessionsFilter_EditableText->OnTextChanged.RemoveDynamic(
+				this, &UWCPP_ConfigureLevelParams::PublicSessionsFilterChanged);
+		}
+		if (PublicSessionsSorting_ComboBox)
+		{
+			PublicSessionsSorting_ComboBox->OnSelectionChanged.RemoveDynamic(
+				this, &UWCPP_ConfigureLevelParams::PublicSessionsSortingChanged);
+		}
+		if (HideFullPublicSessions_CheckBox)
+		{
+			HideFullPublicSessions_CheckBox->OnCheckStateChanged.RemoveDynamic(
+				this, &UWCPP_ConfigureLevelParams::HideFullPublicSessionsChanged);
+		}
+		ClearPublicSessionsList();
+		bPublicSessionsPanelWasInitialized = false;
+	}
 
 	if (GetWorld()->GetTimerManager().TimerExists(TH_ClearFindingPublicSessionUnusedWidgets))
 	{
@@ -387,12 +355,16 @@ void UWCPP_ConfigureLevelParams::NativeDestruct()
 
 	//==========Sixth panel (PrivateSession_CanvasPanel)===========
 
-	ConnectToPrivateSessionButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::ConnectToPrivateSessionButtonOnClick);
-	CancelFindingPrivateSessionButton->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::CancelFindingPrivateSessionButtonOnClick);
-	InputCode_EditableText->OnTextCommitted.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::InputCodeCommitted);
+	if (bPrivateSessionPanelWasInitialized)
+	{
+		ConnectToPrivateSessionButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::ConnectToPrivateSessionButtonOnClick);
+		CancelFindingPrivateSessionButton->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::CancelFindingPrivateSessionButtonOnClick);
+		InputCode_EditableText->OnTextCommitted.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::InputCodeCommitted);
+		bPrivateSessionPanelWasInitialized = false;
+	}
 
 	if (GetWorld()->GetTimerManager().TimerExists(TH_FindingAndJoiningToPrivateSessionUnusedWidgets))
 	{
@@ -401,18 +373,22 @@ void UWCPP_ConfigureLevelParams::NativeDestruct()
 
 	//============Eighth panel (ChooseLevel_CanvasPanel)===========
 
-	StartLevel1_Button->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel1_ButtonOnClick);
-	StartLevel2_Button->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel2_ButtonOnClick);
-	StartLevel3_Button->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel3_ButtonOnClick);
-	StartLevel4_Button->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel4_ButtonOnClick);
-	StartLevel5_Button->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartLevel5_ButtonOnClick);
-	StartRandomLevel_Button->OnClicked.RemoveDynamic(
-		this, &UWCPP_ConfigureLevelParams::StartRandomLevel_ButtonOnClick);
+	if (bChooseLevelPanelWasInitialized)
+	{
+		StartLevel1_Button->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::StartLevel1_ButtonOnClick);
+		StartLevel2_Button->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::StartLevel2_ButtonOnClick);
+		StartLevel3_Button->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::StartLevel3_ButtonOnClick);
+		StartLevel4_Button->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::StartLevel4_ButtonOnClick);
+		StartLevel5_Button->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::StartLevel5_ButtonOnClick);
+		StartRandomLevel_Button->OnClicked.RemoveDynamic(
+			this, &UWCPP_ConfigureLevelParams::StartRandomLevel_ButtonOnClick);
+		bChooseLevelPanelWasInitialized = false;
+	}
 
 	if (GameInstanceRef.IsValid())
 	{
@@ -423,6 +399,7 @@ void UWCPP_ConfigureLevelParams::NativeDestruct()
 		GameInstanceRef->FindingPrivateSessionFailedDelegate.Unbind();
 		GameInstanceRef = nullptr;
 	}
+	bCreateSessionPanelWasInitialized = false;
 
 	Super::NativeDestruct();
 }
@@ -445,25 +422,25 @@ void UWCPP_ConfigureLevelParams::RightArrowOnClick()
 			PlayerControllerRef->SetCustomUserName(Name);
 			PlayerControllerRef->CallCollectingInfoForSavingItToFile();
 		}
-		PanelsSwitcher->SetActiveWidget(ChoosePlayingMode_CanvasPanel);
+		SetActivePanel(ChoosePlayingMode_CanvasPanel);
 		DestroyVirtualKeyboard();
 	}
 	else if (PanelsSwitcher->GetActiveWidget() == ChoosePlayingMode_CanvasPanel)
 	{
 		if (CurrentPlayingMode == EPlayingMode::SinglePlayer)
 		{
-			PanelsSwitcher->SetActiveWidget(ChooseLevel_CanvasPanel);
+			SetActivePanel(ChooseLevel_CanvasPanel);
 			UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenNextPanelButton, ESlateVisibility::Collapsed);
 			UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenNextPanelButton, false);
 			UCPP_StaticWidgetLibrary::ChangeImageVisibility(RB_Image, ESlateVisibility::Collapsed);
 		}
 		else if (CurrentPlayingMode == EPlayingMode::LocalMultiplayer)
 		{
-			PanelsSwitcher->SetActiveWidget(ChooseLocalPlayers_CanvasPanel);
+			SetActivePanel(ChooseLocalPlayers_CanvasPanel);
 		}
 		else
 		{
-			PanelsSwitcher->SetActiveWidget(ChooseOnlineMultiplayerPage_CanvasPanel);
+			SetActivePanel(ChooseOnlineMultiplayerPage_CanvasPanel);
 			UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenNextPanelButton, ESlateVisibility::Collapsed);
 			UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenNextPanelButton, false);
 			UCPP_StaticWidgetLibrary::ChangeImageVisibility(RB_Image, ESlateVisibility::Collapsed);
@@ -475,14 +452,14 @@ void UWCPP_ConfigureLevelParams::RightArrowOnClick()
 	}
 	else if (PanelsSwitcher->GetActiveWidget() == ChooseLocalPlayers_CanvasPanel)
 	{
-		PanelsSwitcher->SetActiveWidget(ChooseLevel_CanvasPanel);
+		SetActivePanel(ChooseLevel_CanvasPanel);
 		UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenNextPanelButton, ESlateVisibility::Collapsed);
 		UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenNextPanelButton, false);
 		UCPP_StaticWidgetLibrary::ChangeImageVisibility(RB_Image, ESlateVisibility::Collapsed);
 	}
 	else if (PanelsSwitcher->GetActiveWidget() == CreateSession_CanvasPanel)
 	{
-		PanelsSwitcher->SetActiveWidget(ChooseLevel_CanvasPanel);
+		SetActivePanel(ChooseLevel_CanvasPanel);
 		UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenNextPanelButton, ESlateVisibility::Collapsed);
 		UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenNextPanelButton, false);
 		UCPP_StaticWidgetLibrary::ChangeImageVisibility(RB_Image, ESlateVisibility::Collapsed);
@@ -499,7 +476,7 @@ void UWCPP_ConfigureLevelParams::LeftArrowOnClick()
 	if (PanelsSwitcher->GetActiveWidget() == ChooseLocalPlayers_CanvasPanel ||
 		PanelsSwitcher->GetActiveWidget() == ChooseOnlineMultiplayerPage_CanvasPanel)
 	{
-		PanelsSwitcher->SetActiveWidget(ChoosePlayingMode_CanvasPanel);
+		SetActivePanel(ChoosePlayingMode_CanvasPanel);
 
 		UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenPreviousPanelButton, ESlateVisibility::Collapsed);
 		UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenPreviousPanelButton, false);
@@ -512,7 +489,7 @@ void UWCPP_ConfigureLevelParams::LeftArrowOnClick()
 	else if (PanelsSwitcher->GetActiveWidget() == PublicSessions_CanvasPanel ||
 		PanelsSwitcher->GetActiveWidget() == CreateSession_CanvasPanel)
 	{
-		PanelsSwitcher->SetActiveWidget(ChooseOnlineMultiplayerPage_CanvasPanel);
+		SetActivePanel(ChooseOnlineMultiplayerPage_CanvasPanel);
 
 		UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenNextPanelButton, ESlateVisibility::Collapsed);
 		UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenNextPanelButton, false);
@@ -520,7 +497,7 @@ void UWCPP_ConfigureLevelParams::LeftArrowOnClick()
 	}
 	else if (PanelsSwitcher->GetActiveWidget() == PrivateSession_CanvasPanel)
 	{
-		PanelsSwitcher->SetActiveWidget(ChooseOnlineMultiplayerPage_CanvasPanel);
+		SetActivePanel(ChooseOnlineMultiplayerPage_CanvasPanel);
 
 		UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenNextPanelButton, ESlateVisibility::Collapsed);
 		UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenNextPanelButton, false);
@@ -532,7 +509,7 @@ void UWCPP_ConfigureLevelParams::LeftArrowOnClick()
 	{
 		if (CurrentPlayingMode == EPlayingMode::SinglePlayer)
 		{
-			PanelsSwitcher->SetActiveWidget(ChoosePlayingMode_CanvasPanel);
+			SetActivePanel(ChoosePlayingMode_CanvasPanel);
 
 			UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenPreviousPanelButton, ESlateVisibility::Collapsed);
 			UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenPreviousPanelButton, false);
@@ -540,11 +517,11 @@ void UWCPP_ConfigureLevelParams::LeftArrowOnClick()
 		}
 		else if (CurrentPlayingMode == EPlayingMode::LocalMultiplayer)
 		{
-			PanelsSwitcher->SetActiveWidget(ChooseLocalPlayers_CanvasPanel);
+			SetActivePanel(ChooseLocalPlayers_CanvasPanel);
 		}
 		else
 		{
-			PanelsSwitcher->SetActiveWidget(CreateSession_CanvasPanel);
+			SetActivePanel(CreateSession_CanvasPanel);
 		}
 		UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenNextPanelButton, ESlateVisibility::Visible);
 		UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenNextPanelButton, true);
@@ -557,6 +534,189 @@ void UWCPP_ConfigureLevelParams::LeftArrowOnClick()
 	}
 }
 
+void UWCPP_ConfigureLevelParams::SetActivePanel(UWidget* Panel)
+{
+	PanelsSwitcher->SetActiveWidget(Panel);
+	InitializeActivePanel();
+}
+
+void UWCPP_ConfigureLevelParams::InitializeActivePanel()
+{
+	const UWidget* ActivePanel = PanelsSwitcher->GetActiveWidget();
+
+	if (ActivePanel == ChooseLocalPlayers_CanvasPanel && !bLocalPlayersPanelWasInitialized)
+	{
+		InitializeLocalPlayersPanel();
+	}
+	else if (ActivePanel == ChooseOnlineMultiplayerPage_CanvasPanel && !bOnlineMultiplayerPagePanelWasInitialized)
+	{
+		InitializeOnlineMultiplayerPagePanel();
+	}
+	else if (ActivePanel == PublicSessions_CanvasPanel && !bPublicSessionsPanelWasInitialized)
+	{
+		InitializePublicSessionsPanel();
+	}
+	else if (ActivePanel == PrivateSession_CanvasPanel && !bPrivateSessionPanelWasInitialized)
+	{
+		InitializePrivateSessionPanel();
+	}
+	else if (ActivePanel == CreateSession_CanvasPanel && !bCreateSessionPanelWasInitialized)
+	{
+		InitializeCreateSessionPanel();
+	}
+	else if (ActivePanel == ChooseLevel_CanvasPanel && !bChooseLevelPanelWasInitialized)
+	{
+		InitializeChooseLevelPanel();
+	}
+}
+
+void UWCPP_ConfigureLevelParams::InitializeLocalPlayersPanel()
+{
+	bLocalPlayersPanelWasInitialized = true;
+
+	DecrementLocalPlayersNumberButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::DecrementLocalPlayersNumberButtonOnClick);
+	IncrementLocalPlayersNumberButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::IncrementLocalPlayersNumberButtonOnClick);
+	UseKeyboardForFirstPlayer_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::UseKeyboardForFirstPlayerOnCheckStateChanged);
+	SplitType1_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::SplitType1_CheckBox_OnStateChanged);
+	SplitType2_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::SplitType2_CheckBox_OnStateChanged);
+	SplitType3_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::SplitType3_CheckBox_OnStateChanged);
+	SplitType4_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::SplitType4_CheckBox_OnStateChanged);
+	SplitType5_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::SplitType5_CheckBox_OnStateChanged);
+	SplitType6_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::SplitType6_CheckBox_OnStateChanged);
+	SplitType7_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::SplitType7_CheckBox_OnStateChanged);
+	SplitType8_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::SplitType8_CheckBox_OnStateChanged);
+	SplitType9_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::SplitType9_CheckBox_OnStateChanged);
+}
+
+void UWCPP_ConfigureLevelParams::InitializeOnlineMultiplayerPagePanel()
+{
+	bOnlineMultiplayerPagePanelWasInitialized = true;
+
+	OpenPublicSessionsPanelButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::OpenPublicSessionsPanelButtonOnClick);
+	OpenPrivateSessionPanelButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::OpenPrivateSessionPanelButtonOnClick);
+	OpenCreateSessionPanelButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::OpenCreateSessionPanelButtonOnClick);
+}
+
+void UWCPP_ConfigureLevelParams::InitializePublicSessionsPanel()
+{
+	bPublicSessionsPanelWasInitialized = true;
+
+	if (GameInstanceRef.IsValid())
+	{
+		DH_FindingSessionsCompleted = GameInstanceRef->FindingSessionsCompletedDelegate.AddUObject(
+			this, &UWCPP_ConfigureLevelParams::FindingSessionsCompleted);
+
+		GameInstanceRef->JoiningSessionFailedDelegate.BindUObject(
+			this, &UWCPP_ConfigureLevelParams::JoiningToSessionFailed);
+	}
+	FindPublicSessionsButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::FindPublicSessionsButtonOnClick);
+	ConnectToPublicSessionButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::ConnectToPublicSessionButtonOnClick);
+	CancelFindingPublicSessionsButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::CancelFindingPublicSessionsButtonOnClick);
+
+	if (PublicSessionsListView)
+	{
+		PublicSessionsListView->OnEntryWidgetGenerated().AddUObject(
+			this, &UWCPP_ConfigureLevelParams::PublicSessionEntryWidgetGenerated);
+	}
+	if (PublicSessionsFilter_EditableText)
+	{
+		PublicSessionsFilter_EditableText->OnTextChanged.AddDynamic(
+			this, &UWCPP_ConfigureLevelParams::PublicSessionsFilterChanged);
+	}
+	if (PublicSessionsSorting_ComboBox)
+	{
+		PublicSessionsSorting_ComboBox->OnSelectionChanged.AddDynamic(
+			this, &UWCPP_ConfigureLevelParams::PublicSessionsSortingChanged);
+	}
+	if (HideFullPublicSessions_CheckBox)
+	{
+		HideFullPublicSessions_CheckBox->OnCheckStateChanged.AddDynamic(
+			this, &UWCPP_ConfigureLevelParams::HideFullPublicSessionsChanged);
+	}
+
+	JoinToPublicSessionHorizontalBox->SetVisibility(ESlateVisibility::Collapsed);
+	UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(CancelFindingPublicSessionsButton, false);
+	UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(CancelFindingPublicSessionsButton,
+	                                                  ESlateVisibility::Collapsed);
+}
+
+void UWCPP_ConfigureLevelParams::InitializePrivateSessionPanel()
+{
+	bPrivateSessionPanelWasInitialized = true;
+
+	if (GameInstanceRef.IsValid())
+	{
+		GameInstanceRef->FindingPrivateSessionFailedDelegate.BindUObject(
+			this, &UWCPP_ConfigureLevelParams::OnFindingPrivateSessionFailed);
+
+		GameInstanceRef->JoiningSessionFailedDelegate.BindUObject(
+			this, &UWCPP_ConfigureLevelParams::JoiningToSessionFailed);
+	}
+	ConnectToPrivateSessionButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::ConnectToPrivateSessionButtonOnClick);
+	CancelFindingPrivateSessionButton->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::CancelFindingPrivateSessionButtonOnClick);
+	JoinToPrivateSessionHorizontalBox->SetVisibility(ESlateVisibility::Collapsed);
+	InputCode_EditableText->OnTextCommitted.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::InputCodeCommitted);
+	OnOffVirtualKeyboard_PrivateSession_TB->SetText(OnVirtualKeyboardInscription);
+}
+
+void UWCPP_ConfigureLevelParams::InitializeCreateSessionPanel()
+{
+	bCreateSessionPanelWasInitialized = true;
+
+	if (GameInstanceRef.IsValid())
+	{
+		GameInstanceRef->SessionCreationFailedDelegate.BindUObject(
+			this, &UWCPP_ConfigureLevelParams::SessionCreationFailed);
+	}
+}
+
+void UWCPP_ConfigureLevelParams::InitializeChooseLevelPanel()
+{
+	bChooseLevelPanelWasInitialized = true;
+
+	if (PlayerControllerRef.IsValid() && PlayerControllerRef->GetMaxOpenedLevelNumber() > 1)
+	{
+		for (int32 i = 2; i <= PlayerControllerRef->GetMaxOpenedLevelNumber(); i++)
+		{
+			ChangeLevelImageToOpened(i);
+		}
+	}
+
+	StartLevel1_Button->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::StartLevel1_ButtonOnClick);
+	StartLevel2_Button->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::StartLevel2_ButtonOnClick);
+	StartLevel3_Button->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::StartLevel3_ButtonOnClick);
+	StartLevel4_Button->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::StartLevel4_ButtonOnClick);
+	StartLevel5_Button->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::StartLevel5_ButtonOnClick);
+	StartRandomLevel_Button->OnClicked.AddDynamic(
+		this, &UWCPP_ConfigureLevelParams::StartRandomLevel_ButtonOnClick);
+}
+
 void UWCPP_ConfigureLevelParams::InitVirtualKeyboard()
 {
 	if (PanelsSwitcher->GetActiveWidget() != EnterPlayerName_CanvasPanel &&
@@ -567,34 +727,27 @@ void UWCPP_ConfigureLevelParams::InitVirtualKeyboard()
 		PlayerControllerRef.IsValid() &&
 		GameInstanceRef.IsValid())
 	{
-		const FName Row = FName(TEXT("VirtualKeyboard"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (ACPP_HUD* HUD = PlayerControllerRef->GetHUD<ACPP_HUD>();
+			IsValid(HUD))
 		{
-			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-					WidgetBlueprintsDataTable.Get(),
-					Row)))
+			VirtualKeyboardRef = Cast<UWCPP_VirtualKeyboard>(HUD->AcquireWidget(FName(TEXT("VirtualKeyboard"))));
+			if (IsValid(VirtualKeyboardRef))
 			{
-				VirtualKeyboardRef = CreateWidget<UWCPP_VirtualKeyboard>(PlayerControllerRef.Get(), Class);
-				if (IsValid(VirtualKeyboardRef))
-				{
-					OnOffVirtualKeyboard_EnterName_TB->SetText(OffVirtualKeyboardInscription);
-					OnOffVirtualKeyboard_PrivateSession_TB->SetText(OffVirtualKeyboardInscription);
-
-					VirtualKeyboardRef->SetFlags(RF_StrongRefOnFrame);
-					VirtualKeyboardRef->SetGameInstanceRef(GameInstanceRef.Get());
-					VirtualKeyboardRef->SetPlayerControllerRef(PlayerControllerRef.Get());
-					DH_TypeSymbol = VirtualKeyboardRef->TypeSymbolDelegate.AddUObject(
-						this, &UWCPP_ConfigureLevelParams::SymbolWasTypedByVirtualKeyboard);
-					DH_RemoveSymbol = VirtualKeyboardRef->RemoveSymbolDelegate.AddUObject(
-						this, &UWCPP_ConfigureLevelParams::SymbolWasRemovedByVirtualKeyboard);
-					DH_EnterWasPressed = VirtualKeyboardRef->EnterWasPressedDelegate.AddUObject(
-						this, &UWCPP_ConfigureLevelParams::EnterWasPressedByVirtualKeyboard);
-					DH_ClosingKeyboard = VirtualKeyboardRef->ClosingKeyboardDelegate.AddUObject(
-						this, &UWCPP_ConfigureLevelParams::DestroyVirtualKeyboard);
-					VirtualKeyboardSizeBox->AddChild(VirtualKeyboardRef);
-					VirtualKeyboardRef->Btn_Digit_1->SetKeyboardFocus();
-				}
+				OnOffVirtualKeyboard_EnterName_TB->SetText(OffVirtualKeyboardInscription);
+				OnOffVirtualKeyboard_PrivateSession_TB->SetText(OffVirtualKeyboardInscription);
+
+				VirtualKeyboardRef->SetGameInstanceRef(GameInstanceRef.Get());
+				VirtualKeyboardRef->SetPlayerControllerRef(PlayerControllerRef.Get());
+				DH_TypeSymbol = VirtualKeyboardRef->TypeSymbolDelegate.AddUObject(
+					this, &UWCPP_ConfigureLevelParams::SymbolWasTypedByVirtualKeyboard);
+				DH_RemoveSymbol = VirtualKeyboardRef->RemoveSymbolDelegate.AddUObject(
+					this, &UWCPP_ConfigureLevelParams::SymbolWasRemovedByVirtualKeyboard);
+				DH_EnterWasPressed = VirtualKeyboardRef->EnterWasPressedDelegate.AddUObject(
+					this, &UWCPP_ConfigureLevelParams::EnterWasPressedByVirtualKeyboard);
+				DH_ClosingKeyboard = VirtualKeyboardRef->ClosingKeyboardDelegate.AddUObject(
+					this, &UWCPP_ConfigureLevelParams::DestroyVirtualKeyboard);
+				VirtualKeyboardSizeBox->AddChild(VirtualKeyboardRef);
+				VirtualKeyboardRef->SetFocusOnFirstKey();
 			}
 		}
 	}
@@ -615,7 +768,15 @@ void UWCPP_ConfigureLevelParams::DestroyVirtualKeyboard()
 		DH_EnterWasPressed.Reset();
 		VirtualKeyboardRef->ClosingKeyboardDelegate.Remove(DH_ClosingKeyboard);
 		DH_ClosingKeyboard.Reset();
-		VirtualKeyboardRef->RemoveFromParent();
+		if (ACPP_HUD* HUD = PlayerControllerRef.IsValid() ? PlayerControllerRef->GetHUD<ACPP_HUD>() : nullptr;
+			IsValid(HUD))
+		{
+			HUD->ReleaseWidget(FName(TEXT("VirtualKeyboard")), VirtualKeyboardRef);
+		}
+		else
+		{
+			VirtualKeyboardRef->RemoveFromParent();
+		}
 		VirtualKeyboardRef = nullptr;
 
 		SetFocusForGamepadMode();
@@ -830,7 +991,7 @@ void UWCPP_ConfigureLevelParams::DecrementLocalPlayersNumberButtonOnClick()
 		{
 			PlayerControllerRef->CreateNotificationDelegate.Execute(AllGamepadsWereDisconnectedInscription, 3.5f);
 		}
-		PanelsSwitcher->SetActiveWidget(ChoosePlayingMode_CanvasPanel);
+		SetActivePanel(ChoosePlayingMode_CanvasPanel);
 		return;
 	}
 
@@ -869,7 +1030,7 @@ void UWCPP_ConfigureLevelParams::IncrementLocalPlayersNumberButtonOnClick()
 		{
 			PlayerControllerRef->CreateNotificationDelegate.Execute(AllGamepadsWereDisconnectedInscription, 3.5f);
 		}
-		PanelsSwitcher->SetActiveWidget(ChoosePlayingMode_CanvasPanel);
+		SetActivePanel(ChoosePlayingMode_CanvasPanel);
 		return;
 	}
 
@@ -1097,7 +1258,7 @@ void UWCPP_ConfigureLevelParams::OpenPublicSessionsPanelButtonOnClick()
 {
 	CurrentPlayingMode = EPlayingMode::OnlineMultiplayerClientInPublicSession;
 
-	PanelsSwitcher->SetActiveWidget(PublicSessions_CanvasPanel);
+	SetActivePanel(PublicSessions_CanvasPanel);
 
 	if (bIsGamepadMode)
 	{
@@ -1109,7 +1270,7 @@ void UWCPP_ConfigureLevelParams::OpenPrivateSessionPanelButtonOnClick()
 {
 	CurrentPlayingMode = EPlayingMode::OnlineMultiplayerClientInPrivateSession;
 
-	PanelsSwitcher->SetActiveWidget(PrivateSession_CanvasPanel);
+	SetActivePanel(PrivateSession_CanvasPanel);
 
 	if (bIsGamepadMode)
 	{
@@ -1132,7 +1293,7 @@ void UWCPP_ConfigureLevelParams::OpenCreateSessionPanelButtonOnClick()
 		{
 			CurrentPlayingMode = EPlayingMode::OnlineMultiplayerServer;
 
-			PanelsSwitcher->SetActiveWidget(CreateSession_CanvasPanel);
+			SetActivePanel(CreateSession_CanvasPanel);
 			UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenNextPanelButton, ESlateVisibility::Visible);
 			UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenNextPanelButton, true);
 			UCPP_StaticWidgetLibrary::ChangeImageVisibility(RB_Image, ESlateVisibility::SelfHitTestInvisible);
@@ -1198,7 +1359,7 @@ void UWCPP_ConfigureLevelParams::CancelFindingPublicSessionsButtonOnClick()
 	{
 		GameInstanceRef->CancelFindingSessionsDelegate.Execute();
 	}
-	PublicSessionsScrollBox->ClearChildren();
+	ClearPublicSessionsList();
 
 	if (bIsGamepadMode && CancelFindingPublicSessionsButton->HasAnyUserFocus())
 	{
@@ -1229,8 +1390,17 @@ void UWCPP_ConfigureLevelParams::CancelFindingPublicSessionsButtonOnClick()
 	}
 }
 
-void UWCPP_ConfigureLevelParams::FindingSessionsCompleted(const TSharedPtr<FOnlineSessionSearch>& FoundSessions)
+void UWCPP_ConfigureLevelParams::FindingSessionsCompleted(const TSharedPtr<FOnlineSessionSearch>& FoundSessions,
+                                                          bool bIsCachedResult)
 {
+	if (bIsCachedResult)
+	{
+		// The search is still in progress, so the throbber
+		// and the cancel button are kept.
+		MergePublicSessions(FoundSessions);
+		return;
+	}
+
 	if (bIsGamepadMode && CancelFindingPublicSessionsButton->HasAnyUserFocus())
 	{
 		if (PlayerControllerRef.IsValid())
@@ -1242,59 +1412,18 @@ void UWCPP_ConfigureLevelParams::FindingSessionsCompleted(const TSharedPtr<FOnli
 			FindPublicSessionsButton->SetKeyboardFocus();
 		}
 	}
-	PublicSessionsScrollBox->ClearChildren();
 
-	if (FoundSessions == nullptr)
+	if (!FoundSessions.IsValid() || FoundSessions->SearchResults.Num() <= 0)
 	{
+		ClearPublicSessionsList();
 		if (PlayerControllerRef.IsValid() && PlayerControllerRef->CreateNotificationDelegate.IsBound())
 		{
 			PlayerControllerRef->CreateNotificationDelegate.Execute(NoPublicSessionsFoundInscription, 3.5f);
 		}
 	}
-	else if (FoundSessions.IsValid() &&
-		PlayerControllerRef.IsValid() &&
-		GameInstanceRef.IsValid())
+	else
 	{
-		if (FoundSessions->SearchResults.Num() <= 0)
-		{
-			if (PlayerControllerRef.IsValid() && PlayerControllerRef->CreateNotificationDelegate.IsBound())
-			{
-				PlayerControllerRef->CreateNotificationDelegate.Execute(NoPublicSessionsFoundInscription, 3.5f);
-			}
-		}
-		else
-		{
-			const FName Row = FName(TEXT("PublicSessionInfo"));
-			if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
-			{
-				if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-					UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-						WidgetBlueprintsDataTable.Get(),
-						Row)))
-				{
-					for (int32 SearchIdx = 0; SearchIdx < FoundSessions->SearchResults.Num(); SearchIdx++)
-					{
-						if (UWCPP_PublicSessionInfo* PublicSessionInfo_Widget = CreateWidget<UWCPP_PublicSessionInfo>(
-								PlayerControllerRef.Get(), Class);
-							IsValid(PublicSessionInfo_Widget))
-						{
-							PublicSessionInfo_Widget->SetFlags(RF_StrongRefOnFrame);
-							PublicSessionInfo_Widget->SessionName = FName(
-								FoundSessions->SearchResults[SearchIdx].Session.SessionSettings.
-								                                        Settings.FindRef(
-									                                        FName("SESSION_NAME")).Data.ToString());
-							PublicSessionInfo_Widget->SessionNumber = SearchIdx + 1;
-							PublicSessionInfo_Widget->UserId = FoundSessions->SearchResults[SearchIdx].Session.
-								OwningUserId;
-							PublicSessionInfo_Widget->SearchResult = FoundSessions->SearchResults[SearchIdx];
-							PublicSessionInfo_Widget->PassSessionInfoDelegate.BindUObject(
-								this, &UWCPP_ConfigureLevelParams::GetOneSessionInfo);
-							PublicSessionsScrollBox->AddChild(PublicSessionInfo_Widget);
-						}
-					}
-				}
-			}
-		}
+		MergePublicSessions(FoundSessions);
 	}
 	if (GetWorld()->GetTimerManager().TimerExists(TH_ClearFindingPublicSessionUnusedWidgets))
 	{
@@ -1308,6 +1437,55 @@ void UWCPP_ConfigureLevelParams::FindingSessionsCompleted(const TSharedPtr<FOnli
 	                                       false);
 }
 
+void UWCPP_ConfigureLevelParams::MergePublicSessions(const TSharedPtr<FOnlineSessionSearch>& FoundSessions)
+{
+	if (!FoundSessions.IsValid())
+		return;
+
+	TMap<FString, UCPP_PublicSessionEntry*> PreviousEntries;
+	PreviousEntries.Reserve(PublicSessionEntries.Num());
+	for (UCPP_PublicSessionEntry* SessionEntry : PublicSessionEntries)
+	{
+		if (IsValid(SessionEntry))
+		{
+			PreviousEntries.Emplace(SessionEntry->SessionId, SessionEntry);
+		}
+	}
+
+	// Only the lightweight data objects are created here,
+	// the list view creates widgets for visible rows only.
+	LastFoundPublicSessions = FoundSessions;
+	PublicSessionEntries.Reset(FoundSessions->SearchResults.Num());
+	for (int32 SearchIdx = 0; SearchIdx < FoundSessions->SearchResults.Num(); SearchIdx++)
+	{
+		const FOnlineSessionSearchResult& SearchResult = FoundSessions->SearchResults[SearchIdx];
+		const FString SessionId = SearchResult.GetSessionIdStr();
+
+		UCPP_PublicSessionEntry* SessionEntry = nullptr;
+		if (UCPP_PublicSessionEntry** PreviousEntry = PreviousEntries.Find(SessionId))
+		{
+			SessionEntry = *PreviousEntry;
+		}
+		else
+		{
+			SessionEntry = NewObject<UCPP_PublicSessionEntry>(this);
+			if (!IsValid(SessionEntry))
+				continue;
+
+			SessionEntry->SessionNumber = NextPublicSessionNumber++;
+			SessionEntry->SessionId = SessionId;
+			SessionEntry->SessionName = FName(
+				SearchResult.Session.SessionSettings.Settings.FindRef(FName("SESSION_NAME")).Data.ToString());
+		}
+		SessionEntry->SearchResultIndex = SearchIdx;
+		SessionEntry->PingInMs = SearchResult.PingInMs;
+		SessionEntry->OpenConnectionsNumber = SearchResult.Session.NumOpenPublicConnections;
+		SessionEntry->MaxConnectionsNumber = SearchResult.Session.SessionSettings.NumPublicConnections;
+		PublicSessionEntries.Emplace(SessionEntry);
+	}
+	RefreshPublicSessionsList();
+}
+
 void UWCPP_ConfigureLevelParams::ClearFindingPublicSessionUnusedWidgets()
 {
 	if (IsValid(GetWorld()) && GetWorld()->GetTimerManager()
@@ -1326,14 +1504,17 @@ void UWCPP_ConfigureLevelParams::ClearFindingPublicSessionUnusedWidgets()
 	UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(FindPublicSessionsButton, true);
 }
 
-void UWCPP_ConfigureLevelParams::GetOneSessionInfo(const int32 SessionNumber,
-                                                   const FUniqueNetIdRepl& UserId,
-                                                   const FName& SessionName,
-                                                   const FOnlineSessionSearchResult& SearchResult)
+void UWCPP_ConfigureLevelParams::GetOneSessionInfo(const UCPP_PublicSessionEntry* SessionEntry)
 {
-	ChosenPublicSessionNumber = SessionNumber;
-	ChosenPublicSessionUserId = UserId;
-	ChosenPublicSessionName = SessionName;
+	if (!IsValid(SessionEntry) || !LastFoundPublicSessions.IsValid() ||
+		!LastFoundPublicSessions->SearchResults.IsValidIndex(SessionEntry->SearchResultIndex))
+		return;
+
+	const FOnlineSessionSearchResult& SearchResult =
+		LastFoundPublicSessions->SearchResults[SessionEntry->SearchResultIndex];
+	ChosenPublicSessionNumber = SessionEntry->SessionNumber;
+	ChosenPublicSessionUserId = SearchResult.Session.OwningUserId;
+	ChosenPublicSessionName = SessionEntry->SessionName;
 	ChosenPublicSessionSearchResult = SearchResult;
 	FString NameToPrint = ChosenPublicSessionName.ToString();
 	if (const int32 StrLen = NameToPrint.Len();
@@ -1347,6 +1528,155 @@ void UWCPP_ConfigureLevelParams::GetOneSessionInfo(const int32 SessionNumber,
 		                                  *NameToPrint)));
 }
 
+void UWCPP_ConfigureLevelParams::PublicSessionEntryWidgetGenerated(UUserWidget& EntryWidget)
+{
+	if (UWCPP_PublicSessionInfo* PublicSessionInfo_Widget = Cast<UWCPP_PublicSessionInfo>(&EntryWidget))
+	{
+		PublicSessionInfo_Widget->PassSessionInfoDelegate.BindUObject(
+			this, &UWCPP_ConfigureLevelParams::GetOneSessionInfo);
+	}
+}
+
+void UWCPP_ConfigureLevelParams::ClearPublicSessionsList()
+{
+	if (PublicSessionsListView)
+	{
+		PublicSessionsListView->ClearListItems();
+	}
+	PublicSessionEntries.Empty();
+	NextPublicSessionNumber = 1;
+	LastFoundPublicSessions.Reset();
+}
+
+void UWCPP_ConfigureLevelParams::RefreshPublicSessionsList()
+{
+	TArray<UCPP_PublicSessionEntry*> VisibleEntries;
+	VisibleEntries.Reserve(PublicSessionEntries.Num());
+	for (UCPP_PublicSessionEntry* SessionEntry : PublicSessionEntries)
+	{
+		if (!IsValid(SessionEntry) ||
+			(bHideFullPublicSessions && SessionEntry->OpenConnectionsNumber <= 0) ||
+			(!PublicSessionsFilter.IsEmpty() &&
+				!SessionEntry->SessionName.ToString().Contains(PublicSessionsFilter)))
+			continue;
+
+		VisibleEntries.Emplace(SessionEntry);
+	}
+
+	switch (PublicSessionsSorting)
+	{
+	case EPublicSessionsSorting::ByNumber:
+		VisibleEntries.Sort([](const UCPP_PublicSessionEntry& A, const UCPP_PublicSessionEntry& B)
+		{
+			return A.SessionNumber < B.SessionNumber;
+		});
+		break;
+	case EPublicSessionsSorting::ByName:
+		VisibleEntries.Sort([](const UCPP_PublicSessionEntry& A, const UCPP_PublicSessionEntry& B)
+		{
+			return A.SessionName.LexicalLess(B.SessionName);
+		});
+		break;
+	case EPublicSessionsSorting::ByPing:
+		VisibleEntries.Sort([](const UCPP_PublicSessionEntry& A, const UCPP_PublicSessionEntry& B)
+		{
+			return A.PingInMs < B.PingInMs;
+		});
+		break;
+	case EPublicSessionsSorting::ByFreePlaces:
+		VisibleEntries.Sort([](const UCPP_PublicSessionEntry& A, const UCPP_PublicSessionEntry& B)
+		{
+			return A.OpenConnectionsNumber > B.OpenConnectionsNumber;
+		});
+		break;
+	}
+
+	if (PublicSessionsListView)
+	{
+		PublicSessionsListView->SetListItems(VisibleEntries);
+	}
+}
+
+void UWCPP_ConfigureLevelParams::CreatePublicSessionsListView()
+{
+	if (!PublicSessionsScrollBox || !WidgetTree)
+		return;
+
+	UPanelWidget* Parent = PublicSessionsScrollBox->GetParent();
+	if (!IsValid(Parent))
+		return;
+
+	UCPP_GameInstance* GameInstance = GetGameInstance<UCPP_GameInstance>();
+	if (!IsValid(GameInstance) || !IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
+		return;
+
+	UClass* EntryClass = GameInstance->GetWidgetClassBySoftReference(
+		UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
+			WidgetBlueprintsDataTable.Get(),
+			FName(TEXT("PublicSessionInfo"))));
+	if (!EntryClass)
+		return;
+
+	UListView* ListView = WidgetTree->ConstructWidget<UListView>(
+		UListView::StaticClass(), TEXT("PublicSessionsListView"));
+
+	// The entry class has no setter and is only meant to be set
+	// in the designer, so it is assigned through reflection. It
+	// must be set before the Slate widget is built.
+	if (FClassProperty* EntryClassProperty = FindFProperty<FClassProperty>(
+		UListViewBase::StaticClass(), TEXT("EntryWidgetClass")))
+	{
+		EntryClassProperty->SetObjectPropertyValue_InContainer(ListView, EntryClass);
+	}
+	ListView->SetSelectionMode(ESelectionMode::None);
+
+	Parent->ReplaceChildAt(Parent->GetChildIndex(PublicSessionsScrollBox), ListView);
+	PublicSessionsScrollBox = nullptr;
+	PublicSessionsListView = ListView;
+}
+
+void UWCPP_ConfigureLevelParams::SetPublicSessionsSorting(const EPublicSessionsSorting NewSorting)
+{
+	if (PublicSessionsSorting == NewSorting)
+		return;
+
+	PublicSessionsSorting = NewSorting;
+	RefreshPublicSessionsList();
+}
+
+void UWCPP_ConfigureLevelParams::SetPublicSessionsFilter(const FString& NewFilter, const bool bHideFullSessions)
+{
+	const FString TrimmedFilter = NewFilter.TrimStartAndEnd();
+	if (PublicSessionsFilter == TrimmedFilter && bHideFullPublicSessions == bHideFullSessions)
+		return;
+
+	PublicSessionsFilter = TrimmedFilter;
+	bHideFullPublicSessions = bHideFullSessions;
+	RefreshPublicSessionsList();
+}
+
+void UWCPP_ConfigureLevelParams::PublicSessionsFilterChanged(const FText& NewText)
+{
+	SetPublicSessionsFilter(NewText.ToString(), bHideFullPublicSessions);
+}
+
+void UWCPP_ConfigureLevelParams::PublicSessionsSortingChanged(FString SelectedItem,
+                                                              ESelectInfo::Type SelectionType)
+{
+	if (PublicSessionsSorting_ComboBox)
+	{
+		SetPublicSessionsSorting(static_cast<EPublicSessionsSorting>(
+			FMath::Clamp(PublicSessionsSorting_ComboBox->GetSelectedIndex(),
+			             0,
+			             static_cast<int32>(EPublicSessionsSorting::ByFreePlaces))));
+	}
+}
+
+void UWCPP_ConfigureLevelParams::HideFullPublicSessionsChanged(bool bIsChecked)
+{
+	SetPublicSessionsFilter(PublicSessionsFilter, bIsChecked);
+}
+
 void UWCPP_ConfigureLevelParams::ConnectToPublicSessionButtonOnClick()
 {
 	if (ChosenPublicSessionNumber == -1)
@@ -1710,7 +2040,7 @@ void UWCPP_ConfigureLevelParams::OnControllerConnectionChanged(EInputDeviceConne
 			(PanelsSwitcher->GetActiveWidget() == ChooseLocalPlayers_CanvasPanel ||
 				PanelsSwitcher->GetActiveWidget() == ChooseLevel_CanvasPanel))
 		{
-			PanelsSwitcher->SetActiveWidget(ChoosePlayingMode_CanvasPanel);
+			SetActivePanel(ChoosePlayingMode_CanvasPanel);
 			UCPP_StaticWidgetLibrary::ChangeButtonsVisibility(OpenPreviousPanelButton,
 			                                                  ESlateVisibility::Collapsed);
 			UCPP_StaticWidgetLibrary::ChangeButtonsEnabling(OpenPreviousPanelButton, false);
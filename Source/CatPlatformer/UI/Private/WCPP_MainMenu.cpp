@@ -14,6 +14,17 @@
 #include "CatPlatformer/StaticLibraries/Classes/CPP_StaticWidgetLibrary.h"
 #endif
 
+#ifndef CPP_HUD_H
+#define CPP_HUD_H
+#include "CatPlatformer/UI/Classes/CPP_HUD.h"
+#endif
+class ACPP_HUD;
+
+#ifndef CPP_SYNCLOADDETECTOR_H
+#define CPP_SYNCLOADDETECTOR_H
+#include "CatPlatformer/Debug/Classes/CPP_SyncLoadDetector.h"
+#endif
+
 UWCPP_MainMenu::UWCPP_MainMenu(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer),
                                                                               WidgetBlueprintsDataTable(nullptr),
                                                                               LoginToEOS_HorizontalBox(nullptr),
@@ -58,6 +69,9 @@ void UWCPP_MainMenu::NativeConstruct()
 	}
 
 	ChangeGoBackButtonVisibility(false);
+	// The widget can be reused from the HUD's cache, so it
+	// should always be opened on the main panel.
+	PanelsWidgetSwitcher->SetActiveWidgetIndex(0);
 
 	LoginToEOS_Button->OnClicked.AddDynamic(this, &UWCPP_MainMenu::LoginToEOS_Button_OnClick);
 	OpenConfigureLevelParamsButton->OnClicked.AddDynamic(this, &UWCPP_MainMenu::SwitchToConfigureLevelParamsPanel);
@@ -217,23 +231,15 @@ void UWCPP_MainMenu::InitConfigureLevelParamsWidget()
 		PlayerControllerRef.IsValid() &&
 		GameInstanceRef.IsValid())
 	{
-		const FName Row = FName(TEXT("LevelParams"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (ACPP_HUD* HUD = PlayerControllerRef->GetHUD<ACPP_HUD>();
+			IsValid(HUD))
 		{
-			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-					WidgetBlueprintsDataTable.Get(),
-					Row)))
+			ConfigureLevelParams_Widget = Cast<UWCPP_WidgetParent>(HUD->AcquireWidget(FName(TEXT("LevelParams"))));
+			if (ConfigureLevelParams_Widget.IsValid())
 			{
-				ConfigureLevelParams_Widget = CreateWidget<UWCPP_WidgetParent>(PlayerControllerRef.Get(),
-				                                                               Class);
-				if (ConfigureLevelParams_Widget.IsValid())
-				{
-					ConfigureLevelParams_Widget->SetFlags(RF_StrongRefOnFrame);
-					ConfigureLevelParams_Widget->SetGameInstanceRef(GameInstanceRef.Get());
-					ConfigureLevelParams_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
-					ConfigureLevelParamsSizeBox->AddChild(ConfigureLevelParams_Widget.Get());
-				}
+				ConfigureLevelParams_Widget->SetGameInstanceRef(GameInstanceRef.Get());
+				ConfigureLevelParams_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
+				ConfigureLevelParamsSizeBox->AddChild(ConfigureLevelParams_Widget.Get());
 			}
 		}
 	}
@@ -243,7 +249,15 @@ void UWCPP_MainMenu::DestroyConfigureLevelParamsWidget()
 {
 	if (ConfigureLevelParams_Widget.IsValid())
 	{
-		ConfigureLevelParams_Widget->RemoveFromParent();
+		if (ACPP_HUD* HUD = PlayerControllerRef.IsValid() ? PlayerControllerRef->GetHUD<ACPP_HUD>() : nullptr;
+			IsValid(HUD))
+		{
+			HUD->ReleaseWidget(FName(TEXT("LevelParams")), ConfigureLevelParams_Widget.Get());
+		}
+		else
+		{
+			ConfigureLevelParams_Widget->RemoveFromParent();
+		}
 		ConfigureLevelParams_Widget = nullptr;
 	}
 }
@@ -273,7 +287,7 @@ void UWCPP_MainMenu::InitRulesWidget()
 		GameInstanceRef.IsValid())
 	{
 		const FName Row = FName(TEXT("Rules"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
 		{
 			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
 				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
@@ -327,7 +341,7 @@ void UWCPP_MainMenu::InitCharacterAppearanceWidget()
 		GameInstanceRef.IsValid())
 	{
 		const FName Row = FName(TEXT("CharacterAppearance"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
 		{
 			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
 				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
@@ -380,23 +394,16 @@ void UWCPP_MainMenu::InitSettingsWidget()
 		PlayerControllerRef.IsValid() &&
 		GameInstanceRef.IsValid())
 	{
-		const FName Row = FName(TEXT("Settings"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (ACPP_HUD* HUD = PlayerControllerRef->GetHUD<ACPP_HUD>();
+			IsValid(HUD))
 		{
-			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-					WidgetBlueprintsDataTable.Get(),
-					Row)))
+			Settings_Widget = Cast<UWCPP_Settings>(HUD->AcquireWidget(FName(TEXT("Settings"))));
+			if (Settings_Widget.IsValid())
 			{
-				Settings_Widget = CreateWidget<UWCPP_Settings>(PlayerControllerRef.Get(), Class);
-				if (Settings_Widget.IsValid())
-				{
-					Settings_Widget->SetFlags(RF_StrongRefOnFrame);
-					Settings_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
-					Settings_Widget->SetGameInstanceRef(GameInstanceRef.Get());
-					Settings_Widget->bIsMainMenu = true;
-					SettingsSizeBox->AddChild(Settings_Widget.Get());
-				}
+				Settings_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
+				Settings_Widget->SetGameInstanceRef(GameInstanceRef.Get());
+				Settings_Widget->bIsMainMenu = true;
+				SettingsSizeBox->AddChild(Settings_Widget.Get());
 			}
 		}
 	}
@@ -406,7 +413,15 @@ void UWCPP_MainMenu::DestroySettingsWidget()
 {
 	if (Settings_Widget.IsValid())
 	{
-		Settings_Widget->RemoveFromParent();
+		if (ACPP_HUD* HUD = PlayerControllerRef.IsValid() ? PlayerControllerRef->GetHUD<ACPP_HUD>() : nullptr;
+			IsValid(HUD))
+		{
+			HUD->ReleaseWidget(FName(TEXT("Settings")), Settings_Widget.Get());
+		}
+		else
+		{
+			Settings_Widget->RemoveFromParent();
+		}
 		Settings_Widget = nullptr;
 	}
 }
@@ -435,22 +450,15 @@ void UWCPP_MainMenu::InitStatisticsWidget()
 		PlayerControllerRef.IsValid() &&
 		GameInstanceRef.IsValid())
 	{
-		const FName Row = FName(TEXT("Statistics"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (ACPP_HUD* HUD = PlayerControllerRef->GetHUD<ACPP_HUD>();
+			IsValid(HUD))
 		{
-			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-					WidgetBlueprintsDataTable.Get(),
-					Row)))
+			Statistics_Widget = Cast<UWCPP_WidgetParent>(HUD->AcquireWidget(FName(TEXT("Statistics"))));
+			if (Statistics_Widget.IsValid())
 			{
-				Statistics_Widget = CreateWidget<UWCPP_WidgetParent>(PlayerControllerRef.Get(), Class);
-				if (Statistics_Widget.IsValid())
-				{
-					Statistics_Widget->SetFlags(RF_StrongRefOnFrame);
-					Statistics_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
-					Statistics_Widget->SetGameInstanceRef(GameInstanceRef.Get());
-					StatisticsSizeBox->AddChild(Statistics_Widget.Get());
-				}
+				Statistics_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
+				Statistics_Widget->SetGameInstanceRef(GameInstanceRef.Get());
+				StatisticsSizeBox->AddChild(Statistics_Widget.Get());
 			}
 		}
 	}
@@ -460,7 +468,15 @@ void UWCPP_MainMenu::DestroyStatisticsWidget()
 {
 	if (Statistics_Widget.IsValid())
 	{
-		Statistics_Widget->RemoveFromParent();
+		if (ACPP_HUD* HUD = PlayerControllerRef.IsValid() ? PlayerControllerRef->GetHUD<ACPP_HUD>() : nullptr;
+			IsValid(HUD))
+		{
+			HUD->ReleaseWidget(FName(TEXT("Statistics")), Statistics_Widget.Get());
+		}
+		else
+		{
+			Statistics_Widget->RemoveFromParent();
+		}
 		Statistics_Widget = nullptr;
 	}
 }
@@ -490,7 +506,7 @@ void UWCPP_MainMenu::InitInfoWidget()
 		GameInstanceRef.IsValid())
 	{
 		const FName Row = FName(TEXT("GameInfo"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (IsValid(CAT_LOAD_SYNCHRONOUS(WidgetBlueprintsDataTable)))
 		{
 			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
 				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
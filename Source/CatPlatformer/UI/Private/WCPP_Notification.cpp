@@ -17,6 +17,11 @@ void UWCPP_Notification::NativeConstruct()
 
 	CloseNotificationButton->OnClicked.AddDynamic(this, &UWCPP_Notification::CloseNotificationButtonOnClick);
 
+	// Restoring the state after the previous closing
+	// animation (the widget could be taken from the pool).
+	StopAllAnimations();
+	SetRenderOpacity(1.0f);
+
 	GetWorld()->GetTimerManager().SetTimer(TH_CloseNotification,
 	                                       this,
 	                                       &UWCPP_Notification::StartSelfDestroying,
@@ -34,6 +39,8 @@ void UWCPP_Notification::NativeDestruct()
 	CloseNotificationButton->OnClicked.RemoveDynamic(this, &UWCPP_Notification::CloseNotificationButtonOnClick);
 
 	Super::NativeDestruct();
+
+	NotificationWasClosedDelegate.Broadcast(this);
 }
 
 void UWCPP_Notification::SetClosingTime(const float NewValue)
@@ -46,6 +53,25 @@ void UWCPP_Notification::SetNewNotificationText(const FText& NotificationText) c
 	TB_Notification->SetText(NotificationText);
 }
 
+FText UWCPP_Notification::GetNotificationText() const
+{
+	return TB_Notification->GetText();
+}
+
+bool UWCPP_Notification::ProlongDisplaying(const float TimeToDisplay)
+{
+	if (!GetWorld()->GetTimerManager().TimerExists(TH_CloseNotification))
+		return false;
+
+	ClosingTime = TimeToDisplay;
+	GetWorld()->GetTimerManager().SetTimer(TH_CloseNotification,
+	                                       this,
+	                                       &UWCPP_Notification::StartSelfDestroying,
+	                                       ClosingTime,
+	                                       false);
+	return true;
+}
+
 void UWCPP_Notification::CloseNotificationButtonOnClick()
 {
 	RemoveFromParent();
@@ -12,6 +12,12 @@
 #include "CatPlatformer/StaticLibraries/Classes/CPP_StaticWidgetLibrary.h"
 #endif
 
+#ifndef CPP_HUD_H
+#define CPP_HUD_H
+#include "CatPlatformer/UI/Classes/CPP_HUD.h"
+#endif
+class ACPP_HUD;
+
 UWCPP_Pause::UWCPP_Pause(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer),
                                                                         WidgetBlueprintsDataTable(nullptr),
                                                                         Settings_Widget(nullptr),
@@ -38,6 +44,9 @@ void UWCPP_Pause::NativeConstruct()
 	}
 
 	ChangeGoBackButtonVisibility(false);
+	// The widget can be reused from the HUD's cache, so it
+	// should always be opened on the main panel.
+	PanelsWidgetSwitcher->SetActiveWidgetIndex(0);
 	BackToGameButton->OnClicked.AddDynamic(this, &UWCPP_Pause::BackToGameButtonOnClick);
 	SettingsButton->OnClicked.AddDynamic(this, &UWCPP_Pause::SwitchToSettingsPanel);
 	GoToMainMenuButton->OnClicked.AddDynamic(this, &UWCPP_Pause::GoToMainMenuButtonOnClick);
@@ -133,23 +142,16 @@ void UWCPP_Pause::InitSettingsWidget()
 		PlayerControllerRef.IsValid() &&
 		GameInstanceRef.IsValid())
 	{
-		const FName Row = FName(TEXT("Settings"));
-		if (IsValid(WidgetBlueprintsDataTable.LoadSynchronous()))
+		if (ACPP_HUD* HUD = PlayerControllerRef->GetHUD<ACPP_HUD>();
+			IsValid(HUD))
 		{
-			if (UClass* Class = GameInstanceRef->GetWidgetClassBySoftReference(
-				UCPP_StaticWidgetLibrary::GetSoftReferenceToWidgetBlueprintByRowName(
-					WidgetBlueprintsDataTable.Get(),
-					Row)))
+			Settings_Widget = Cast<UWCPP_Settings>(HUD->AcquireWidget(FName(TEXT("Settings"))));
+			if (Settings_Widget.IsValid())
 			{
-				Settings_Widget = CreateWidget<UWCPP_Settings>(PlayerControllerRef.Get(), Class);
-				if (Settings_Widget.IsValid())
-				{
-					Settings_Widget->SetFlags(RF_StrongRefOnFrame);
-					Settings_Widget->bIsMainMenu = false;
-					Settings_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
-					Settings_Widget->SetGameInstanceRef(GameInstanceRef.Get());
-					SettingsSizeBox->AddChild(Settings_Widget.Get());
-				}
+				Settings_Widget->bIsMainMenu = false;
+				Settings_Widget->SetPlayerControllerRef(PlayerControllerRef.Get());
+				Settings_Widget->SetGameInstanceRef(GameInstanceRef.Get());
+				SettingsSizeBox->AddChild(Settings_Widget.Get());
 			}
 		}
 	}
@@ -159,7 +161,15 @@ void UWCPP_Pause::DestroySettingsWidget()
 {
 	if (Settings_Widget.IsValid())
 	{
-		Settings_Widget->RemoveFromParent();
+		if (ACPP_HUD* HUD = PlayerControllerRef.IsValid() ? PlayerControllerRef->GetHUD<ACPP_HUD>() : nullptr;
+			IsValid(HUD))
+		{
+			HUD->ReleaseWidget(FName(TEXT("Settings")), Settings_Widget.Get());
+		}
+		else
+		{
+			Settings_Widget->RemoveFromParent();
+		}
 		Settings_Widget = nullptr;
 	}
 }
@@ -5,7 +5,7 @@
 #include "Components/Button.h"
 
 UWCPP_PublicSessionInfo::UWCPP_PublicSessionInfo(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer), SessionNumber(0),
+	: Super(ObjectInitializer), SessionEntry(nullptr),
 	  SessionButton(nullptr), TB_SessionNumber(nullptr),
 	  TB_SessionName(nullptr)
 {
@@ -15,10 +15,7 @@ void UWCPP_PublicSessionInfo::NativeConstruct()
 {
 	Super::NativeConstruct();
 
-	TB_SessionNumber->SetText(FText::FromString(FString::FromInt(SessionNumber)));
-	TB_SessionName->SetText(FText::FromName(SessionName));
-
-	SessionButton->OnClicked.AddDynamic(this, &UWCPP_PublicSessionInfo::SessionButtonOnClick);
+	SessionButton->OnClicked.AddUniqueDynamic(this, &UWCPP_PublicSessionInfo::SessionButtonOnClick);
 }
 
 void UWCPP_PublicSessionInfo::NativeDestruct()
@@ -28,10 +25,27 @@ void UWCPP_PublicSessionInfo::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+void UWCPP_PublicSessionInfo::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+
+	SetSessionEntry(Cast<UCPP_PublicSessionEntry>(ListItemObject));
+}
+
+void UWCPP_PublicSessionInfo::SetSessionEntry(UCPP_PublicSessionEntry* NewSessionEntry)
+{
+	SessionEntry = NewSessionEntry;
+	if (!SessionEntry.IsValid())
+		return;
+
+	TB_SessionNumber->SetText(FText::AsNumber(SessionEntry->SessionNumber));
+	TB_SessionName->SetText(FText::FromName(SessionEntry->SessionName));
+}
+
 void UWCPP_PublicSessionInfo::SessionButtonOnClick()
 {
-	if (PassSessionInfoDelegate.IsBound())
+	if (SessionEntry.IsValid() && PassSessionInfoDelegate.IsBound())
 	{
-		PassSessionInfoDelegate.Execute(SessionNumber, UserId, SessionName, SearchResult);
+		PassSessionInfoDelegate.Execute(SessionEntry.Get());
 	}
 }
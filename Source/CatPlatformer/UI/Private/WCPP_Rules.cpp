@@ -4,12 +4,18 @@
 #include "Components/ScrollBox.h"
 #include "Components/WidgetSwitcher.h"
 #include "Components/Button.h"
+#include "EngineUtils.h"
 
 #ifndef CPP_STATICWIDGETLIBRARY_H
 #define CPP_STATICWIDGETLIBRARY_H
 #include "CatPlatformer/StaticLibraries/Classes/CPP_StaticWidgetLibrary.h"
 #endif
 
+#ifndef CPP_UI_THREEDIMENSIONALACTOR_H
+#define CPP_UI_THREEDIMENSIONALACTOR_H
+#include "CatPlatformer/GameWorldObjects/Classes/CPP_UI_ThreeDimensionalActor.h"
+#endif
+
 UWCPP_Rules::UWCPP_Rules(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer),
                                                                         BottomPanel_WidgetSwitcher(nullptr),
                                                                         OpenPreviousPanelButton(nullptr),
@@ -25,6 +31,31 @@ UWCPP_Rules::UWCPP_Rules(const FObjectInitializer& ObjectInitializer) : Super(Ob
                                                                         InfoScrollBox_6(nullptr),
                                                                         InfoScrollBox_7(nullptr)
 {
+	// The actors that are placed on the main menu level for
+	// the rules' images.
+	static const TCHAR* DefaultPreviewActorsClasses[] = {
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/BuffDoubleJump/BP_UI_DoubleJumpBuff.BP_UI_DoubleJumpBuff_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/BuffFast/BP_UI_FastBuff.BP_UI_FastBuff_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/BuffHighJump/BP_UI_HighJumpBuff.BP_UI_HighJumpBuff_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/BuffShield/BP_UI_ShieldBuff.BP_UI_ShieldBuff_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/BuffSlow/BP_UI_SlowBuff.BP_UI_SlowBuff_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/Crow/BP_UI_Crow.BP_UI_Crow_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/Fish/BP_UI_Fish.BP_UI_Fish_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/PlatformFalling/BP_UI_FallingPlatform.BP_UI_FallingPlatform_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/PlatformFinal/BP_UI_FinalPlatform.BP_UI_FinalPlatform_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/PlatformRotating/BP_UI_RotatingPlatform_X.BP_UI_RotatingPlatform_X_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/PlatformRotating/BP_UI_RotatingPlatform_Y.BP_UI_RotatingPlatform_Y_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/PlatformRotating/BP_UI_RotatingPlatform_Z.BP_UI_RotatingPlatform_Z_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/PlatformSlippery/BP_UI_SlipperyPlatform.BP_UI_SlipperyPlatform_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/PlatformSlippery/BP_UI_SlipperyPlatform1.BP_UI_SlipperyPlatform1_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/PlatformVerticalMovement/BP_UI_VerticalMovingPlatform."
+			"BP_UI_VerticalMovingPlatform_C"),
+		TEXT("/Game/CatPlatformer/UMG/3D_Skins/PlatformWithNPC/BP_UI_PlatformWithNPC.BP_UI_PlatformWithNPC_C")
+	};
+	for (const TCHAR* ClassPath : DefaultPreviewActorsClasses)
+	{
+		PreviewActorsClasses.Emplace(FSoftObjectPath(ClassPath));
+	}
 }
 
 void UWCPP_Rules::NativeConstruct()
@@ -59,10 +90,14 @@ void UWCPP_Rules::NativeConstruct()
 
 	OpenPreviousPanelButton->OnClicked.AddDynamic(this, &UWCPP_Rules::LeftArrowOnClick);
 	OpenNextPanelButton->OnClicked.AddDynamic(this, &UWCPP_Rules::RightArrowOnClick);
+
+	StartShowingPreviews();
 }
 
 void UWCPP_Rules::NativeDestruct()
 {
+	StopShowingPreviews();
+
 	//===================Bottom Panel==============================
 
 	OpenPreviousPanelButton->OnClicked.RemoveDynamic(this, &UWCPP_Rules::LeftArrowOnClick);
@@ -71,6 +106,46 @@ void UWCPP_Rules::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+void UWCPP_Rules::StartShowingPreviews()
+{
+	// Classes of the placed actors are already loaded.
+	TArray<UClass*> LoadedClasses;
+	for (const TSoftClassPtr<ACPP_UI_ThreeDimensionalActor>& PreviewClass : PreviewActorsClasses)
+	{
+		if (UClass* LoadedClass = PreviewClass.Get())
+		{
+			LoadedClasses.Emplace(LoadedClass);
+		}
+	}
+	if (LoadedClasses.IsEmpty())
+		return;
+
+	for (TActorIterator<ACPP_UI_ThreeDimensionalActor> It(GetWorld()); It; ++It)
+	{
+		for (const UClass* PreviewClass : LoadedClasses)
+		{
+			if (It->IsA(PreviewClass))
+			{
+				It->AddPreviewViewer();
+				PreviewActors.Emplace(*It);
+				break;
+			}
+		}
+	}
+}
+
+void UWCPP_Rules::StopShowingPreviews()
+{
+	for (const TWeakObjectPtr<ACPP_UI_ThreeDimensionalActor>& PreviewActor : PreviewActors)
+	{
+		if (PreviewActor.IsValid())
+		{
+			PreviewActor->RemovePreviewViewer();
+		}
+	}
+	PreviewActors.Empty();
+}
+
 void UWCPP_Rules::RightArrowOnClick()
 {
 	if (const int32 CurrentIndex = PanelsSwitcher->GetActiveWidgetIndex();
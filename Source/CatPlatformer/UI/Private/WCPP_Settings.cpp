@@ -19,6 +19,11 @@
 #include "CatPlatformer/StaticLibraries/Classes/CPP_StaticWidgetLibrary.h"
 #endif
 
+#ifndef CPP_SYNCLOADDETECTOR_H
+#define CPP_SYNCLOADDETECTOR_H
+#include "CatPlatformer/Debug/Classes/CPP_SyncLoadDetector.h"
+#endif
+
 UWCPP_Settings::UWCPP_Settings(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer),
                                                                               PanelsSwitcher(nullptr),
                                                                               PanelsNumber(0),
@@ -30,6 +35,9 @@ UWCPP_Settings::UWCPP_Settings(const FObjectInitializer& ObjectInitializer) : Su
                                                                               BottomPanel_WidgetSwitcher(nullptr),
                                                                               OpenPreviousPanelButton(nullptr),
                                                                               OpenNextPanelButton(nullptr),
+                                                                              bVolumesWereInitialized(false),
+                                                                              bTracksWereInitialized(false),
+                                                                              bVideoQualityWasInitialized(false),
                                                                               SFX_Volume_Slider(nullptr),
                                                                               Music_Volume_Slider(nullptr),
                                                                               MM_RepeatingMode(),
@@ -119,71 +127,15 @@ void UWCPP_Settings::NativeConstruct()
 		DH_GamepadHorizontalScroll = PlayerControllerRef->GamepadHorizontalScrollDelegate.AddUObject(
 			this, &UWCPP_Settings::GamepadHorizontalScrollCalled);
 
+		// The second sound manager is spawned only when the
+		// track lists become visible (see InitializeTracks).
 		if (bIsMainMenu)
 		{
 			SoundManagerMainMenuRef = Cast<ACPP_SoundManagerMainMenu>(PlayerControllerRef->GetSoundManagerRef());
-			InitializeMainMenuTracksPanel();
-
-			if (IsValid(SoundManagersDataTable.LoadSynchronous()))
-			{
-				if (UClass* SoundManagerClass = GameInstanceRef->GetActorClassBySoftReference(
-					UCPP_StaticWidgetLibrary::GetSoftReferenceToSoundManagerByRowName(
-						SoundManagersDataTable.Get(),
-						FName(TEXT("LevelSoundManager")))))
-				{
-					ACPP_SoundManagerLevel* TmpSoundManager = GetWorld()->SpawnActorDeferred<ACPP_SoundManagerLevel>(
-						SoundManagerClass,
-						FTransform::Identity,
-						nullptr,
-						nullptr,
-						ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
-
-					if (IsValid(TmpSoundManager))
-					{
-						TmpSoundManager->SetPlayerControllerRef(PlayerControllerRef.Get());
-						TmpSoundManager->ApplySettingsFromTheSaveFile(
-							PlayerStateRef.IsValid()
-								? !PlayerStateRef->GetSaveFileWasCreated()
-								: true, true);
-						SoundManagerLevelRef = TmpSoundManager;
-						UGameplayStatics::FinishSpawningActor(TmpSoundManager, FTransform());
-						InitializeLevelTracksPanel();
-					}
-				}
-			}
 		}
 		else
 		{
 			SoundManagerLevelRef = Cast<ACPP_SoundManagerLevel>(PlayerControllerRef->GetSoundManagerRef());
-			InitializeLevelTracksPanel();
-
-			if (IsValid(SoundManagersDataTable.LoadSynchronous()))
-			{
-				if (UClass* SoundManagerClass = GameInstanceRef->GetActorClassBySoftReference(
-					UCPP_StaticWidgetLibrary::GetSoftReferenceToSoundManagerByRowName(
-						SoundManagersDataTable.Get(),
-						FName(TEXT("MainMenuSoundManager")))))
-				{
-					ACPP_SoundManagerMainMenu* TmpSoundManager = GetWorld()->SpawnActorDeferred<ACPP_SoundManagerMainMenu>(
-						SoundManagerClass,
-						FTransform::Identity,
-						nullptr,
-						nullptr,
-						ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
-
-					if (IsValid(TmpSoundManager))
-					{
-						TmpSoundManager->SetPlayerControllerRef(PlayerControllerRef.Get());
-						TmpSoundManager->ApplySettingsFromTheSaveFile(
-							PlayerStateRef.IsValid()
-								? !PlayerStateRef->GetSaveFileWasCreated()
-								: true, true);
-						SoundManagerMainMenuRef = TmpSoundManager;
-						UGameplayStatics::FinishSpawningActor(TmpSoundManager, FTransform());
-						InitializeMainMenuTracksPanel();
-					}
-				}
-			}
 		}
 	}
 
@@ -191,80 +143,21 @@ void UWCPP_Settings::NativeConstruct()
 
 	PanelsNumber = PanelsSwitcher->GetNumWidgets();
 
+	// The rest of the panels are initialized only when
+	// they are opened for the first time.
+	InitializeActivePanel();
+
 	//===================Bottom Panel==============================
 
 	OpenPreviousPanelButton->OnClicked.AddDynamic(this, &UWCPP_Settings::LeftArrowOnClick);
 	OpenNextPanelButton->OnClicked.AddDynamic(this, &UWCPP_Settings::RightArrowOnClick);
 
-	//====================Audio Panel==============================
-
-	if (PlayerStateRef.IsValid())
-	{
-		SFX_Volume_Slider->SetValue(PlayerStateRef->Get_SFX_Volume());
-		Music_Volume_Slider->SetValue(PlayerStateRef->Get_Music_Volume());
-	}
-
-	SFX_Volume_Slider->OnValueChanged.AddDynamic(this, &UWCPP_Settings::SFX_Volume_Slider_OnValueChanged);
-	Music_Volume_Slider->OnValueChanged.AddDynamic(this, &UWCPP_Settings::Music_Volume_Slider_OnValueChanged);
-
-	MM_Repeat_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::MM_Repeat_Button_OnClick);
-	MM_PreviousTrack_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::MM_PreviousTrack_Button_OnClick);
-	MM_NextTrack_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::MM_NextTrack_Button_OnClick);
-	MM_PlayPause_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::MM_PlayPause_Button_OnClick);
-	Music_EchoOfSadness_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_Settings::Music_EchoOfSadness_OnCheckStateChanged);
-	Music_Memories_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_Settings::Music_Memories_OnCheckStateChanged);
-	Music_Tenderness_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_Settings::Music_Tenderness_OnCheckStateChanged);
-
-	L_Repeat_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::L_Repeat_Button_OnClick);
-	L_PreviousTrack_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::L_PreviousTrack_Button_OnClick);
-	L_NextTrack_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::L_NextTrack_Button_OnClick);
-	L_PlayPause_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::L_PlayPause_Button_OnClick);
-	Music_CreativeMinds_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_Settings::Music_CreativeMinds_OnCheckStateChanged);
-	Music_Elevate_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_Settings::Music_Elevate_OnCheckStateChanged);
-	Music_GroovyHipHop_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_Settings::Music_GroovyHipHop_OnCheckStateChanged);
-	Music_Punky_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_Settings::Music_Punky_OnCheckStateChanged);
-	Music_Rumble_CheckBox->OnCheckStateChanged.AddDynamic(
-		this, &UWCPP_Settings::Music_Rumble_OnCheckStateChanged);
-
-	//=================Video Quality Panel=========================
-
-	GameUserSettings = UGameUserSettings::GetGameUserSettings();
-	CurrentScreenResolution = GameUserSettings->GetScreenResolution();
-	SetCurrentResolutionToTextBlock();
-
-	if (const int32 TextureQuality = GameUserSettings->GetTextureQuality();
-		TextureQuality < TextureQualityWidgetSwitcher->GetNumWidgets())
-	{
-		TextureQualityWidgetSwitcher->SetActiveWidgetIndex(TextureQuality);
-	}
-
-	if (const int32 ShadowQuality = GameUserSettings->GetShadowQuality();
-		ShadowQuality < ShadowsQualityWidgetSwitcher->GetNumWidgets())
-	{
-		ShadowsQualityWidgetSwitcher->SetActiveWidgetIndex(ShadowQuality);
-	}
-
-	ApplyChangesButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ApplyChangesButtonOnClick);
-	ResolutionLeftButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ResolutionLeftButtonOnClick);
-	ResolutionRightButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ResolutionRightButtonOnClick);
-	TextureQualityLeftButton->OnClicked.AddDynamic(this, &UWCPP_Settings::TextureQualityLeftButtonOnClick);
-	TextureQualityRightButton->OnClicked.AddDynamic(this, &UWCPP_Settings::TextureQualityRightButtonOnClick);
-	ShadowsQualityLeftButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ShadowsQualityLeftButtonOnClick);
-	ShadowsQualityRightButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ShadowsQualityRightButtonOnClick);
-
 	//================Gamepad & Keyboard===========================
 }
 
 void UWCPP_Settings::NativeDestruct()
 {
-	if (IsValid(SoundManagerMainMenuRef) && IsValid(SoundManagerLevelRef))
+	if (bTracksWereInitialized && IsValid(SoundManagerMainMenuRef) && IsValid(SoundManagerLevelRef))
 	{
 		SoundManagerMainMenuRef->TrackWasSwitchedDelegate.Remove(DH_MM_TrackWasSwitched);
 		DH_MM_TrackWasSwitched.Reset();
@@ -345,6 +238,24 @@ void UWCPP_Settings::NativeDestruct()
 			SoundManagerLevelRef = nullptr;
 		}
 	}
+	else if (bVolumesWereInitialized && PlayerStateRef.IsValid())
+	{
+		PlayerStateRef->CollectAudioInfoForSavingItToFile();
+
+		if (PlayerStateRef->Get_Music_Volume() <= 0.0f)
+		{
+			if (bIsMainMenu && IsValid(SoundManagerMainMenuRef))
+			{
+				SoundManagerMainMenuRef->PauseCurrentTrack();
+			}
+			else if (!bIsMainMenu && IsValid(SoundManagerLevelRef))
+			{
+				SoundManagerLevelRef->StopPlayingCurrentTrack();
+			}
+		}
+	}
+	SoundManagerMainMenuRef = nullptr;
+	SoundManagerLevelRef = nullptr;
 
 	//===================Bottom Panel==============================
 
@@ -353,44 +264,56 @@ void UWCPP_Settings::NativeDestruct()
 
 	//====================Audio Panel==============================
 
-	SFX_Volume_Slider->OnValueChanged.RemoveDynamic(this, &UWCPP_Settings::SFX_Volume_Slider_OnValueChanged);
-	Music_Volume_Slider->OnValueChanged.RemoveDynamic(this, &UWCPP_Settings::Music_Volume_Slider_OnValueChanged);
-
-	MM_Repeat_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::MM_Repeat_Button_OnClick);
-	MM_PreviousTrack_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::MM_PreviousTrack_Button_OnClick);
-	MM_NextTrack_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::MM_NextTrack_Button_OnClick);
-	MM_PlayPause_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::MM_PlayPause_Button_OnClick);
-	Music_EchoOfSadness_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_Settings::Music_EchoOfSadness_OnCheckStateChanged);
-	Music_Memories_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_Settings::Music_Memories_OnCheckStateChanged);
-	Music_Tenderness_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_Settings::Music_Tenderness_OnCheckStateChanged);
+	if (bVolumesWereInitialized)
+	{
+		SFX_Volume_Slider->OnValueChanged.RemoveDynamic(this, &UWCPP_Settings::SFX_Volume_Slider_OnValueChanged);
+		Music_Volume_Slider->OnValueChanged.RemoveDynamic(this, &UWCPP_Settings::Music_Volume_Slider_OnValueChanged);
+		bVolumesWereInitialized = false;
+	}
 
-	L_Repeat_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::L_Repeat_Button_OnClick);
-	L_PreviousTrack_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::L_PreviousTrack_Button_OnClick);
-	L_NextTrack_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::L_NextTrack_Button_OnClick);
-	L_PlayPause_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::L_PlayPause_Button_OnClick);
-	Music_CreativeMinds_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_Settings::Music_CreativeMinds_OnCheckStateChanged);
-	Music_Elevate_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_Settings::Music_Elevate_OnCheckStateChanged);
-	Music_GroovyHipHop_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_Settings::Music_GroovyHipHop_OnCheckStateChanged);
-	Music_Punky_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_Settings::Music_Punky_OnCheckStateChanged);
-	Music_Rumble_CheckBox->OnCheckStateChanged.RemoveDynamic(
-		this, &UWCPP_Settings::Music_Rumble_OnCheckStateChanged);
+	if (bTracksWereInitialized)
+	{
+		MM_Repeat_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::MM_Repeat_Button_OnClick);
+		MM_PreviousTrack_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::MM_PreviousTrack_Button_OnClick);
+		MM_NextTrack_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::MM_NextTrack_Button_OnClick);
+		MM_PlayPause_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::MM_PlayPause_Button_OnClick);
+		Music_EchoOfSadness_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_Settings::Music_EchoOfSadness_OnCheckStateChanged);
+		Music_Memories_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_Settings::Music_Memories_OnCheckStateChanged);
+		Music_Tenderness_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_Settings::Music_Tenderness_OnCheckStateChanged);
+
+		L_Repeat_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::L_Repeat_Button_OnClick);
+		L_PreviousTrack_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::L_PreviousTrack_Button_OnClick);
+		L_NextTrack_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::L_NextTrack_Button_OnClick);
+		L_PlayPause_Button->OnClicked.RemoveDynamic(this, &UWCPP_Settings::L_PlayPause_Button_OnClick);
+		Music_CreativeMinds_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_Settings::Music_CreativeMinds_OnCheckStateChanged);
+		Music_Elevate_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_Settings::Music_Elevate_OnCheckStateChanged);
+		Music_GroovyHipHop_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_Settings::Music_GroovyHipHop_OnCheckStateChanged);
+		Music_Punky_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_Settings::Music_Punky_OnCheckStateChanged);
+		Music_Rumble_CheckBox->OnCheckStateChanged.RemoveDynamic(
+			this, &UWCPP_Settings::Music_Rumble_OnCheckStateChanged);
+		bTracksWereInitialized = false;
+	}
 
 	//=================Video Quality Panel=========================
 
-	ApplyChangesButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ApplyChangesButtonOnClick);
-	ResolutionLeftButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ResolutionLeftButtonOnClick);
-	ResolutionRightButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ResolutionRightButtonOnClick);
-	TextureQualityLeftButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::TextureQualityLeftButtonOnClick);
-	TextureQualityRightButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::TextureQualityRightButtonOnClick);
-	ShadowsQualityLeftButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ShadowsQualityLeftButtonOnClick);
-	ShadowsQualityRightButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ShadowsQualityRightButtonOnClick);
+	if (bVideoQualityWasInitialized)
+	{
+		ApplyChangesButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ApplyChangesButtonOnClick);
+		ResolutionLeftButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ResolutionLeftButtonOnClick);
+		ResolutionRightButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ResolutionRightButtonOnClick);
+		TextureQualityLeftButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::TextureQualityLeftButtonOnClick);
+		TextureQualityRightButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::TextureQualityRightButtonOnClick);
+		ShadowsQualityLeftButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ShadowsQualityLeftButtonOnClick);
+		ShadowsQualityRightButton->OnClicked.RemoveDynamic(this, &UWCPP_Settings::ShadowsQualityRightButtonOnClick);
+		bVideoQualityWasInitialized = false;
+	}
 
 	//================Gamepad & Keyboard===========================
 
@@ -408,6 +331,7 @@ void UWCPP_Settings::RightArrowOnClick()
 	{
 		PanelsSwitcher->SetActiveWidgetIndex(CurrentIndex + 1);
 	}
+	InitializeActivePanel();
 }
 
 void UWCPP_Settings::LeftArrowOnClick()
@@ -421,6 +345,132 @@ void UWCPP_Settings::LeftArrowOnClick()
 	{
 		PanelsSwitcher->SetActiveWidgetIndex(CurrentIndex - 1);
 	}
+	InitializeActivePanel();
+}
+
+bool UWCPP_Settings::IsOnActivePanel(UWidget* Widget) const
+{
+	UWidget* ActivePanel = PanelsSwitcher->GetActiveWidget();
+	if (!IsValid(Widget) || !IsValid(ActivePanel))
+		return false;
+
+	return Widget == ActivePanel || Widget->IsChildOf(ActivePanel);
+}
+
+void UWCPP_Settings::InitializeActivePanel()
+{
+	if (!bVolumesWereInitialized && IsOnActivePanel(SFX_Volume_Slider))
+	{
+		InitializeVolumes();
+	}
+	if (!bTracksWereInitialized &&
+		(IsOnActivePanel(MM_Repeat_Button) || IsOnActivePanel(L_Repeat_Button)))
+	{
+		InitializeTracks();
+	}
+	if (!bVideoQualityWasInitialized && IsOnActivePanel(ApplyChangesButton))
+	{
+		InitializeVideoQuality();
+	}
+}
+
+void UWCPP_Settings::InitializeTracks()
+{
+	bTracksWereInitialized = true;
+
+	if (PlayerControllerRef.IsValid() && GameInstanceRef.IsValid())
+	{
+		if (bIsMainMenu)
+		{
+			InitializeMainMenuTracksPanel();
+
+			if (IsValid(CAT_LOAD_SYNCHRONOUS(SoundManagersDataTable)))
+			{
+				if (UClass* SoundManagerClass = GameInstanceRef->GetActorClassBySoftReference(
+					UCPP_StaticWidgetLibrary::GetSoftReferenceToSoundManagerByRowName(
+						SoundManagersDataTable.Get(),
+						FName(TEXT("LevelSoundManager")))))
+				{
+					ACPP_SoundManagerLevel* TmpSoundManager = GetWorld()->SpawnActorDeferred<ACPP_SoundManagerLevel>(
+						SoundManagerClass,
+						FTransform::Identity,
+						nullptr,
+						nullptr,
+						ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+
+					if (IsValid(TmpSoundManager))
+					{
+						TmpSoundManager->SetPlayerControllerRef(PlayerControllerRef.Get());
+						TmpSoundManager->ApplySettingsFromTheSaveFile(
+							PlayerStateRef.IsValid()
+								? !PlayerStateRef->GetSaveFileWasCreated()
+								: true, true);
+						SoundManagerLevelRef = TmpSoundManager;
+						UGameplayStatics::FinishSpawningActor(TmpSoundManager, FTransform());
+						InitializeLevelTracksPanel();
+					}
+				}
+			}
+		}
+		else
+		{
+			InitializeLevelTracksPanel();
+
+			if (IsValid(CAT_LOAD_SYNCHRONOUS(SoundManagersDataTable)))
+			{
+				if (UClass* SoundManagerClass = GameInstanceRef->GetActorClassBySoftReference(
+					UCPP_StaticWidgetLibrary::GetSoftReferenceToSoundManagerByRowName(
+						SoundManagersDataTable.Get(),
+						FName(TEXT("MainMenuSoundManager")))))
+				{
+					ACPP_SoundManagerMainMenu* TmpSoundManager = GetWorld()->SpawnActorDeferred<ACPP_SoundManagerMainMenu>(
+						SoundManagerClass,
+						FTransform::Identity,
+						nullptr,
+						nullptr,
+						ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+
+					if (IsValid(TmpSoundManager))
+					{
+						TmpSoundManager->SetPlayerControllerRef(PlayerControllerRef.Get());
+						TmpSoundManager->ApplySettingsFromTheSaveFile(
+							PlayerStateRef.IsValid()
+								? !PlayerStateRef->GetSaveFileWasCreated()
+								: true, true);
+						SoundManagerMainMenuRef = TmpSoundManager;
+						UGameplayStatics::FinishSpawningActor(TmpSoundManager, FTransform());
+						InitializeMainMenuTracksPanel();
+					}
+				}
+			}
+		}
+	}
+
+	MM_Repeat_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::MM_Repeat_Button_OnClick);
+	MM_PreviousTrack_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::MM_PreviousTrack_Button_OnClick);
+	MM_NextTrack_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::MM_NextTrack_Button_OnClick);
+	MM_PlayPause_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::MM_PlayPause_Button_OnClick);
+	Music_EchoOfSadness_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_Settings::Music_EchoOfSadness_OnCheckStateChanged);
+	Music_Memories_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_Settings::Music_Memories_OnCheckStateChanged);
+	Music_Tenderness_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_Settings::Music_Tenderness_OnCheckStateChanged);
+
+	L_Repeat_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::L_Repeat_Button_OnClick);
+	L_PreviousTrack_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::L_PreviousTrack_Button_OnClick);
+	L_NextTrack_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::L_NextTrack_Button_OnClick);
+	L_PlayPause_Button->OnClicked.AddDynamic(this, &UWCPP_Settings::L_PlayPause_Button_OnClick);
+	Music_CreativeMinds_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_Settings::Music_CreativeMinds_OnCheckStateChanged);
+	Music_Elevate_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_Settings::Music_Elevate_OnCheckStateChanged);
+	Music_GroovyHipHop_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_Settings::Music_GroovyHipHop_OnCheckStateChanged);
+	Music_Punky_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_Settings::Music_Punky_OnCheckStateChanged);
+	Music_Rumble_CheckBox->OnCheckStateChanged.AddDynamic(
+		this, &UWCPP_Settings::Music_Rumble_OnCheckStateChanged);
 }
 
 void UWCPP_Settings::InitializeMainMenuTracksPanel()
@@ -501,6 +551,20 @@ void UWCPP_Settings::InitializeLevelTracksPanel()
 	}
 }
 
+void UWCPP_Settings::InitializeVolumes()
+{
+	bVolumesWereInitialized = true;
+
+	if (PlayerStateRef.IsValid())
+	{
+		SFX_Volume_Slider->SetValue(PlayerStateRef->Get_SFX_Volume());
+		Music_Volume_Slider->SetValue(PlayerStateRef->Get_Music_Volume());
+	}
+
+	SFX_Volume_Slider->OnValueChanged.AddDynamic(this, &UWCPP_Settings::SFX_Volume_Slider_OnValueChanged);
+	Music_Volume_Slider->OnValueChanged.AddDynamic(this, &UWCPP_Settings::Music_Volume_Slider_OnValueChanged);
+}
+
 void UWCPP_Settings::SFX_Volume_Slider_OnValueChanged(const float Value)
 {
 	if (bIsMainMenu && IsValid(SoundManagerMainMenuRef))
@@ -886,6 +950,35 @@ void UWCPP_Settings::SetCurrentResolutionToTextBlock()
 	}
 }
 
+void UWCPP_Settings::InitializeVideoQuality()
+{
+	bVideoQualityWasInitialized = true;
+
+	GameUserSettings = UGameUserSettings::GetGameUserSettings();
+	CurrentScreenResolution = GameUserSettings->GetScreenResolution();
+	SetCurrentResolutionToTextBlock();
+
+	if (const int32 TextureQuality = GameUserSettings->GetTextureQuality();
+		TextureQuality < TextureQualityWidgetSwitcher->GetNumWidgets())
+	{
+		TextureQualityWidgetSwitcher->SetActiveWidgetIndex(TextureQuality);
+	}
+
+	if (const int32 ShadowQuality = GameUserSettings->GetShadowQuality();
+		ShadowQuality < ShadowsQualityWidgetSwitcher->GetNumWidgets())
+	{
+		ShadowsQualityWidgetSwitcher->SetActiveWidgetIndex(ShadowQuality);
+	}
+
+	ApplyChangesButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ApplyChangesButtonOnClick);
+	ResolutionLeftButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ResolutionLeftButtonOnClick);
+	ResolutionRightButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ResolutionRightButtonOnClick);
+	TextureQualityLeftButton->OnClicked.AddDynamic(this, &UWCPP_Settings::TextureQualityLeftButtonOnClick);
+	TextureQualityRightButton->OnClicked.AddDynamic(this, &UWCPP_Settings::TextureQualityRightButtonOnClick);
+	ShadowsQualityLeftButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ShadowsQualityLeftButtonOnClick);
+	ShadowsQualityRightButton->OnClicked.AddDynamic(this, &UWCPP_Settings::ShadowsQualityRightButtonOnClick);
+}
+
 void UWCPP_Settings::ApplyChangesButtonOnClick()
 {
 	switch (ResolutionWidgetSwitcher->GetActiveWidgetIndex())
@@ -0,0 +1,84 @@
+﻿// (c) M. A. Shalaeva, 2024
+
+#include "../Classes/WCPP_VirtualKeyboardKey.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/Button.h"
+#include "Components/TextBlock.h"
+
+UWCPP_VirtualKeyboardKey::UWCPP_VirtualKeyboardKey(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer),
+	  KeyButton(nullptr),
+	  KeyTextBlock(nullptr),
+	  KeyIndex(INDEX_NONE),
+	  KeyType(EVirtualKeyType::Symbol)
+{
+}
+
+void UWCPP_VirtualKeyboardKey::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	if (!KeyButton)
+	{
+		KeyButton = WidgetTree->ConstructWidget<UButton>();
+		if (!WidgetTree->RootWidget)
+		{
+			WidgetTree->RootWidget = KeyButton;
+		}
+		else if (UPanelWidget* RootPanel = Cast<UPanelWidget>(WidgetTree->RootWidget))
+		{
+			RootPanel->AddChild(KeyButton);
+		}
+	}
+	if (!KeyTextBlock)
+	{
+		KeyTextBlock = WidgetTree->ConstructWidget<UTextBlock>();
+		KeyTextBlock->SetJustification(ETextJustify::Center);
+		if (KeyButton->GetChildrenCount() == 0)
+		{
+			KeyButton->AddChild(KeyTextBlock);
+		}
+	}
+}
+
+void UWCPP_VirtualKeyboardKey::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	KeyButton->OnClicked.AddDynamic(this, &UWCPP_VirtualKeyboardKey::KeyButtonOnClick);
+}
+
+void UWCPP_VirtualKeyboardKey::NativeDestruct()
+{
+	KeyButton->OnClicked.RemoveDynamic(this, &UWCPP_VirtualKeyboardKey::KeyButtonOnClick);
+
+	Super::NativeDestruct();
+}
+
+void UWCPP_VirtualKeyboardKey::KeyButtonOnClick()
+{
+	KeyWasPressedDelegate.Broadcast(KeyIndex);
+}
+
+void UWCPP_VirtualKeyboardKey::SetKey(const int32 InKeyIndex, const EVirtualKeyType InKeyType)
+{
+	KeyIndex = InKeyIndex;
+	if (KeyType != InKeyType)
+	{
+		KeyType = InKeyType;
+		ChangeKeyImage(KeyType);
+	}
+}
+
+void UWCPP_VirtualKeyboardKey::SetKeyText(const FText& NewText) const
+{
+	if (!KeyTextBlock->GetText().EqualTo(NewText))
+	{
+		KeyTextBlock->SetText(NewText);
+	}
+}
+
+void UWCPP_VirtualKeyboardKey::SetFocusOnKey() const
+{
+	KeyButton->SetKeyboardFocus();
+}
\ No newline at end of file